@@ -0,0 +1,693 @@
+#include "APU.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Bits that always read as 1 for $FF10-$FF3F
+static const H_BYTE read_masks[0x30] =
+{
+	0x80, 0x3F, 0x00, 0xFF, 0xBF,	// NR10-NR14
+	0xFF, 0x3F, 0x00, 0xFF, 0xBF,	// ---- NR21-NR24
+	0x7F, 0xFF, 0x9F, 0xFF, 0xBF,	// NR30-NR34
+	0xFF, 0xFF, 0x00, 0x00, 0xBF,	// ---- NR41-NR44
+	0x00, 0x00, 0x70,				// NR50-NR52
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00	// Wave RAM
+};
+
+// Waveforms of 12.5%, 25%, 50% and 75% duty, step 0 is the highest bit
+static const H_BYTE duty_table[4] = { 0x01, 0x81, 0x87, 0x7E };
+
+// Noise divisors by NR43 bits 2-0
+static const H_BYTE noise_divisors[8] = { 8, 16, 32, 48, 64, 80, 96, 112 };
+
+void APU::reset()
+{
+	m_s = STATE();
+	m_s.time = gb->cpu.dot_count();
+	m_s.sequencer = m_s.time + _APU_SEQUENCER_PERIOD;
+
+	for (int ch = 0; ch < 4; ch++)
+		m_level[ch] = 0;
+	m_out[0] = m_out[1] = 0;
+
+	// State left by boot ROM, without retriggering its beep
+	write(0xFF26, 0xF1);
+	write(0xFF10, 0x80);
+	write(0xFF11, 0xBF);
+	write(0xFF12, 0xF3);
+	write(0xFF14, 0x3F);
+	write(0xFF16, 0x3F);
+	write(0xFF17, 0x00);
+	write(0xFF19, 0x3F);
+	write(0xFF1A, 0x7F);
+	write(0xFF1B, 0xFF);
+	write(0xFF1C, 0x9F);
+	write(0xFF1E, 0x3F);
+	write(0xFF20, 0xFF);
+	write(0xFF21, 0x00);
+	write(0xFF22, 0x00);
+	write(0xFF23, 0x3F);
+	write(0xFF24, 0x77);
+	write(0xFF25, 0xF3);
+	read_status();
+
+	reset_output();
+}
+
+void APU::write(H_WORD addr, H_BYTE data)
+{
+	catch_up();
+
+	int r = addr - 0xFF10;
+
+	// Wave RAM
+	if (addr >= 0xFF30)
+	{
+		m_s.regs[r] = data;
+		gb->m_memory[addr] = data;
+		update_level(2, m_s.time);
+		return;
+	}
+
+	if (addr == 0xFF26)
+	{
+		bool power = (data & 0x80) != 0;
+		if (!power && m_s.power)
+		{
+			// Turning APU off clears all its registers but wave RAM
+			for (int i = 0; i < 0x16; i++)
+			{
+				m_s.regs[i] = 0x00;
+				gb->m_memory[0xFF10 + i] = read_masks[i];
+			}
+			m_s.square[0] = SQUARE();
+			m_s.square[1] = SQUARE();
+			m_s.wave  = WAVE();
+			m_s.noise = NOISE();
+		}
+		else if (power && !m_s.power)
+			m_s.step = 0;
+
+		m_s.power = power;
+		for (int ch = 0; ch < 4; ch++)
+			update_level(ch, m_s.time);
+		update_mix(m_s.time);
+		read_status();
+		return;
+	}
+
+	// Registers can't be written while APU is off
+	if (!m_s.power)
+		return;
+
+	m_s.regs[r] = data;
+	gb->m_memory[addr] = data | read_masks[r];
+
+	SQUARE& sq = m_s.square[addr < 0xFF15 ? 0 : 1];
+	switch (addr)
+	{
+	case 0xFF10: // NR10
+		sq.sweep_period = (data >> 4) & 0x07;
+		sq.sweep_negate = (data & 0x08) != 0;
+		sq.sweep_shift  = data & 0x07;
+		break;
+	case 0xFF11: // NR11
+	case 0xFF16: // NR21
+		sq.duty = data >> 6;
+		sq.length.counter = 64 - (data & 0x3F);
+		break;
+	case 0xFF12: // NR12
+	case 0xFF17: // NR22
+		sq.dac = (data & 0xF8) != 0;
+		sq.on &= sq.dac;
+		break;
+	case 0xFF13: // NR13
+	case 0xFF18: // NR23
+		sq.freq = (sq.freq & 0x0700) | data;
+		break;
+	case 0xFF14: // NR14
+	case 0xFF19: // NR24
+		sq.freq = (sq.freq & 0x00FF) | ((data & 0x07) << 8);
+		sq.length.enabled = (data & 0x40) != 0;
+		if (data & 0x80)
+			trigger(addr == 0xFF14 ? 0 : 1);
+		break;
+
+	case 0xFF1A: // NR30
+		m_s.wave.dac = (data & 0x80) != 0;
+		m_s.wave.on &= m_s.wave.dac;
+		break;
+	case 0xFF1B: // NR31
+		m_s.wave.length.counter = 256 - data;
+		break;
+	case 0xFF1C: // NR32
+	{
+		static const H_BYTE shifts[4] = { 4, 0, 1, 2 };
+		m_s.wave.shift = shifts[(data >> 5) & 0x03];
+		break;
+	}
+	case 0xFF1D: // NR33
+		m_s.wave.freq = (m_s.wave.freq & 0x0700) | data;
+		break;
+	case 0xFF1E: // NR34
+		m_s.wave.freq = (m_s.wave.freq & 0x00FF) | ((data & 0x07) << 8);
+		m_s.wave.length.enabled = (data & 0x40) != 0;
+		if (data & 0x80)
+			trigger(2);
+		break;
+
+	case 0xFF20: // NR41
+		m_s.noise.length.counter = 64 - (data & 0x3F);
+		break;
+	case 0xFF21: // NR42
+		m_s.noise.dac = (data & 0xF8) != 0;
+		m_s.noise.on &= m_s.noise.dac;
+		break;
+	case 0xFF22: // NR43
+		m_s.noise.period = noise_divisors[data & 0x07] << (data >> 4);
+		m_s.noise.width7 = (data & 0x08) != 0;
+		break;
+	case 0xFF23: // NR44
+		m_s.noise.length.enabled = (data & 0x40) != 0;
+		if (data & 0x80)
+			trigger(3);
+		break;
+
+	case 0xFF24: // NR50
+	case 0xFF25: // NR51
+		update_mix(m_s.time);
+		return;
+
+	default:
+		return;
+	}
+
+	for (int ch = 0; ch < 4; ch++)
+		update_level(ch, m_s.time);
+}
+
+void APU::read_status()
+{
+	catch_up();
+
+	H_BYTE status = m_s.power ? 0x80 : 0x00;
+	status |= m_s.square[0].on ? 0x01 : 0x00;
+	status |= m_s.square[1].on ? 0x02 : 0x00;
+	status |= m_s.wave.on      ? 0x04 : 0x00;
+	status |= m_s.noise.on     ? 0x08 : 0x00;
+	gb->m_memory[0xFF26] = status | read_masks[0x16];
+}
+
+void APU::trigger(int ch)
+{
+	auto start_envelope = [this](ENVELOPE& env, H_BYTE nrx2)
+	{
+		env.volume = nrx2 >> 4;
+		env.add    = (nrx2 & 0x08) != 0;
+		env.period = nrx2 & 0x07;
+		env.timer  = env.period;
+	};
+
+	if (ch < 2)
+	{
+		SQUARE& sq = m_s.square[ch];
+		sq.on = sq.dac;
+		if (sq.length.counter == 0)
+			sq.length.counter = 64;
+		sq.timer = (2048 - sq.freq) * 4;
+		start_envelope(sq.envelope, m_s.regs[ch == 0 ? 0x02 : 0x07]);
+
+		if (ch == 0)
+		{
+			sq.shadow        = sq.freq;
+			sq.sweep_timer   = sq.sweep_period ? sq.sweep_period : 8;
+			sq.sweep_enabled = sq.sweep_period != 0 || sq.sweep_shift != 0;
+			if (sq.sweep_shift != 0)
+				sweep_frequency();
+		}
+	}
+	else if (ch == 2)
+	{
+		WAVE& w = m_s.wave;
+		w.on = w.dac;
+		if (w.length.counter == 0)
+			w.length.counter = 256;
+		w.timer = (2048 - w.freq) * 2;
+		w.pos = 0;
+	}
+	else
+	{
+		NOISE& n = m_s.noise;
+		n.on = n.dac;
+		if (n.length.counter == 0)
+			n.length.counter = 64;
+		n.timer = n.period;
+		n.lfsr  = 0x7FFF;
+		start_envelope(n.envelope, m_s.regs[0x11]);
+	}
+}
+
+void APU::catch_up()
+{
+	H_QWORD now = gb->cpu.dot_count();
+
+	// Time is split at frame sequencer ticks, channels run freely in between
+	while (m_s.time < now)
+	{
+		H_QWORD end = std::min(now, m_s.sequencer);
+		if (m_s.power)
+		{
+			run_square(0, end);
+			run_square(1, end);
+			run_wave(end);
+			run_noise(end);
+		}
+		m_s.time = end;
+
+		if (end == m_s.sequencer)
+		{
+			if (m_s.power)
+				sequencer_tick();
+			m_s.sequencer += _APU_SEQUENCER_PERIOD;
+		}
+	}
+}
+
+void APU::run_square(int ch, H_QWORD to)
+{
+	SQUARE& sq = m_s.square[ch];
+	H_QWORD period = (2048 - sq.freq) * 4;
+	H_QWORD t = m_s.time + sq.timer;
+
+	if (!sq.on || m_rate == 0)
+	{
+		// Nobody hears it, only position matters
+		if (t < to)
+		{
+			H_QWORD n = (to - t) / period + 1;
+			sq.pos = (sq.pos + n) & 0x07;
+			t += n * period;
+		}
+	}
+	else
+	{
+		for (; t < to; t += period)
+		{
+			sq.pos = (sq.pos + 1) & 0x07;
+			update_level(ch, t);
+		}
+	}
+
+	sq.timer = (H_DWORD)(t - to);
+}
+
+void APU::run_wave(H_QWORD to)
+{
+	WAVE& w = m_s.wave;
+	H_QWORD period = (2048 - w.freq) * 2;
+	H_QWORD t = m_s.time + w.timer;
+
+	if (!w.on || m_rate == 0)
+	{
+		if (t < to)
+		{
+			H_QWORD n = (to - t) / period + 1;
+			w.pos = (w.pos + n) & 0x1F;
+			t += n * period;
+		}
+	}
+	else
+	{
+		for (; t < to; t += period)
+		{
+			w.pos = (w.pos + 1) & 0x1F;
+			update_level(2, t);
+		}
+	}
+
+	w.timer = (H_DWORD)(t - to);
+}
+
+void APU::run_noise(H_QWORD to)
+{
+	NOISE& n = m_s.noise;
+	H_QWORD t = m_s.time + n.timer;
+
+	if (!n.on || m_rate == 0)
+	{
+		// LFSR restarts on trigger and is not visible otherwise, so it is not stepped
+		if (t < to)
+			t += ((to - t) / n.period + 1) * n.period;
+	}
+	else
+	{
+		for (; t < to; t += n.period)
+		{
+			H_WORD bit = (n.lfsr ^ (n.lfsr >> 1)) & 1;
+			n.lfsr = (n.lfsr >> 1) | (bit << 14);
+			if (n.width7)
+				n.lfsr = (n.lfsr & ~(1 << 6)) | (bit << 6);
+			update_level(3, t);
+		}
+	}
+
+	n.timer = (H_DWORD)(t - to);
+}
+
+void APU::sequencer_tick()
+{
+	H_BYTE step = m_s.step;
+	m_s.step = (step + 1) & 0x07;
+
+	if ((step & 1) == 0)
+	{
+		clock_length(m_s.square[0].length, m_s.square[0].on);
+		clock_length(m_s.square[1].length, m_s.square[1].on);
+		clock_length(m_s.wave.length, m_s.wave.on);
+		clock_length(m_s.noise.length, m_s.noise.on);
+	}
+	if (step == 2 || step == 6)
+		clock_sweep();
+	if (step == 7)
+	{
+		clock_envelope(m_s.square[0].envelope);
+		clock_envelope(m_s.square[1].envelope);
+		clock_envelope(m_s.noise.envelope);
+	}
+
+	for (int ch = 0; ch < 4; ch++)
+		update_level(ch, m_s.time);
+}
+
+void APU::clock_length(LENGTH& length, bool& on)
+{
+	if (length.enabled && length.counter > 0)
+		if (--length.counter == 0)
+			on = false;
+}
+
+void APU::clock_envelope(ENVELOPE& env)
+{
+	if (env.period == 0)
+		return;
+
+	if (env.timer > 0)
+		env.timer--;
+	if (env.timer == 0)
+	{
+		env.timer = env.period;
+		if (env.add && env.volume < 15)
+			env.volume++;
+		else if (!env.add && env.volume > 0)
+			env.volume--;
+	}
+}
+
+void APU::clock_sweep()
+{
+	SQUARE& sq = m_s.square[0];
+
+	if (sq.sweep_timer > 0)
+		sq.sweep_timer--;
+	if (sq.sweep_timer != 0)
+		return;
+
+	sq.sweep_timer = sq.sweep_period ? sq.sweep_period : 8;
+	if (!sq.sweep_enabled || sq.sweep_period == 0)
+		return;
+
+	H_WORD freq = sweep_frequency();
+	if (freq <= 2047 && sq.sweep_shift != 0)
+	{
+		sq.shadow = freq;
+		sq.freq   = freq;
+		sweep_frequency(); // Overflow is checked once more with new frequency
+	}
+}
+
+H_WORD APU::sweep_frequency()
+{
+	SQUARE& sq = m_s.square[0];
+
+	H_WORD delta = sq.shadow >> sq.sweep_shift;
+	H_WORD freq  = sq.sweep_negate ? sq.shadow - delta : sq.shadow + delta;
+	if (freq > 2047)
+		sq.on = false;
+	return freq;
+}
+
+int APU::channel_level(int ch) const
+{
+	if (!m_s.power)
+		return 0;
+
+	switch (ch)
+	{
+	case 0:
+	case 1:
+	{
+		const SQUARE& sq = m_s.square[ch];
+		if (!sq.on)
+			return 0;
+		return ((duty_table[sq.duty] >> (7 - sq.pos)) & 1) * sq.envelope.volume;
+	}
+	case 2:
+	{
+		const WAVE& w = m_s.wave;
+		if (!w.on)
+			return 0;
+		H_BYTE sample = m_s.regs[0x20 + (w.pos >> 1)];
+		sample = (w.pos & 1) ? (sample & 0x0F) : (sample >> 4);
+		return sample >> w.shift;
+	}
+	default:
+	{
+		const NOISE& n = m_s.noise;
+		if (!n.on)
+			return 0;
+		return (~n.lfsr & 1) * n.envelope.volume;
+	}
+	}
+}
+
+void APU::update_level(int ch, H_QWORD time)
+{
+	int level = channel_level(ch);
+	if (level == m_level[ch])
+		return;
+
+	m_level[ch] = level;
+	update_mix(time);
+}
+
+void APU::update_mix(H_QWORD time)
+{
+	H_BYTE nr50 = m_s.regs[0x14];
+	H_BYTE nr51 = m_s.regs[0x15];
+
+	int out[2] = { 0, 0 };
+	for (int ch = 0; ch < 4; ch++)
+	{
+		if (nr51 & (0x10 << ch)) out[0] += m_level[ch];
+		if (nr51 & (0x01 << ch)) out[1] += m_level[ch];
+	}
+	out[0] *= ((nr50 >> 4) & 0x07) + 1;
+	out[1] *= (nr50 & 0x07) + 1;
+
+	for (int side = 0; side < 2; side++)
+	{
+		if (m_rate != 0)
+			add_step(side, time, out[side] - m_out[side]);
+		m_out[side] = out[side];
+	}
+}
+
+void APU::set_sample_rate(int rate)
+{
+	catch_up();
+
+	m_rate = std::max(0, rate);
+	if (m_rate != 0)
+	{
+		m_resampler.configure((double)(CLOCKSPEED >> _APU_NATIVE_SHIFT), m_rate);
+		m_tap.configure((double)(CLOCKSPEED >> _APU_NATIVE_SHIFT), m_rate);
+	}
+	reset_output();
+}
+
+void APU::reset_output()
+{
+	m_read_pos = m_s.time >> _APU_NATIVE_SHIFT;
+	for (int side = 0; side < 2; side++)
+	{
+		m_steps[side].clear();
+		m_native[side].clear();
+		m_sum[side]  = (float)m_out[side];
+		m_last[side] = (float)m_out[side];
+		m_dc[side]   = 0.0f;
+	}
+	m_resampler.clear();
+	m_tap.clear();
+}
+
+const float* APU::blep_kernel()
+{
+	static std::vector<float> kernel = []()
+	{
+		const double PI = 3.14159265358979323846;
+		const double cutoff = 0.45; // Of native rate, resampler cuts lower anyway
+
+		std::vector<float> k(_APU_BLEP_PHASES * _APU_BLEP_TAPS);
+		for (int p = 0; p < _APU_BLEP_PHASES; p++)
+		{
+			float* taps = &k[p * _APU_BLEP_TAPS];
+			double frac = (double)p / _APU_BLEP_PHASES;
+			double sum = 0.0;
+			for (int i = 0; i < _APU_BLEP_TAPS; i++)
+			{
+				double x = i - (_APU_BLEP_TAPS / 2 - 1) - frac;
+				double sinc = (x == 0.0) ? 1.0 : std::sin(2.0 * PI * cutoff * x) / (2.0 * PI * cutoff * x);
+				double window = 0.42 + 0.5 * std::cos(PI * x / (_APU_BLEP_TAPS / 2)) + 0.08 * std::cos(2.0 * PI * x / (_APU_BLEP_TAPS / 2));
+				taps[i] = (float)(sinc * window);
+				sum += taps[i];
+			}
+
+			// Whole step has to come out no matter where it is placed
+			for (int i = 0; i < _APU_BLEP_TAPS; i++)
+				taps[i] = (float)(taps[i] / sum);
+		}
+		return k;
+	}();
+	return kernel.data();
+}
+
+void APU::add_step(int side, H_QWORD time, int delta)
+{
+	if (delta == 0)
+		return;
+
+	H_QWORD pos = time >> _APU_NATIVE_SHIFT;
+	if (pos < m_read_pos)
+		pos = m_read_pos;
+	int phase = (int)(time & ((1 << _APU_NATIVE_SHIFT) - 1)) * _APU_BLEP_PHASES >> _APU_NATIVE_SHIFT;
+
+	size_t index = (size_t)(pos - m_read_pos);
+	std::vector<float>& steps = m_steps[side];
+	if (steps.size() < index + _APU_BLEP_TAPS)
+		steps.resize(index + _APU_BLEP_TAPS, 0.0f);
+
+	const float* taps = blep_kernel() + phase * _APU_BLEP_TAPS;
+	float* out = &steps[index];
+	for (int i = 0; i < _APU_BLEP_TAPS; i++)
+		out[i] += delta * taps[i];
+}
+
+void APU::flush()
+{
+	// Samples before current time can't get any more steps
+	size_t count = (size_t)((m_s.time >> _APU_NATIVE_SHIFT) - m_read_pos);
+	if (count == 0)
+		return;
+
+	for (int side = 0; side < 2; side++)
+	{
+		std::vector<float>& steps = m_steps[side];
+		if (steps.size() < count)
+			steps.resize(count, 0.0f);
+
+		std::vector<float>& native = m_native[side];
+		native.resize(count);
+		for (size_t i = 0; i < count; i++)
+		{
+			m_sum[side] += steps[i];
+
+			// One pole high-pass at a few Hz
+			float y = m_sum[side] - m_last[side] + 0.9997f * m_dc[side];
+			m_last[side] = m_sum[side];
+			m_dc[side]   = y;
+
+			native[i] = y * 64.0f;
+		}
+
+		steps.erase(steps.begin(), steps.begin() + count);
+	}
+
+	m_resampler.write(m_native[0].data(), m_native[1].data(), count);
+	if (m_tap_on)
+		m_tap.write(m_native[0].data(), m_native[1].data(), count);
+	m_read_pos += count;
+}
+
+size_t APU::available()
+{
+	catch_up();
+	if (m_rate == 0)
+		return 0;
+
+	flush();
+	size_t count = m_resampler.available();
+
+	// Nobody takes samples, old ones are dropped so buffer doesn't grow forever
+	size_t limit = (size_t)m_rate * _APU_BUFFER_SECONDS;
+	if (count > limit)
+	{
+		std::vector<H_S_WORD> scratch((count - limit / 2) * 2);
+		m_resampler.read(scratch.data(), count - limit / 2);
+		count = m_resampler.available();
+	}
+	return count;
+}
+
+size_t APU::read_samples(H_S_WORD* out, size_t count)
+{
+	catch_up();
+	if (m_rate == 0)
+		return 0;
+
+	flush();
+	return m_resampler.read(out, count);
+}
+
+void APU::set_tap(bool on)
+{
+	if (on == m_tap_on)
+		return;
+
+	// Starts from samples made after this, like a device opened now would
+	catch_up();
+	flush();
+	m_tap.clear();
+	m_tap_on = on;
+}
+
+size_t APU::read_tap(H_S_WORD* out, size_t count)
+{
+	if (!m_tap_on || m_rate == 0)
+		return 0;
+
+	catch_up();
+	flush();
+	return m_tap.read(out, count);
+}
+
+void APU::save_state(STATE& s) const
+{
+	s = m_s;
+}
+
+void APU::load_state(const STATE& s)
+{
+	m_s = s;
+
+	for (int ch = 0; ch < 4; ch++)
+		m_level[ch] = channel_level(ch);
+
+	// Levels are set without steps, output continues from restored point
+	int rate = m_rate;
+	m_rate = 0;
+	update_mix(m_s.time);
+	m_rate = rate;
+	reset_output();
+}
\ No newline at end of file
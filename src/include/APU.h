@@ -0,0 +1,174 @@
+#pragma once
+#define _APU_SEQUENCER_PERIOD 8192 // Frame sequencer runs at 512 Hz
+#define _APU_BUFFER_SECONDS   1    // Output not taken for this long is dropped
+#define _APU_NATIVE_SHIFT     6    // Steps are synthesized at CLOCKSPEED >> 6 = 65536 Hz
+#define _APU_BLEP_PHASES      32   // Step positions between native samples, 2 cycles apart
+#define _APU_BLEP_TAPS        16
+
+#include "core.h"
+#include "CPUZ80.h"
+#include "Resampler.h"
+
+#include <vector>
+
+class GameBoy;
+
+/*
+	Audio Processing Unit
+
+	Four channels mixed into stereo output
+		1. Square with frequency sweep   NR10-NR14 $FF10-$FF14
+		2. Square                        NR21-NR24 $FF16-$FF19
+		3. Wave from 32 4-bit samples    NR30-NR34 $FF1A-$FF1E, wave RAM $FF30-$FF3F
+		4. Noise from 15-bit LFSR        NR41-NR44 $FF20-$FF23
+	Master volume and panning        NR50-NR52 $FF24-$FF26
+
+	Frame sequencer ticks at 512 Hz and clocks
+		Step   0 1 2 3 4 5 6 7
+		Length x   x   x   x
+		Sweep      x       x
+		Volume               x
+
+	APU is not clocked by CPU. It remembers up to which cycle it has been emulated
+	and catches up only when CPU writes one of its registers, reads NR52 or
+	output samples are taken. Catching up walks from one timer event to the next
+	instead of cycle by cycle, and every time a channel changes its level
+	a step is added to the output buffer. Cycles are CPUZ80::dot_count, which
+	doesn't go twice as fast in CGB double speed.
+
+	While output is off timers are just fast forwarded, so emulation that
+	doesn't play sound pays only for register accesses.
+
+	Output is made in two stages
+		1. Every level change is added to 65536 Hz buffer as band-limited step,
+		   a windowed-sinc impulse placed at its exact cycle and integrated
+		   when read. Cost depends on number of changes, not on cycles, and
+		   square waves don't alias.
+		2. Resampler converts 65536 Hz to output rate of the host.
+*/
+class APU
+{
+public:
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	void reset();
+
+	void write(H_WORD, H_BYTE);	// CPU writes $FF10-$FF3F
+	void read_status();			// CPU is about to read NR52
+
+	// Output is stereo 16-bit at given rate. 0 turns output off
+	void set_sample_rate(int);
+	inline int sample_rate() const { return m_rate; }
+	inline Resampler& resampler() { return m_resampler; }
+
+	// Emulates up to current cycle and returns how many stereo frames can be read
+	size_t available();
+	// Reads up to count stereo frames, returns how many were read
+	size_t read_samples(H_S_WORD* out, size_t count);
+
+	// Second output at the same rate that rate control never adjusts, for recording.
+	// Made only while on, and has to be read as often as read_samples is
+	void   set_tap(bool);
+	size_t read_tap(H_S_WORD* out, size_t count);
+
+	// Everything APU needs to continue emulation from the same point
+	struct LENGTH
+	{
+		H_WORD counter = 0;
+		bool   enabled = false;
+	};
+	struct ENVELOPE
+	{
+		H_BYTE volume = 0;
+		H_BYTE period = 0;
+		H_BYTE timer  = 0;
+		bool   add    = false;
+	};
+	struct SQUARE
+	{
+		bool     on = false, dac = false;
+		H_BYTE   duty = 0, pos = 0;
+		H_WORD   freq = 0;
+		H_DWORD  timer = 0; // Cycles until next duty step
+		LENGTH   length;
+		ENVELOPE envelope;
+
+		// Channel 1 only
+		H_BYTE sweep_period = 0, sweep_shift = 0, sweep_timer = 0;
+		bool   sweep_negate = false, sweep_enabled = false;
+		H_WORD shadow = 0;
+	};
+	struct WAVE
+	{
+		bool    on = false, dac = false;
+		H_BYTE  pos = 0, shift = 4;	// Volume as right shift of sample, 4 is mute
+		H_WORD  freq = 0;
+		H_DWORD timer = 0;
+		LENGTH  length;
+	};
+	struct NOISE
+	{
+		bool     on = false, dac = false;
+		H_WORD   lfsr = 0x7FFF;
+		H_DWORD  period = 8;
+		bool     width7 = false;
+		H_DWORD  timer = 0;
+		LENGTH   length;
+		ENVELOPE envelope;
+	};
+	struct STATE
+	{
+		H_QWORD time = 0;		// Cycle APU is emulated up to
+		H_QWORD sequencer = 0;	// Cycle of next frame sequencer tick
+		H_BYTE  step = 0;		// Frame sequencer step
+		bool    power = false;
+		H_BYTE  regs[0x30] = {};// Last written values of $FF10-$FF3F
+		SQUARE  square[2];
+		WAVE    wave;
+		NOISE   noise;
+	};
+	void save_state(STATE&) const;
+	void load_state(const STATE&);
+
+private:
+	GameBoy* gb = nullptr;
+	STATE    m_s;
+
+	// Catching up
+	void catch_up();
+	void run_square(int, H_QWORD);
+	void run_wave(H_QWORD);
+	void run_noise(H_QWORD);
+	void sequencer_tick();
+
+	void trigger(int);
+	void clock_length(LENGTH&, bool& on);
+	void clock_envelope(ENVELOPE&);
+	void clock_sweep();
+	H_WORD sweep_frequency();	// Next frequency of channel 1, disables channel on overflow
+
+	// Mixing. Levels of channels and both sides are kept so only changes are added to buffer
+	int  m_level[4] = {};
+	int  m_out[2]   = {};
+	int  channel_level(int) const;
+	void update_level(int, H_QWORD);
+	void update_mix(H_QWORD);
+
+	// Native rate buffer. Holds impulses of band-limited steps, integrated when moved to resampler
+	int                m_rate = 0;
+	H_QWORD            m_read_pos = 0;			// Absolute index of first native sample in buffer
+	std::vector<float> m_steps[2];
+	std::vector<float> m_native[2];				// Integrated samples on their way to resampler
+	float              m_sum[2]  = {};			// Running sums of already read steps
+	float              m_dc[2]   = {};			// High-pass filter state, removes DC like hardware does
+	float              m_last[2] = {};
+	Resampler          m_resampler;
+	Resampler          m_tap;
+	bool               m_tap_on = false;
+
+	static const float* blep_kernel();			// _APU_BLEP_PHASES x _APU_BLEP_TAPS impulses
+
+	void add_step(int side, H_QWORD time, int delta);
+	void flush();								// Moves finished native samples to resampler
+	void reset_output();
+};
\ No newline at end of file
@@ -0,0 +1,467 @@
+#include "Archive.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+#define _ARCHIVE_FAST_BITS 10 // Huffman codes up to this long take one lookup
+
+static inline H_DWORD read16(const H_BYTE* p) { return p[0] | (p[1] << 8); }
+static inline H_DWORD read32(const H_BYTE* p) { return p[0] | (p[1] << 8) | (p[2] << 16) | ((H_DWORD)p[3] << 24); }
+
+// LSB first bit reader. Past the end of input it reads zeros and counts them
+struct BITS
+{
+	const H_BYTE* p;
+	const H_BYTE* end;
+	H_QWORD buffer = 0;
+	int     count  = 0;	// Valid bits in buffer
+	int     padded = 0;	// Zero bytes added after end
+
+	BITS(const H_BYTE* in, size_t size) : p(in), end(in + size) {}
+
+	inline void fill(int n)
+	{
+		if (count >= n)
+			return;
+		if (end - p >= 8)
+		{
+			// Whole word at once. Bytes above count that are already in buffer are the same ones again
+			H_QWORD v;
+			std::memcpy(&v, p, 8);
+			buffer |= v << count;
+			p += (63 - count) >> 3;
+			count |= 56;
+		}
+		else
+			while (count < n)
+			{
+				H_QWORD v = 0;
+				if (p < end)
+					v = *p++;
+				else
+					padded++;
+				buffer |= v << count;
+				count += 8;
+			}
+	}
+	inline H_DWORD peek(int n) { fill(n); return (H_DWORD)(buffer & ((1ull << n) - 1)); }
+	inline void    skip(int n) { buffer >>= n; count -= n; }
+	inline H_DWORD get(int n)  { if (n == 0) return 0; H_DWORD v = peek(n); skip(n); return v; }
+
+	// Some of the added zeros were used
+	inline bool overrun() const { return count < padded * 8; }
+};
+
+// Canonical Huffman code
+struct HUFFMAN
+{
+	H_WORD fast[1 << _ARCHIVE_FAST_BITS];	// symbol << 4 | length, 0 if code is longer
+	H_WORD count[16];						// Codes of every length
+	H_WORD symbol[288];						// In code order
+};
+
+static bool build(HUFFMAN& h, const H_BYTE* lengths, int n)
+{
+	std::memset(h.count, 0, sizeof(h.count));
+	for (int i = 0; i < n; i++)
+		h.count[lengths[i]]++;
+	h.count[0] = 0;
+
+	// Too many codes is an error, too few is allowed for single distance code
+	int left = 1;
+	for (int len = 1; len < 16; len++)
+	{
+		left = (left << 1) - h.count[len];
+		if (left < 0)
+			return false;
+	}
+
+	H_WORD offset[16], next[16];
+	offset[1] = 0;
+	next[1] = 0;
+	for (int len = 1; len < 15; len++)
+	{
+		offset[len + 1] = offset[len] + h.count[len];
+		next[len + 1] = (next[len] + h.count[len]) << 1;
+	}
+
+	std::memset(h.fast, 0, sizeof(h.fast));
+	for (int i = 0; i < n; i++)
+	{
+		int len = lengths[i];
+		if (len == 0)
+			continue;
+		h.symbol[offset[len]++] = (H_WORD)i;
+
+		// Codes are stored from their first bit, table is indexed by reversed code
+		int code = next[len]++;
+		if (len > _ARCHIVE_FAST_BITS)
+			continue;
+		int reversed = 0;
+		for (int b = 0; b < len; b++)
+			reversed |= ((code >> b) & 1) << (len - 1 - b);
+		for (int j = reversed; j < (1 << _ARCHIVE_FAST_BITS); j += 1 << len)
+			h.fast[j] = (H_WORD)((i << 4) | len);
+	}
+	return true;
+}
+
+static inline int decode(BITS& b, const HUFFMAN& h)
+{
+	H_WORD e = h.fast[b.peek(_ARCHIVE_FAST_BITS)];
+	if (e != 0)
+	{
+		b.skip(e & 0x0F);
+		return e >> 4;
+	}
+
+	// Longer code, one bit at a time
+	int code = 0, first = 0, index = 0;
+	for (int len = 1; len < 16; len++)
+	{
+		code |= b.get(1);
+		int count = h.count[len];
+		if (code - count < first)
+			return h.symbol[index + (code - first)];
+		index += count;
+		first = (first + count) << 1;
+		code <<= 1;
+	}
+	return -1;
+}
+
+static bool codes(BITS& b, const HUFFMAN& lit, const HUFFMAN& dist, H_BYTE* out, H_BYTE*& o, H_BYTE* out_end)
+{
+	static const H_WORD length_base[29]  = { 3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const H_BYTE length_extra[29] = { 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const H_WORD dist_base[30]    = { 1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+	static const H_BYTE dist_extra[30]   = { 0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	for (;;)
+	{
+		int symbol = decode(b, lit);
+		if (symbol < 0 || b.overrun())
+			return false;
+
+		if (symbol < 256)
+		{
+			if (o == out_end)
+				return false;
+			*o++ = (H_BYTE)symbol;
+		}
+		else if (symbol == 256)
+			return true;
+		else
+		{
+			symbol -= 257;
+			if (symbol >= 29)
+				return false;
+			size_t length = length_base[symbol] + b.get(length_extra[symbol]);
+
+			symbol = decode(b, dist);
+			if (symbol < 0 || symbol >= 30)
+				return false;
+			size_t distance = dist_base[symbol] + b.get(dist_extra[symbol]);
+
+			if (distance > (size_t)(o - out) || length > (size_t)(out_end - o))
+				return false;
+
+			// Overlapping copy repeats last distance bytes. Every chunk doubles the pattern
+			// that is already there, so it is copied in large pieces even for short distances
+			const H_BYTE* from = o - distance;
+			for (size_t done = 0; done < length;)
+			{
+				size_t n = std::min(length - done, distance + done);
+				std::memcpy(o + done, from, n);
+				done += n;
+			}
+			o += length;
+		}
+	}
+}
+
+bool Archive::inflate(const H_BYTE* in, size_t in_size, H_BYTE* out, size_t out_size)
+{
+	BITS b(in, in_size);
+	H_BYTE* o = out;
+	H_BYTE* out_end = out + out_size;
+
+	// Fixed codes of block type 1
+	static const struct FIXED
+	{
+		HUFFMAN lit, dist;
+		FIXED()
+		{
+			H_BYTE lengths[288];
+			std::fill(lengths, lengths + 144, 8);
+			std::fill(lengths + 144, lengths + 256, 9);
+			std::fill(lengths + 256, lengths + 280, 7);
+			std::fill(lengths + 280, lengths + 288, 8);
+			build(lit, lengths, 288);
+			std::fill(lengths, lengths + 30, 5);
+			build(dist, lengths, 30);
+		}
+	} fixed;
+
+	bool last = false;
+	while (!last)
+	{
+		last = b.get(1) != 0;
+		int type = b.get(2);
+		if (b.overrun())
+			return false;
+
+		if (type == 0)
+		{
+			// Stored. Starts at byte boundary, part of it may be in bit buffer already
+			b.skip(b.count & 7);
+			size_t length = b.get(16);
+			size_t inverse = b.get(16);
+			if (length != (~inverse & 0xFFFF) || length > (size_t)(out_end - o) || b.overrun())
+				return false;
+
+			for (; length > 0 && b.count >= 8; length--)
+				*o++ = (H_BYTE)b.get(8);
+			if (length > 0)
+			{
+				if (length > (size_t)(b.end - b.p))
+					return false;
+				std::memcpy(o, b.p, length);
+				o += length;
+				b.p += length;
+				b.buffer = 0;
+			}
+		}
+		else if (type == 1)
+		{
+			if (!codes(b, fixed.lit, fixed.dist, out, o, out_end))
+				return false;
+		}
+		else if (type == 2)
+		{
+			int lit_count  = b.get(5) + 257;
+			int dist_count = b.get(5) + 1;
+			int code_count = b.get(4) + 4;
+			if (lit_count > 286 || dist_count > 30)
+				return false;
+
+			// Code lengths are Huffman coded too
+			static const H_BYTE order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+			H_BYTE lengths[286 + 30] = { 0 };
+			for (int i = 0; i < code_count; i++)
+				lengths[order[i]] = (H_BYTE)b.get(3);
+
+			HUFFMAN lit, dist;
+			if (!build(lit, lengths, 19))
+				return false;
+
+			int total = lit_count + dist_count;
+			for (int i = 0; i < total;)
+			{
+				int symbol = decode(b, lit);
+				if (symbol < 0 || b.overrun())
+					return false;
+
+				if (symbol < 16)
+				{
+					lengths[i++] = (H_BYTE)symbol;
+					continue;
+				}
+
+				H_BYTE length = 0;
+				int repeat;
+				if (symbol == 16)
+				{
+					if (i == 0)
+						return false;
+					length = lengths[i - 1];
+					repeat = 3 + b.get(2);
+				}
+				else if (symbol == 17)
+					repeat = 3 + b.get(3);
+				else
+					repeat = 11 + b.get(7);
+
+				if (i + repeat > total)
+					return false;
+				while (repeat-- > 0)
+					lengths[i++] = length;
+			}
+
+			// End of block has to have a code
+			if (lengths[256] == 0 || !build(lit, lengths, lit_count) || !build(dist, lengths + lit_count, dist_count))
+				return false;
+			if (!codes(b, lit, dist, out, o, out_end))
+				return false;
+		}
+		else
+			return false;
+	}
+	return o == out_end && !b.overrun();
+}
+
+H_DWORD Archive::crc32(const H_BYTE* data, size_t size, H_DWORD crc)
+{
+	// Slicing by 8, t[k] is CRC of byte followed by k zero bytes
+	static const struct TABLE
+	{
+		H_DWORD t[8][256];
+		TABLE()
+		{
+			for (H_DWORD i = 0; i < 256; i++)
+			{
+				H_DWORD c = i;
+				for (int k = 0; k < 8; k++)
+					c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+				t[0][i] = c;
+			}
+			for (int k = 1; k < 8; k++)
+				for (int i = 0; i < 256; i++)
+					t[k][i] = (t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF];
+		}
+	} table;
+	const H_DWORD (*t)[256] = table.t;
+
+	crc = ~crc;
+	for (; size >= 8; data += 8, size -= 8)
+	{
+		H_DWORD one = read32(data) ^ crc;
+		H_DWORD two = read32(data + 4);
+		crc = t[7][one & 0xFF] ^ t[6][(one >> 8) & 0xFF] ^ t[5][(one >> 16) & 0xFF] ^ t[4][one >> 24]
+			^ t[3][two & 0xFF] ^ t[2][(two >> 8) & 0xFF] ^ t[1][(two >> 16) & 0xFF] ^ t[0][two >> 24];
+	}
+	for (; size > 0; data++, size--)
+		crc = t[0][(crc ^ *data) & 0xFF] ^ (crc >> 8);
+	return ~crc;
+}
+
+Archive::FORMAT Archive::detect(const H_BYTE* file, size_t size)
+{
+	if (size >= 2 && file[0] == 0x1F && file[1] == 0x8B)
+		return FORMAT_GZIP;
+	if (size >= 4 && read32(file) == 0x04034B50)
+		return FORMAT_ZIP;
+	return FORMAT_NONE;
+}
+
+bool Archive::rom_name(const std::string& name)
+{
+	size_t dot = name.find_last_of('.');
+	if (dot == std::string::npos)
+		return false;
+	std::string extension = name.substr(dot);
+	for (char& c : extension)
+		c = (char)std::tolower((unsigned char)c);
+	return extension == ".gb" || extension == ".gbc" || extension == ".sgb";
+}
+
+bool Archive::locate(const H_BYTE* file, size_t size, ITEM& item)
+{
+	item = ITEM();
+	item.format = detect(file, size);
+
+	if (item.format == FORMAT_GZIP)
+	{
+		// Header fields before data depend on flags
+		if (size < 18 || file[2] != 8)
+			return false;
+		H_BYTE flags = file[3];
+		size_t p = 10;
+		if (flags & 0x04) // Extra field
+			p += 2 + (p + 2 <= size ? read16(file + p) : 0);
+		if (flags & 0x08) // Name
+			while (p < size && file[p++] != 0);
+		if (flags & 0x10) // Comment
+			while (p < size && file[p++] != 0);
+		if (flags & 0x02) // Header CRC
+			p += 2;
+		if (p + 8 > size)
+			return false;
+
+		item.data   = file + p;
+		item.packed = size - 8 - p;
+		item.crc    = read32(file + size - 8);
+		item.size   = read32(file + size - 4);
+		return true;
+	}
+
+	if (item.format == FORMAT_ZIP)
+	{
+		// End of central directory record is in the last 64kB, comment can be that long
+		if (size < 22)
+			return false;
+		size_t eocd = size - 22;
+		size_t lowest = size > 0xFFFF + 22 ? size - 0xFFFF - 22 : 0;
+		while (read32(file + eocd) != 0x06054B50)
+		{
+			if (eocd == lowest)
+				return false;
+			eocd--;
+		}
+
+		size_t entries   = read16(file + eocd + 10);
+		size_t directory = read32(file + eocd + 16);
+		size_t chosen    = size;
+		const H_BYTE* p  = file + directory;
+		for (size_t i = 0; i < entries; i++)
+		{
+			if (p + 46 > file + eocd || read32(p) != 0x02014B50)
+				return false;
+			size_t name_length = read16(p + 28);
+			size_t next = 46 + name_length + read16(p + 30) + read16(p + 32);
+			if (p + next > file + eocd)
+				return false;
+
+			std::string name((const char*)p + 46, name_length);
+			bool better = chosen == size || (!rom_name(item.name) && rom_name(name));
+			if (!name.empty() && name.back() != '/' && better)
+			{
+				chosen = p - file;
+				item.name = name;
+			}
+			p += next;
+		}
+		if (chosen == size)
+			return false;
+
+		const H_BYTE* entry = file + chosen;
+		H_DWORD flags  = read16(entry + 8);
+		H_DWORD method = read16(entry + 10);
+		if ((flags & 0x01) || (method != 0 && method != 8))
+			return false; // Encrypted or compressed some other way
+
+		item.deflated = method == 8;
+		item.crc      = read32(entry + 16);
+		item.packed   = read32(entry + 20);
+		item.size     = read32(entry + 24);
+
+		// Local header repeats name and may have its own extra field
+		size_t local = read32(entry + 42);
+		if (local + 30 > size || read32(file + local) != 0x04034B50)
+			return false;
+		size_t data = local + 30 + read16(file + local + 26) + read16(file + local + 28);
+		if (data > size || item.packed > size - data)
+			return false;
+		item.data = file + data;
+		return true;
+	}
+
+	return false;
+}
+
+bool Archive::extract(const ITEM& item, H_BYTE* out)
+{
+	if (item.deflated)
+	{
+		if (!inflate(item.data, item.packed, out, item.size))
+			return false;
+	}
+	else
+	{
+		if (item.packed != item.size)
+			return false;
+		std::memcpy(out, item.data, item.size);
+	}
+	return crc32(out, item.size) == item.crc;
+}
\ No newline at end of file
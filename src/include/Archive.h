@@ -0,0 +1,57 @@
+#pragma once
+#include "core.h"
+
+#include <cstddef>
+#include <string>
+
+/*
+	Archive
+
+	Finds ROM inside gzip or zip file and unpacks it. Archive is read in place,
+	from memory mapped file, and output goes straight into buffer of its final
+	size, which both formats store before or after compressed data
+		gzip - one member, size and CRC32 are in the last 8 bytes
+		zip  - central directory at the end lists files, first one with .gb, .gbc
+		       or .sgb extension is taken, or the first file if there is none.
+		       Stored and deflated files, no ZIP64 or encryption
+
+	Inflate follows RFC 1951. Huffman codes up to 10 bits, nearly all symbols of
+	a ROM, are decoded with one table lookup, longer ones bit by bit. Back
+	references copy from output, which holds everything unpacked so far, so no
+	separate window is needed. Result is checked against CRC32 of the archive.
+*/
+class Archive
+{
+public:
+	enum FORMAT
+	{
+		FORMAT_NONE = 0, FORMAT_GZIP, FORMAT_ZIP
+	};
+
+	struct ITEM
+	{
+		FORMAT        format = FORMAT_NONE;
+		const H_BYTE* data   = nullptr;	// Compressed stream
+		size_t        packed = 0;
+		size_t        size   = 0;		// Unpacked
+		H_DWORD       crc    = 0;
+		bool          deflated = true;	// False if stored
+		std::string   name;				// File name in zip, empty for gzip
+	};
+
+	static FORMAT detect(const H_BYTE*, size_t);
+
+	// Finds ROM in archive. False if there is none or archive is damaged
+	static bool locate(const H_BYTE* file, size_t size, ITEM&);
+
+	// Unpacks exactly item.size bytes to out. False if data or CRC is wrong
+	static bool extract(const ITEM&, H_BYTE* out);
+
+	// Raw deflate stream to buffer that has to be filled exactly
+	static bool inflate(const H_BYTE* in, size_t in_size, H_BYTE* out, size_t out_size);
+
+	static H_DWORD crc32(const H_BYTE*, size_t, H_DWORD crc = 0);
+
+	// Name has .gb, .gbc or .sgb extension
+	static bool rom_name(const std::string&);
+};
\ No newline at end of file
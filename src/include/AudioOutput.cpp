@@ -0,0 +1,121 @@
+#include "AudioOutput.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+
+AudioOutput::~AudioOutput()
+{
+	close();
+}
+
+bool AudioOutput::open(int rate)
+{
+	if (m_device != 0)
+		return true;
+
+	if (SDL_InitSubSystem(SDL_INIT_AUDIO) != 0)
+	{
+		std::cerr << "SDL audio init failure: " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	SDL_AudioSpec want = {}, have = {};
+	want.freq     = rate;
+	want.format   = AUDIO_S16SYS;
+	want.channels = 2;
+	want.samples  = 512;
+	want.callback = callback;
+	want.userdata = this;
+
+	// Format and channels are converted by SDL if device wants others, rate is handled here
+	m_device = SDL_OpenAudioDevice(nullptr, 0, &want, &have, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE);
+	if (m_device == 0)
+	{
+		std::cerr << "Audio device open failure: " << SDL_GetError() << std::endl;
+		return false;
+	}
+
+	// Device pulls whole buffers, level has to stay above one of them
+	m_target = std::max<size_t>((size_t)have.freq * _AUDIO_LATENCY_MS / 1000, have.samples * 2);
+	m_target = std::min<size_t>(m_target, _AUDIO_RING_FRAMES / 2);
+	m_fill   = (double)m_target;
+	m_adjust = 0.0;
+	m_paused = true;
+	m_priming = false;
+
+	gb->apu.set_sample_rate(have.freq);
+	return true;
+}
+
+void AudioOutput::close()
+{
+	if (m_device == 0)
+		return;
+
+	SDL_CloseAudioDevice(m_device);
+	m_device = 0;
+	gb->apu.set_sample_rate(0);
+}
+
+void AudioOutput::pause(bool paused)
+{
+	if (m_device == 0 || paused == m_paused)
+		return;
+
+	// Device starts only when ring is filled up to target, see update
+	m_paused  = paused;
+	m_priming = !paused;
+	if (paused)
+		SDL_PauseAudioDevice(m_device, 1);
+}
+
+void AudioOutput::update()
+{
+	if (m_device == 0)
+		return;
+
+	// Rate control changes how many samples a frame makes, so recording takes them from
+	// the tap at fixed ratio and stays as long as the video
+	size_t recorded;
+	H_S_WORD tap[1024 * 2];
+	while ((recorded = gb->apu.read_tap(tap, 1024)) != 0)
+		gb->recorder.samples(tap, recorded);
+
+	// Everything APU made goes to ring, what doesn't fit is lost
+	size_t count = gb->apu.available();
+	m_scratch.resize(count * 2);
+	count = gb->apu.read_samples(m_scratch.data(), count);
+	size_t pushed = m_ring.push(m_scratch.data(), count * 2) / 2;
+	m_overruns += count - pushed;
+
+	// Starting at target level, rate control doesn't need seconds to get there
+	if (m_priming)
+	{
+		if (buffered() < m_target)
+			return;
+		m_priming = false;
+		m_fill = (double)buffered();
+		SDL_PauseAudioDevice(m_device, 0);
+	}
+
+	// Ring above target means device is slower than emulation, less is made and the other way round
+	m_fill += ((double)buffered() - m_fill) * 0.1;
+	double error = std::max(-1.0, std::min(1.0, (m_fill - m_target) / m_target));
+	m_adjust = -_AUDIO_MAX_ADJUST * error;
+	gb->apu.resampler().set_adjust(m_adjust);
+}
+
+void AudioOutput::callback(void* userdata, Uint8* stream, int len)
+{
+	AudioOutput* self = (AudioOutput*)userdata;
+
+	H_S_WORD* out = (H_S_WORD*)stream;
+	size_t    count = (size_t)len / sizeof(H_S_WORD);
+	size_t    got = self->m_ring.pop(out, count);
+
+	if (got < count)
+	{
+		std::fill(out + got, out + count, 0);
+		self->m_underruns.fetch_add(1, std::memory_order_relaxed);
+	}
+}
\ No newline at end of file
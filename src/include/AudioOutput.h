@@ -0,0 +1,70 @@
+#pragma once
+#define _AUDIO_RING_FRAMES 8192  // Stereo frames between emulation and device, power of two
+#define _AUDIO_LATENCY_MS  50    // Fill level rate control keeps the ring at
+#define _AUDIO_MAX_ADJUST  0.005 // Largest change of output rate, 0.5% is not heard as pitch
+
+#include "core.h"
+#include "SPSCQueue.h"
+
+#include <SDL.h>
+
+#include <atomic>
+#include <vector>
+
+class GameBoy;
+
+/*
+	Audio Output
+
+	Hands APU samples to SDL audio device. Emulation thread pushes samples
+	into a lock-free ring after every frame and SDL callback pops them on
+	its own thread, neither side ever waits for the other. Callback fills
+	what ring can't give with silence and counts it as underrun.
+
+	Emulation is paced by frames and device by its own clock, they never
+	agree exactly, so a fixed ratio would slowly drain or overflow the ring.
+	Rate control watches the fill level and nudges resampler ratio up to
+	_AUDIO_MAX_ADJUST to keep the ring at _AUDIO_LATENCY_MS. Latency stays
+	low and steady, and a stalled frame only dips the level for a moment.
+	Recorder gets samples from APU tap instead, which rate control doesn't
+	touch, so recorded sound keeps its nominal rate and stays in step with video.
+*/
+class AudioOutput
+{
+public:
+	~AudioOutput();
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	// Opens default device and switches APU to rate device accepted
+	bool open(int rate);
+	void close();
+	inline bool opened() const { return m_device != 0; }
+
+	void pause(bool);	// Device plays silence while emulation is paused
+	void update();		// Emulation thread, after every frame
+
+	inline size_t  buffered()  const { return m_ring.size() / 2; }	// Frames waiting for device
+	inline size_t  target()    const { return m_target; }
+	inline double  adjust()    const { return m_adjust; }
+	inline H_QWORD underruns() const { return m_underruns.load(std::memory_order_relaxed); }
+	inline H_QWORD overruns()  const { return m_overruns; }			// Frames dropped on full ring
+
+private:
+	static void callback(void*, Uint8*, int);
+
+	GameBoy* gb = nullptr;
+
+	SDL_AudioDeviceID m_device = 0;
+	bool              m_paused  = true;
+	bool              m_priming = false;	// Unpaused, waiting for ring to fill
+	size_t            m_target = 0;		// Fill level in frames
+	double            m_fill   = 0.0;	// Smoothed fill level, single frame reads jump by device buffer size
+	double            m_adjust = 0.0;
+
+	std::atomic<H_QWORD>  m_underruns{ 0 };
+	H_QWORD               m_overruns = 0;
+	std::vector<H_S_WORD> m_scratch;
+
+	SPSCQueue<H_S_WORD, _AUDIO_RING_FRAMES * 2> m_ring;	// Interleaved left, right
+};
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "CGB.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+#include <cstring>
+
+void CGB::connect_device(GameBoy* instance)
+{
+	gb = instance;
+	m_window_vram = &gb->m_memory[0x8000];
+}
+
+void CGB::load(const Cartridge& cartridge)
+{
+	m_s = STATE();
+	m_s.enabled = (cartridge.header.cgb & 0x80) != 0;
+	gb->tiles.set_bank(0);
+}
+
+void CGB::reset()
+{
+	if (!m_s.enabled)
+		return;
+
+	m_s = STATE();
+	m_s.enabled = true;
+	m_s.vram.assign(0x4000, 0x00);
+	m_s.wram.assign(0x8000, 0x00);
+	gb->tiles.set_bank(0);
+
+	// Boot ROM leaves every BG color white
+	for (int i = 0; i < 64; i += 2)
+	{
+		m_s.bg_palette[i]     = 0xFF;
+		m_s.bg_palette[i + 1] = 0x7F;
+	}
+	for (int i = 0; i < 64; i++)
+	{
+		update_color(false, i);
+		update_color(true, i);
+	}
+
+	gb->m_memory[0xFF4D] = 0x7E;
+	gb->m_memory[0xFF68] = 0xC0;
+	gb->m_memory[0xFF6A] = 0xC0;
+	for (H_WORD addr = 0xFF51; addr <= 0xFF54; addr++)
+		gb->m_memory[addr] = 0xFF;
+	update_registers();
+}
+
+void CGB::write(H_WORD addr, H_BYTE data)
+{
+	H_BYTE* io = &gb->m_memory[0xFF00];
+
+	switch (addr)
+	{
+	case 0xFF4D: io[0x4D] = (io[0x4D] & 0x80) | 0x7E | (data & 0x01); break;
+	case 0xFF4F: map_vram(data & 0x01); break;
+	case 0xFF51: m_s.hdma_src = (m_s.hdma_src & 0x00FF) | (data << 8); break;
+	case 0xFF52: m_s.hdma_src = (m_s.hdma_src & 0xFF00) | (data & 0xF0); break;
+	case 0xFF53: m_s.hdma_dst = 0x8000 | ((data & 0x1F) << 8) | (m_s.hdma_dst & 0x00F0); break;
+	case 0xFF54: m_s.hdma_dst = (m_s.hdma_dst & 0xFF00) | (data & 0xF0); break;
+	case 0xFF55:
+		if (m_s.hdma_active && !(data & 0x80))
+			m_s.hdma_active = false; // Stopped, remaining blocks stay readable
+		else if (data & 0x80)
+		{
+			m_s.hdma_active = true;
+			m_s.hdma_blocks = (data & 0x7F) + 1;
+		}
+		else
+		{
+			copy((data & 0x7F) + 1);
+			m_s.hdma_blocks = 0;
+		}
+		break;
+	case 0xFF68:
+	case 0xFF6A:
+		io[addr & 0xFF] = data | 0x40;
+		break;
+	case 0xFF69:
+	case 0xFF6B:
+	{
+		bool obj = addr == 0xFF6B;
+		H_BYTE& index = io[obj ? 0x6A : 0x68];
+		int i = index & 0x3F;
+
+		(obj ? m_s.obj_palette : m_s.bg_palette)[i] = data;
+		update_color(obj, i);
+		if (index & 0x80)
+			index = (index & 0xC0) | ((i + 1) & 0x3F);
+		break;
+	}
+	case 0xFF70: map_wram(std::max(data & 0x07, 1)); break;
+	default:
+		return;
+	}
+	update_registers();
+}
+
+bool CGB::speed_switch()
+{
+	if (!m_s.enabled || !(gb->m_memory[0xFF4D] & 0x01))
+		return false;
+
+	gb->cpu.set_double_speed(!gb->cpu.double_speed);
+	gb->m_memory[0xFF04] = 0x00; // DIV is reset by STOP
+	update_registers();
+	return true;
+}
+
+void CGB::hblank()
+{
+	copy(1);
+	if (--m_s.hdma_blocks == 0)
+		m_s.hdma_active = false;
+	update_registers();
+}
+
+void CGB::copy(H_BYTE blocks)
+{
+	// Destination doesn't leave VRAM, transfer ends at its end. Source wraps at FFFF
+	size_t size = std::min<size_t>((size_t)blocks * 16, 0xA000 - m_s.hdma_dst);
+
+	for (size_t done = 0; done < size;)
+	{
+		H_WORD  src = (H_WORD)(m_s.hdma_src + done);
+		H_BYTE* dst = &gb->m_memory[m_s.hdma_dst + done];
+		size_t  run = std::min<size_t>(size - done, 0x2000 - (src & 0x1FFF));
+		if ((src & 0xE000) == 0x8000)
+			std::memset(dst, 0xFF, run);
+		else
+			std::memmove(dst, &gb->m_memory[src >= 0xE000 ? src - 0x4000 : src], run);
+		done += run;
+	}
+	gb->tiles.invalidate(m_s.hdma_dst, (H_WORD)(m_s.hdma_dst + size - 1));
+
+	m_s.hdma_src = (H_WORD)(m_s.hdma_src + size);
+	m_s.hdma_dst = (H_WORD)(m_s.hdma_dst + size);
+	if (m_s.hdma_dst >= 0xA000)
+	{
+		m_s.hdma_dst = 0x8000;
+		m_s.hdma_blocks = 1; // Last one, caller counts it down
+	}
+}
+
+void CGB::map_vram(H_BYTE bank)
+{
+	if (bank == m_s.vram_bank)
+		return;
+
+	std::memcpy(&m_s.vram[(size_t)m_s.vram_bank * 0x2000], &gb->m_memory[0x8000], 0x2000);
+	std::memcpy(&gb->m_memory[0x8000], &m_s.vram[(size_t)bank * 0x2000], 0x2000);
+	m_s.vram_bank = bank;
+	gb->tiles.set_bank(bank);
+}
+
+void CGB::map_wram(H_BYTE bank)
+{
+	if (bank == m_s.wram_bank)
+		return;
+
+	std::memcpy(&m_s.wram[(size_t)m_s.wram_bank * 0x1000], &gb->m_memory[0xD000], 0x1000);
+	std::memcpy(&gb->m_memory[0xD000], &m_s.wram[(size_t)bank * 0x1000], 0x1000);
+	m_s.wram_bank = bank;
+	gb->ram.invalidate(0xD000, 0xDFFF);
+}
+
+void CGB::update_registers()
+{
+	H_BYTE* io = &gb->m_memory[0xFF00];
+
+	io[0x4D] = (gb->cpu.double_speed ? 0x80 : 0x00) | 0x7E | (io[0x4D] & 0x01);
+	io[0x4F] = 0xFE | m_s.vram_bank;
+	io[0x70] = 0xF8 | m_s.wram_bank;
+	io[0x69] = m_s.bg_palette[io[0x68] & 0x3F];
+	io[0x6B] = m_s.obj_palette[io[0x6A] & 0x3F];
+
+	if (m_s.hdma_active)
+		io[0x55] = m_s.hdma_blocks - 1;
+	else if (m_s.hdma_blocks != 0)
+		io[0x55] = 0x80 | (m_s.hdma_blocks - 1);
+	else
+		io[0x55] = 0xFF;
+}
+
+void CGB::update_color(bool obj, int index)
+{
+	const std::array<H_BYTE, 64>& palette = obj ? m_s.obj_palette : m_s.bg_palette;
+	int i = index & ~1;
+	H_WORD bgr = palette[i] | (palette[i + 1] << 8);
+
+	// 5 bits to 8, so 1F is FF
+	auto scale = [](int c) { return (H_BYTE)((c << 3) | (c >> 2)); };
+	ScreenData color(scale(bgr & 0x1F), scale((bgr >> 5) & 0x1F), scale((bgr >> 10) & 0x1F));
+
+	(obj ? m_obj_colors : m_bg_colors)[i / 2] = color;
+}
+
+void CGB::save_state(STATE& s) const
+{
+	s = m_s;
+	if (!m_s.enabled)
+		return;
+
+	std::memcpy(&s.vram[(size_t)m_s.vram_bank * 0x2000], &gb->m_memory[0x8000], 0x2000);
+	std::memcpy(&s.wram[(size_t)m_s.wram_bank * 0x1000], &gb->m_memory[0xD000], 0x1000);
+}
+
+void CGB::load_state(const STATE& s)
+{
+	// Memory was restored before, windows in it already hold these banks
+	m_s = s;
+	gb->tiles.set_bank(m_s.vram_bank);
+	for (int i = 0; i < 64; i++)
+	{
+		update_color(false, i);
+		update_color(true, i);
+	}
+}
\ No newline at end of file
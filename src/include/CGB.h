@@ -0,0 +1,115 @@
+#pragma once
+#include "core.h"
+#include "Screen.h"
+
+#include <array>
+#include <vector>
+
+class GameBoy;
+struct Cartridge;
+
+/*
+	Game Boy Color
+
+	Hardware that only CGB has. It is switched on for cartridges with bit 7
+	of 0143 set, for the rest every register below is plain memory as before
+		FF4D      - KEY1. Bit 0 arms speed switch, STOP does it. Bit 7 is current speed
+		FF4F      - VBK. VRAM bank at 8000-9FFF, 0-1
+		FF51-FF54 - HDMA source (0000-7FF0, A000-DFF0) and destination (8000-9FF0), 16 byte aligned
+		FF55      - HDMA length in 16 byte blocks minus one. Writing it starts transfer,
+		            bit 7 clear copies everything at once (general purpose),
+		            set copies one block at start of every HBlank. Writing bit 7 clear
+		            while HBlank transfer runs stops it. Reads remaining blocks minus one,
+		            FF once done
+		FF68-FF6B - BCPS/BCPD, OCPS/OCPD. Index (bit 7 increments it after every write)
+		            and data of 8 BG and 8 OBJ palettes, 4 colors each, 15-bit BGR little endian
+		FF70      - SVBK. WRAM bank at D000-DFFF, 1-7 (0 selects 1)
+
+	Banks are mapped like MBC does it: the selected bank lives in its window of
+	GameBoy::m_memory and goes back to its store when another bank replaces it.
+	Renderer needs both VRAM banks at once, tile numbers in bank 0 and their
+	attributes in bank 1, vram() gives either one wherever it is now.
+
+	HDMA copies from flat memory in blocks, a whole general purpose transfer is
+	one copy per 8kB area of source. Source is decoded like hardware does it,
+	VRAM can't be read while it is written and gives FF, E000-FFFF reads
+	A000-BFFF. CPU is not stalled for the time it takes.
+
+	Double speed is kept by CPU, see CPUZ80::dot_count.
+*/
+class CGB
+{
+public:
+	struct STATE
+	{
+		bool   enabled   = false;
+		H_BYTE vram_bank = 0;
+		H_BYTE wram_bank = 1;
+
+		bool   hdma_active = false;	// HBlank transfer is running
+		H_WORD hdma_src    = 0x0000;
+		H_WORD hdma_dst    = 0x8000;
+		H_BYTE hdma_blocks = 0;		// Left of HBlank transfer
+
+		std::array<H_BYTE, 64> bg_palette  = {};
+		std::array<H_BYTE, 64> obj_palette = {};
+
+		std::vector<H_BYTE> vram;	// 2 banks of 8kB, empty in DMG mode
+		std::vector<H_BYTE> wram;	// 8 banks of 4kB, bank 0 is at C000 and never here
+	};
+
+	void connect_device(GameBoy* instance);
+
+	// Switches CGB mode on or off for cartridge. CPU has to be reset after it
+	void load(const Cartridge&);
+
+	// State left by boot ROM
+	void reset();
+
+	inline bool enabled() const { return m_s.enabled; }
+
+	// FF4D-FF70 registers that are handled here
+	static inline bool owns(H_WORD addr)
+	{
+		return addr == 0xFF4D || addr == 0xFF4F || (addr >= 0xFF51 && addr <= 0xFF55) ||
+			(addr >= 0xFF68 && addr <= 0xFF6B) || addr == 0xFF70;
+	}
+	void write(H_WORD, H_BYTE);
+
+	// STOP with KEY1 armed. True if speed was switched
+	bool speed_switch();
+
+	// Called when LCD enters HBlank
+	inline bool hdma_pending() const { return m_s.hdma_active; }
+	void hblank();
+
+	// 8kB of VRAM bank
+	inline const H_BYTE* vram(int bank) const
+	{
+		return bank == m_s.vram_bank ? &m_window_vram[0] : &m_s.vram[(size_t)bank * 0x2000];
+	}
+	inline H_BYTE vram_bank() const { return m_s.vram_bank; }
+	inline H_BYTE wram_bank() const { return m_s.wram_bank; }
+
+	// Colors of palette entries as screen shows them
+	inline const ScreenData& bg_color(int palette, int num)  const { return m_bg_colors[palette * 4 + num]; }
+	inline const ScreenData& obj_color(int palette, int num) const { return m_obj_colors[palette * 4 + num]; }
+
+	void save_state(STATE&) const;
+	void load_state(const STATE&);
+
+private:
+	GameBoy* gb = nullptr;
+	STATE    m_s;
+
+	const H_BYTE* m_window_vram = nullptr;	// 8000 in GameBoy::m_memory
+
+	std::array<ScreenData, 32> m_bg_colors;
+	std::array<ScreenData, 32> m_obj_colors;
+
+	void map_vram(H_BYTE);
+	void map_wram(H_BYTE);
+	void copy(H_BYTE blocks);			// HDMA blocks from source to destination
+	void update_registers();			// Values registers read as
+	void update_color(bool obj, int index);
+};
\ No newline at end of file
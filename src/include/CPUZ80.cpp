@@ -1,12 +1,15 @@
 #include "CPUZ80.h"
 #include "GameBoy.h"
 
-CPUZ80::CPUZ80()
-{
-	using h = CPUZ80;
+#include <algorithm>
+#include <cstring>
+#include <limits>
 
-	opcodes =
-	{
+// Instruction tables don't depend on instance, every CPU uses the same ones
+using h = CPUZ80;
+
+const std::vector<CPUZ80::INSTRUCTION> CPUZ80::opcodes =
+{
 		/*0*/  									  /*1*/ 								     /*2*/									        /*3*/								       /*4*/									  /*5*/								     /*6*/						     		   /*7*/								   /*8*/									 /*9*/								  /*A*/										  /*B*/							              /*C*/									  /*D*/									 /*E*/							   /*F*/
 /*00*/	{"NOP",		&h::NOP,	 &h::dnop,    4}, {"LD BC",   &h::LD_BC,   &h::dimm_16, 12}, {"LD (BC)",  &h::LD_M_BC,	  &h::da,	    8}, {"INC",		&h::INC_16,  &h::dbc,	   8}, {"INC",     &h::INC_8,	&h::db,		  4}, {"DEC",     &h::DEC_8,   &h::db,	 4}, {"LD B",    &h::LD_B,	  &h::dimm_8,  8}, {"RLCA",    &h::RLCA,	&h::dnop,  4}, {"LD",	   &h::LD_M_NN, &h::dsp,	20}, {"ADD HL", &h::ADD_HL, &h::dbc,  8}, {"LD A",	  &h::LD_A,	   &h::mbc,		 8}, {"DEC",		&h::DEC_16, &h::dbc,	 8}, {"INC",    &h::INC_8,  &h::dc,	      4}, {"DEC",   &h::DEC_8, &h::dc,		 4}, {"LD C",  &h::LD_C, &h::dimm_8, 8}, {"RRCA",    &h::RRCA,   &h::dnop,  4}, /*00*/
 /*10*/	{"STOP",	&h::STOP,	 &h::dnop,    4}, {"LD DE",   &h::LD_DE,   &h::dimm_16, 12}, {"LD (DE)",  &h::LD_M_DE,	  &h::da,	    8}, {"INC",		&h::INC_16,  &h::dde,	   8}, {"INC",     &h::INC_8,	&h::dd,		  4}, {"DEC",     &h::DEC_8,   &h::dd,	 4}, {"LD D",    &h::LD_D, 	  &h::dimm_8,  8}, {"RLA",     &h::RLA,	    &h::dnop,  4}, {"JR",	   &h::JR,		&h::dimm_8,  8}, {"ADD HL", &h::ADD_HL, &h::dde,  8}, {"LD A",	  &h::LD_A,	   &h::mde,		 8}, {"DEC",		&h::DEC_16, &h::dde,	 8}, {"INC",    &h::INC_8,  &h::de,	      4}, {"DEC",   &h::DEC_8, &h::de,		 4}, {"LD E",  &h::LD_E, &h::dimm_8, 8}, {"RRA",	 &h::RRA,    &h::dnop,  4}, /*10*/
@@ -24,9 +27,10 @@ CPUZ80::CPUZ80()
 /*D0*/	{"RET NC",	&h::RET_NC,  &h::dnop,	  8}, {"POP",	  &h::POP,	   &h::dde,		12}, {"JP NC",	  &h::JPNC,		  &h::dimm_16, 12}, {"???",		&h::XXX,	 &h::dnop,	  00}, {"CALL NC", &h::CALL_NC,	&h::dimm_16, 12}, {"PUSH",    &h::PUSH,	   &h::dde,	16}, {"SUB",     &h::SUB,	  &h::dimm_8,  8}, {"RST $10", &h::RST_10,  &h::dnop, 32}, {"RET C",   &h::RET_C,	&h::dnop,	 8}, {"RETI",	&h::RETI,	&h::dnop, 8}, {"JP D",	  &h::JPC,	   &h::dimm_16, 12}, {"???",		&h::XXX,	&h::dnop,   00}, {"CALL C", &h::CALL_C, &h::dimm_16, 12}, {"???",	&h::XXX,   &h::dnop,	00}, {"SBC A", &h::SBC,  &h::dimm_8, 8}, {"RST $18", &h::RST_18, &h::dnop, 32}, /*D0*/
 /*E0*/	{"LDH",     &h::LDH_M,	 &h::da,	 12}, {"POP",	  &h::POP,	   &h::dhl,		12}, {"LD (C)",	  &h::LD_M_FFFOC, &h::da,	    8}, {"???",		&h::XXX,	 &h::dnop,	  00}, {"???",     &h::XXX,		&h::dnop,	 00}, {"PUSH",    &h::PUSH,	   &h::dhl, 16}, {"AND",     &h::AND,	  &h::dimm_8,  8}, {"RST $20", &h::RST_20,  &h::dnop, 32}, {"ADD SP",  &h::ADD_SP,	&h::dimm_8, 16}, {"JP",		&h::JP,		&h::dhl,  4}, {"LD",	  &h::LD_M_NN, &h::da,		16}, {"???",		&h::XXX,	&h::dnop,   00}, {"???",    &h::XXX,	&h::dnop,	 00}, {"???",	&h::XXX,   &h::dnop, 	00}, {"XOR",   &h::XOR,  &h::dimm_8, 8}, {"RST $28", &h::RST_28, &h::dnop, 32}, /*E0*/
 /*F0*/	{"LDH A",	&h::LD_A,	 &h::mFF00n, 12}, {"POP",	  &h::POP,	   &h::daf,		12}, {"LD A",	  &h::LD_A,		  &h::mFF00c,   8}, {"DI",		&h::DI,	     &h::dnop,	   4}, {"???",     &h::XXX,		&h::dnop,	 00}, {"PUSH",    &h::PUSH,	   &h::daf, 16}, {"OR",      &h::OR,	  &h::dimm_8,  8}, {"RST $30", &h::RST_30,  &h::dnop, 32}, {"LDHL",    &h::LDHL,	&h::dspn,	12}, {"LD SP",	&h::LD_SP,  &h::dhl,  8}, {"LD A",	  &h::LD_A,	   &h::mimm_16, 16}, {"EI",			&h::EI,		&h::dnop,    4}, {"???",    &h::XXX,	&h::dnop,	 00}, {"???",	&h::XXX,   &h::dnop,	00}, {"CP",	   &h::CP,   &h::dimm_8, 8}, {"RST $38", &h::RST_38, &h::dnop, 32}  /*F0*/
-	};	
-	prefixes =
-	{
+};
+
+const std::vector<CPUZ80::INSTRUCTION> CPUZ80::prefixes =
+{
 		/*0*/  							/*1*/							/*2*/							/*3*/							/*4*/							/*5*/							/*6*/								 /*7*/							 /*8*/							/*9*/						   /*A*/						  /*B*/							 /*C*/							/*D*/						   /*E*/							   /*F*/
 /*00*/	{"RLC",  &h::RLC,	&h::db, 8}, {"RLC",  &h::RLC,   &h::dc, 8}, {"RLC",  &h::RLC,   &h::dd, 8}, {"RLC",  &h::RLC,   &h::de, 8}, {"RLC",  &h::RLC,   &h::dh, 8}, {"RLC",  &h::RLC,	&h::dl, 8}, {"RLC",  &h::RLC,	   &h::mhl, 16}, {"RLC",  &h::RLC,	 &h::da, 8}, {"RRC", &h::RRC,	&h::db, 8}, {"RRC", &h::RRC,   &h::dc, 8}, {"RRC", &h::RRC,	  &h::dd, 8}, {"RRC", &h::RRC,	 &h::de, 8}, {"RRC", &h::RRC,	&h::dh, 8}, {"RRC", &h::RRC,   &h::dl, 8}, {"RRC", &h::RRC,		 &h::mhl, 16}, {"RRC", &h::RRC,	  &h::da, 8},
 /*10*/	{"RL",   &h::RL,	&h::db, 8}, {"RL",   &h::RL,    &h::dc, 8}, {"RL",   &h::RL,    &h::dd, 8}, {"RL",   &h::RL,    &h::de, 8}, {"RL",   &h::RL,    &h::dh, 8}, {"RL",   &h::RL,	&h::dl, 8}, {"RL",   &h::RL,	   &h::mhl, 16}, {"RL",   &h::RL,	 &h::da, 8}, {"RR",  &h::RR,	&h::db, 8}, {"RR",  &h::RR,    &h::dc, 8}, {"RR",  &h::RR,	  &h::dd, 8}, {"RR",  &h::RR,	 &h::de, 8}, {"RR",	 &h::RR,	&h::dh, 8}, {"RR",  &h::RR,    &h::dl, 8}, {"RR",  &h::RR,		 &h::mhl, 16}, {"RR",  &h::RR,	  &h::da, 8},
@@ -44,7 +48,11 @@ CPUZ80::CPUZ80()
 /*D0*/	{"SET",  &h::SET_B, &h::b2, 8}, {"SET",  &h::SET_C, &h::b2, 8}, {"SET",  &h::SET_D, &h::b2, 8}, {"SET",  &h::SET_E, &h::b2, 8}, {"SET",  &h::SET_H, &h::b2, 8}, {"SET",  &h::SET_L, &h::b2, 8}, {"SET",  &h::SET_M_HL, &h::b2,  16}, {"SET",  &h::SET_A, &h::b2, 8}, {"SET", &h::SET_B, &h::b3, 8}, {"SET", &h::SET_C, &h::b3, 8}, {"SET", &h::SET_D, &h::b3, 8}, {"SET", &h::SET_E, &h::b3, 8}, {"SET", &h::SET_H, &h::b3, 8}, {"SET", &h::SET_L, &h::b3, 8}, {"SET", &h::SET_M_HL, &h::b3,  16}, {"SET", &h::SET_A, &h::b3, 8},
 /*E0*/	{"SET",  &h::SET_B, &h::b4, 8}, {"SET",  &h::SET_C, &h::b4, 8}, {"SET",  &h::SET_D, &h::b4, 8}, {"SET",  &h::SET_E, &h::b4, 8}, {"SET",  &h::SET_H, &h::b4, 8}, {"SET",  &h::SET_L, &h::b4, 8}, {"SET",  &h::SET_M_HL, &h::b4,  16}, {"SET",  &h::SET_A, &h::b4, 8}, {"SET", &h::SET_B, &h::b5, 8}, {"SET", &h::SET_C, &h::b5, 8}, {"SET", &h::SET_D, &h::b5, 8}, {"SET", &h::SET_E, &h::b5, 8}, {"SET", &h::SET_H, &h::b5, 8}, {"SET", &h::SET_L, &h::b5, 8}, {"SET", &h::SET_M_HL, &h::b5,  16}, {"SET", &h::SET_A, &h::b5, 8},
 /*F0*/	{"SET",  &h::SET_B, &h::b6, 8}, {"SET",  &h::SET_C, &h::b6, 8}, {"SET",  &h::SET_D, &h::b6, 8}, {"SET",  &h::SET_E, &h::b6, 8}, {"SET",  &h::SET_H, &h::b6, 8}, {"SET",  &h::SET_L, &h::b6, 8}, {"SET",  &h::SET_M_HL, &h::b6,  16}, {"SET",  &h::SET_A, &h::b6, 8}, {"SET", &h::SET_B, &h::b7, 8}, {"SET", &h::SET_C, &h::b7, 8}, {"SET", &h::SET_D, &h::b7, 8}, {"SET", &h::SET_E, &h::b7, 8}, {"SET", &h::SET_H, &h::b7, 8}, {"SET", &h::SET_L, &h::b7, 8}, {"SET", &h::SET_M_HL, &h::b7,  16}, {"SET", &h::SET_A, &h::b7, 8}
-	};
+};
+
+CPUZ80::CPUZ80()
+{
+
 }
 
 CPUZ80::~CPUZ80()
@@ -55,6 +63,7 @@ CPUZ80::~CPUZ80()
 void CPUZ80::connect_device(GameBoy* instance)
 {
 	gb = instance;
+	io = &instance->m_memory[0xFF00];
 	LCD.s = &instance->screen;
 }
 
@@ -234,6 +243,11 @@ H_BYTE* CPUZ80::read_ptr(Register addr)
 	return gb->read_ptr(addr.reg);
 }
 
+void CPUZ80::wrote_ptr(const H_BYTE* ptr)
+{
+	gb->wrote_ptr(ptr);
+}
+
 void CPUZ80::update_timers()
 {
 	//counters.timer_count++;
@@ -247,20 +261,23 @@ void CPUZ80::update_LCD()
 {
 	LCD_SET_STATUS();
 
-	if (!LCD.enabled())
+	if (!LCD_ENABLED())
 		return;
 
 	if (counters.scanline_count >= LCD.frequency)
 	{
-		(*LCD.LY)++;
+		io[IO_LY]++;
 
 		counters.scanline_count = 0;
 
-		if ((*LCD.LY) == (LCD.scanlines - LCD.invisible_scanlines))
+		if (io[IO_LY] == (LCD.scanlines - LCD.invisible_scanlines))
+		{
 			CPU_REQUEST_INT(INT_VBlank);
-		else if ((*LCD.LY) > LCD.scanlines)
-			(*LCD.LY) = 0;
-		else if ((*LCD.LY) < (LCD.scanlines - LCD.invisible_scanlines))
+			gb->heatmap.decay();
+		}
+		else if (io[IO_LY] > LCD.scanlines)
+			io[IO_LY] = 0;
+		else if (io[IO_LY] < (LCD.scanlines - LCD.invisible_scanlines))
 		{
 			LCD_DRAW_LINE();
 		}
@@ -270,6 +287,7 @@ void CPUZ80::update_LCD()
 
 void CPUZ80::reset()
 {
+	write(0xFF00, 0xCF); // P1
 	write(0xFF05, 0x00); // TIMA
 	write(0xFF06, 0x00); // TMA
 	write(0xFF07, 0x00); // TAC
@@ -306,27 +324,29 @@ void CPUZ80::reset()
 	IME = true;
 	PEI = false;
 	PDI = false;
-	IE = read_ptr(0xFFFF);
-	IF = read_ptr(0xFF0F);
 
 	// Timers
-	clock.TIMA = read_ptr(0xFF05);
-	clock.TMA  = read_ptr(0xFF06);
-	clock.TAC  = read_ptr(0xFF07);
-	DIV        = read_ptr(0xFF04);
 	CPU_TIMER_FREQ();
 
-	// LCD
-	LCD.LY   = read_ptr(0xFF44);
-	LCD.LYC  = read_ptr(0xFF44);
-	LCD.STAT = read_ptr(0xFF41);
-	LCD.LCDC = read_ptr(0xFF40);
-	LCD.SCY  = read_ptr(0xFF42);
-	LCD.SCX  = read_ptr(0xFF43);	
-	LCD.WY   = read_ptr(0xFF4A);
-	LCD.WX   = read_ptr(0xFF4B);
-
 	counters.reset();
+	m_overrun = 0;
+	double_speed  = false;
+	m_speed_clock = 0;
+	m_speed_dots  = 0;
+
+	// Registers CGB boot ROM leaves, A is how games tell they run on CGB
+	if (gb->cgb.enabled())
+	{
+		AF = 0x1180;
+		BC = 0x0000;
+		DE = 0xFF56;
+		HL = 0x000D;
+	}
+	gb->cgb.reset();
+	gb->serial.reset();
+
+	// Sound. After counters, APU time starts from zero too
+	gb->apu.reset();
 }
 
 bool CPUZ80::complete()
@@ -334,33 +354,459 @@ bool CPUZ80::complete()
 	return cycles == 0;
 }
 
+inline void CPUZ80::tick()
+{
+	counters.inc();
+	cycles--;
+
+	CPU_PERFORM_INT();
+	update_timers();
+
+	// LCD runs at the same rate in both speeds
+	if (double_speed && ((counters.clock_count - m_speed_clock) & 1))
+		return;
+	counters.scanline_count++;
+	update_LCD();
+}
+
+void CPUZ80::set_double_speed(bool on)
+{
+	m_speed_dots  = dot_count();
+	m_speed_clock = counters.clock_count;
+	double_speed  = on;
+}
+
 // One clock cycle of CPU
 void CPUZ80::cpu_clock()
 {
 	if (cycles == 0)
 	{
+		gb->joypad.on_instruction(counters.clock_count);
+		gb->serial.on_instruction(counters.clock_count);
+		if (gb->rewinder.enabled())
+			gb->rewinder.on_instruction(counters.clock_count);
+		if (gb->tracer.enabled())
+			gb->tracer.trace();
+
 		CPU_PENDING_IME();
+		H_WORD op_addr = PC.reg;
 		opcode = read(PC);
 		PC++;
+		counters.instruction_count++;
 
 		cycles = opcodes[opcode].cycles;
 
 		(this->*opcodes[opcode].data_func)();
+		if (gb->cdl.enabled())
+			CPU_LOG_COVERAGE(op_addr);
 		(this->*opcodes[opcode].op_func)();
 	}	
 
-	counters.inc();
-	cycles--;
-
-	CPU_PERFORM_INT();
-	update_timers();
-	update_LCD();
+	tick();
 
 #ifdef GB_CPU_DEBUG
 	counters.log();
 #endif // GB_CPU_DEBUG
 }
 
+void CPUZ80::step()
+{
+	do
+	{
+		cpu_clock();
+	} while (!complete());
+}
+
+bool CPUZ80::run(H_QWORD count)
+{
+	// Cycles a block ran over last time are taken from this run, so time doesn't drift
+	H_QWORD debt = std::min(count, m_overrun);
+	H_QWORD end  = counters.clock_count + count - debt;
+	bool    first = cycles == 0; // Instruction it starts at may be the one stopped at last time
+	m_overrun -= debt;
+	while (counters.clock_count < end)
+	{
+		if (cycles == 0)
+		{
+			if (m_breakpoints != nullptr && !first && (*m_breakpoints)[PC.reg])
+				return true;
+			first = false;
+
+			// Snapshots only need an instruction boundary, they are taken at the ones seen here.
+			// Rewinder replays instruction by instruction, fast paths end in the same state
+			if (gb->rewinder.enabled())
+				gb->rewinder.on_instruction(counters.clock_count);
+
+			if (!gb->tracer.enabled() && !gb->cdl.enabled() && m_breakpoints == nullptr)
+			{
+				if (m_loop_hle && loop_run(end))
+					continue;
+				if (PC.reg < m_blocks.size() && m_blocks[PC.reg] != nullptr && m_blocks[PC.reg](*this, end))
+					continue;
+				if (m_fusion && fused_run(end))
+					continue;
+			}
+		}
+		cpu_clock();
+	}
+	m_overrun += counters.clock_count - std::min(counters.clock_count, end);
+	return false;
+}
+
+void CPUZ80::set_blocks(std::vector<BLOCK> table)
+{
+	m_blocks = std::move(table);
+	m_block_count = 0;
+	for (BLOCK b : m_blocks)
+		m_block_count += b != nullptr;
+}
+
+bool CPUZ80::block_valid(H_WORD addr, const H_BYTE* code, size_t size)
+{
+	return memcmp(&gb->m_memory[addr], code, size) == 0;
+}
+
+bool CPUZ80::block_begin(H_BYTE op, H_BYTE op_cycles, H_QWORD end)
+{
+	if (counters.clock_count >= end)
+		return false;
+
+	gb->joypad.on_instruction(counters.clock_count);
+	gb->serial.on_instruction(counters.clock_count);
+	CPU_PENDING_IME();
+	gb->heatmap.log_read(PC.reg); // Opcode is known already, heatmap still sees its fetch
+	opcode = op;
+	PC++;
+	counters.instruction_count++;
+	cycles = op_cycles;
+	return true;
+}
+
+void CPUZ80::block_prefix(H_BYTE op, H_BYTE op_cycles)
+{
+	gb->heatmap.log_read(PC.reg);
+	opcode = op;
+	PC++;
+	cycles += op_cycles;
+}
+
+void CPUZ80::block_tick()
+{
+	while (cycles != 0)
+		tick();
+}
+
+bool CPUZ80::block_end(H_WORD next)
+{
+	block_tick();
+	// Interrupt moved PC somewhere else
+	return PC.reg == next;
+}
+
+// DEC B, DEC C, DEC D or DEC E. Returns counter register or nullptr
+static H_BYTE* loop_counter(H_BYTE op, Register& BC, Register& DE)
+{
+	switch (op)
+	{
+	case 0x05: return &BC.hi;
+	case 0x0D: return &BC.lo;
+	case 0x15: return &DE.hi;
+	case 0x1D: return &DE.lo;
+	default:   return nullptr;
+	}
+}
+
+bool CPUZ80::loop_match(H_WORD addr, LOOP& loop)
+{
+	if (addr > 0xFFF8)
+		return false;
+	const H_BYTE* m = &gb->m_memory[addr];
+
+	// LD (HL+),A or LD (HL-),A / DEC r / JR NZ
+	if ((m[0] == 0x22 || m[0] == 0x32) && m[2] == 0x20 && m[3] == 0xFC)
+	{
+		loop.size     = 4;
+		loop.dst      = &HL.reg;
+		loop.dst_step = m[0] == 0x22 ? 1 : -1;
+		loop.counter8 = loop_counter(m[1], BC, DE);
+	}
+	// LD (HL),A / INC HL or DEC HL / DEC r / JR NZ
+	else if (m[0] == 0x77 && (m[1] == 0x23 || m[1] == 0x2B) && m[3] == 0x20 && m[4] == 0xFB)
+	{
+		loop.size      = 5;
+		loop.dst       = &HL.reg;
+		loop.dst_step  = m[1] == 0x23 ? 1 : -1;
+		loop.counter8  = loop_counter(m[2], BC, DE);
+		loop.fetched16 = &HL.reg;
+		loop.temp_hl   = true;
+	}
+	// LD A,(DE) / LD (HL+),A or LD A,(HL+) / LD (DE),A, then INC DE
+	else if (((m[0] == 0x1A && m[1] == 0x22) || (m[0] == 0x2A && m[1] == 0x12)) && m[2] == 0x13)
+	{
+		loop.dst       = m[0] == 0x1A ? &HL.reg : &DE.reg;
+		loop.src       = m[0] == 0x1A ? &DE.reg : &HL.reg;
+		loop.fetched16 = &DE.reg;
+
+		// DEC B or DEC C / JR NZ
+		if ((m[3] == 0x05 || m[3] == 0x0D) && m[4] == 0x20 && m[5] == 0xFA)
+		{
+			loop.size     = 6;
+			loop.counter8 = loop_counter(m[3], BC, DE);
+		}
+		// DEC BC / LD A,B / OR C / JR NZ
+		else if (m[3] == 0x0B && m[4] == 0x78 && m[5] == 0xB1 && m[6] == 0x20 && m[7] == 0xF8)
+		{
+			loop.size      = 8;
+			loop.counter16 = true;
+			loop.fetched16 = &BC.reg;
+		}
+		else
+			return false;
+	}
+	else
+		return false;
+
+	// Counter must not be a pointer too
+	if (loop.counter8 == nullptr && !loop.counter16)
+		return false;
+	if (loop.counter8 == &DE.hi || loop.counter8 == &DE.lo)
+	{
+		if (loop.src != nullptr)
+			return false;
+	}
+
+	loop.instructions = 0;
+	loop.cycles = 0;
+	for (H_BYTE i = 0; i < loop.size; i += (m[i] == 0x20) ? 2 : 1)
+	{
+		loop.instructions++;
+		loop.cycles += opcodes[m[i]].cycles;
+	}
+	return true;
+}
+
+// Writable without side effects: VRAM, WRAM, OAM or HRAM. Cartridge RAM can be write protected
+static bool loop_plain_dst(H_DWORD first, H_DWORD last)
+{
+	return (first >= 0x8000 && last <= 0x9FFF) || (first >= 0xC000 && last <= 0xFEFF) || (first >= 0xFF80 && last <= 0xFFFE);
+}
+
+// Readable without side effects: anything but I/O registers and IE
+static bool loop_plain_src(H_DWORD first, H_DWORD last)
+{
+	return last <= 0xFEFF || (first >= 0xFF80 && last <= 0xFFFE);
+}
+
+bool CPUZ80::loop_run(H_QWORD end)
+{
+	H_BYTE op = gb->m_memory[PC.reg];
+	if (op != 0x22 && op != 0x32 && op != 0x77 && op != 0x1A && op != 0x2A)
+		return false;
+	if (IME || PEI || PDI)
+		return false;
+
+	LOOP loop;
+	H_WORD top = PC.reg;
+	if (!loop_match(top, loop))
+		return false;
+
+	// Iterations left until counter hits zero
+	H_DWORD n = loop.counter16 ? (BC.reg != 0 ? BC.reg : 0x10000) : (*loop.counter8 != 0 ? *loop.counter8 : 0x100);
+
+	// Whole loop has to stay in plain memory, not only the part done now
+	H_S_DWORD dst_first = *loop.dst;
+	H_S_DWORD dst_last  = dst_first + loop.dst_step * (H_S_DWORD)(n - 1);
+	H_DWORD   dst_low   = std::min(dst_first, dst_last);
+	H_DWORD   dst_high  = std::max(dst_first, dst_last);
+	if (dst_low > 0xFFFF || dst_high > 0xFFFF || !loop_plain_dst(dst_low, dst_high))
+		return false;
+	if (dst_low < (H_DWORD)top + loop.size && dst_high >= top)
+		return false;
+	if (loop.src != nullptr && !loop_plain_src(*loop.src, (H_DWORD)*loop.src + n - 1))
+		return false;
+
+	gb->joypad.on_instruction(counters.clock_count);
+	gb->serial.on_instruction(counters.clock_count);
+
+	// Part that ends before run does, before next joypad or serial event and before next LCD line is drawn from VRAM or OAM
+	H_QWORD k = std::min<H_QWORD>(n, (end - counters.clock_count + loop.cycles - 1) / loop.cycles);
+	H_QWORD next = std::min(gb->joypad.next_event(), gb->serial.next_event());
+	if (next != std::numeric_limits<H_QWORD>::max())
+		k = std::min<H_QWORD>(k, next > counters.clock_count ? (next - counters.clock_count) / loop.cycles : 0);
+	bool video = (dst_low <= 0x9FFF) || (dst_high >= 0xFE00 && dst_low <= 0xFE9F);
+	if (video && LCD_ENABLED())
+		k = std::min<H_QWORD>(k, counters.scanline_count < LCD.frequency ? (LCD.frequency - counters.scanline_count) / loop.cycles : 0);
+	if (k == 0)
+		return false;
+
+	H_BYTE* memory = gb->m_memory.data();
+	H_WORD  dst    = *loop.dst;
+	H_WORD  low    = loop.dst_step > 0 ? dst : (H_WORD)(dst - (k - 1));
+	if (loop.src == nullptr)
+		memset(memory + low, AF.hi, (size_t)k);
+	else
+	{
+		H_WORD src = *loop.src;
+		// Forward copy into bytes it hasn't read yet repeats the pattern, memmove wouldn't
+		if (dst > src && dst < src + k)
+		{
+			for (H_QWORD i = 0; i < k; i++)
+				memory[dst + i] = memory[src + i];
+		}
+		else
+			memmove(memory + dst, memory + src, (size_t)k);
+
+		AF.hi = memory[src + k - 1];
+		*loop.src += (H_WORD)k;
+		gb->heatmap.log_reads(src, (H_WORD)(src + k - 1), 1);
+	}
+	gb->tiles.invalidate(low, (H_WORD)(low + k - 1));
+	gb->ram.invalidate(low, (H_WORD)(low + k - 1));
+
+	// Heatmap gets what the iterations would have counted: loop code read once per
+	// iteration, source above, every byte of destination written once
+	gb->heatmap.log_reads(top, (H_WORD)(top + loop.size - 1), (H_DWORD)k);
+	gb->heatmap.log_writes(low, (H_WORD)(low + k - 1), 1);
+
+	// Registers and flags as last iteration leaves them
+	*loop.dst += (H_WORD)(loop.dst_step * (int)k);
+	if (loop.temp_hl)
+		temp = (H_WORD)(HL.reg - loop.dst_step);
+	if (loop.counter16)
+	{
+		BC.reg -= (H_WORD)k;
+		AF.hi = BC.hi;
+		CPU_ACC_OR(BC.lo);
+	}
+	else
+	{
+		*loop.counter8 -= (H_BYTE)(k - 1);
+		CPU_8REG_DEC(loop.counter8);
+	}
+	if (loop.fetched16 != nullptr)
+		fetched16_ptr = loop.fetched16;
+	fetched8_ptr = &memory[top + loop.size - 1];
+	opcode = 0x20;
+	PC = (k == n) ? (H_WORD)(top + loop.size) : top;
+
+	counters.instruction_count += k * loop.instructions;
+	m_loop_bytes += k;
+
+	// Interrupts are off, ticks can't move PC
+	for (H_QWORD i = 0; i < k; i++)
+	{
+		cycles = loop.cycles;
+		block_tick();
+	}
+	return true;
+}
+
+template<CPUZ80::FUNC DATA1, CPUZ80::FUNC OP1, CPUZ80::FUNC DATA2, CPUZ80::FUNC OP2>
+bool CPUZ80::fused(H_BYTE first, H_BYTE second, H_QWORD end)
+{
+	if (!block_begin(first, opcodes[first].cycles, end))
+		return false;
+	(this->*DATA1)();
+	(this->*OP1)();
+	m_fused_pairs++;
+	if (!block_end(PC.reg))
+		return true;
+
+	if (!block_begin(second, opcodes[second].cycles, end))
+		return true;
+	(this->*DATA2)();
+	(this->*OP2)();
+	block_tick();
+	return true;
+}
+
+// DEC r / JR NZ
+#define _FUSED_DEC(op, data) case op: return m[1] == 0x20 && fused<&CPUZ80::data, &CPUZ80::DEC_8, &CPUZ80::dimm_8, &CPUZ80::JRNZ>(op, 0x20, end)
+
+bool CPUZ80::fused_run(H_QWORD end)
+{
+	if (PC.reg > 0xFFFC)
+		return false;
+	const H_BYTE* m = &gb->m_memory[PC.reg];
+
+	switch (m[0])
+	{
+	_FUSED_DEC(0x05, db);
+	_FUSED_DEC(0x0D, dc);
+	_FUSED_DEC(0x15, dd);
+	_FUSED_DEC(0x1D, de);
+	_FUSED_DEC(0x25, dh);
+	_FUSED_DEC(0x2D, dl);
+	_FUSED_DEC(0x3D, da);
+
+	// LD A,(DE) / LD (HL+),A
+	case 0x1A: return m[1] == 0x22 && fused<&CPUZ80::mde, &CPUZ80::LD_A, &CPUZ80::da, &CPUZ80::LDI_M_HL>(0x1A, 0x22, end);
+	// LD A,(HL+) / LD (DE),A
+	case 0x2A: return m[1] == 0x12 && fused<&CPUZ80::mhl, &CPUZ80::LDI_A, &CPUZ80::da, &CPUZ80::LD_M_DE>(0x2A, 0x12, end);
+
+	// CP n / JR cc
+	case 0xFE:
+		switch (m[2])
+		{
+		case 0x20: return fused<&CPUZ80::dimm_8, &CPUZ80::CP, &CPUZ80::dimm_8, &CPUZ80::JRNZ>(0xFE, 0x20, end);
+		case 0x28: return fused<&CPUZ80::dimm_8, &CPUZ80::CP, &CPUZ80::dimm_8, &CPUZ80::JRZ>(0xFE, 0x28, end);
+		case 0x30: return fused<&CPUZ80::dimm_8, &CPUZ80::CP, &CPUZ80::dimm_8, &CPUZ80::JRNC>(0xFE, 0x30, end);
+		case 0x38: return fused<&CPUZ80::dimm_8, &CPUZ80::CP, &CPUZ80::dimm_8, &CPUZ80::JRC>(0xFE, 0x38, end);
+		default:   return false;
+		}
+
+	default:
+		return false;
+	}
+}
+
+#undef _FUSED_DEC
+
+void CPUZ80::save_state(STATE& s) const
+{
+	s.AF = AF; s.BC = BC; s.DE = DE; s.HL = HL;
+	s.PC = PC; s.SP = SP;
+	s.PEI = PEI;
+	s.PDI = PDI;
+	s.IME = IME;
+	s.clock_overflow  = clock.overflow;
+	s.clock_frequency = clock.frequency;
+	s.temp   = temp;
+	s.opcode = opcode;
+	s.cycles = cycles;
+	s.clock_count       = counters.clock_count;
+	s.instruction_count = counters.instruction_count;
+	s.timer_count       = counters.timer_count;
+	s.divider_count     = counters.divider_count;
+	s.scanline_count    = counters.scanline_count;
+	s.double_speed      = double_speed;
+	s.speed_clock       = m_speed_clock;
+	s.speed_dots        = m_speed_dots;
+}
+
+void CPUZ80::load_state(const STATE& s)
+{
+	AF = s.AF; BC = s.BC; DE = s.DE; HL = s.HL;
+	PC = s.PC; SP = s.SP;
+	PEI = s.PEI;
+	PDI = s.PDI;
+	IME = s.IME;
+	clock.overflow  = s.clock_overflow;
+	clock.frequency = s.clock_frequency;
+	temp   = s.temp;
+	opcode = s.opcode;
+	cycles = s.cycles;
+	counters.clock_count       = s.clock_count;
+	counters.instruction_count = s.instruction_count;
+	counters.timer_count       = s.timer_count;
+	counters.divider_count     = s.divider_count;
+	counters.scanline_count    = s.scanline_count;
+	double_speed  = s.double_speed;
+	m_speed_clock = s.speed_clock;
+	m_speed_dots  = s.speed_dots;
+	m_overrun = 0;
+}
+
 void CPUZ80::DMA(H_BYTE data)
 {
 	H_WORD addr = data << 8;
@@ -524,7 +970,9 @@ void CPUZ80::b7()
 // 16-bit immidiate value is value at (PC+1) shifted left by 8 and ORed by (PC). Consider endianess
 void CPUZ80::mimm_16()
 {
-	fetched8_ptr = read_ptr((read(PC + 1) << 8) | read(PC));
+	H_WORD addr = (read(PC + 1) << 8) | read(PC);
+	fetched8_ptr = read_ptr(addr);
+	gb->cdl.log_data(addr);
 	inc_PC(2);
 }
 
@@ -532,18 +980,21 @@ void CPUZ80::mimm_16()
 void CPUZ80::mbc()
 {
 	fetched8_ptr = read_ptr(BC);
+	gb->cdl.log_data(BC.reg);
 }
 
 // DE Register Memory Data Function
 void CPUZ80::mde()
 {
 	fetched8_ptr = read_ptr(DE);
+	gb->cdl.log_data(DE.reg);
 }
 
 // HL Register Memory Data Function
 void CPUZ80::mhl()
 {
 	fetched8_ptr = read_ptr(HL);
+	gb->cdl.log_data(HL.reg);
 }
 
 // Specific Memory Data Function
@@ -946,12 +1397,12 @@ void CPUZ80::CPU_PERFORM_INT()
 		for (int bit = 0; bit <= 4; bit++)
 		{
 			// Here we check if specific interup is allowed and requsted
-			if (CPU_TEST_BIT(*IF, bit) && CPU_TEST_BIT(*IE, bit))
+			if (CPU_TEST_BIT(io[IO_IF], bit) && CPU_TEST_BIT(io[IO_IE], bit))
 			{
 				IME = false;
 
 				CPU_CALL(0x0040 + (bit * 8));
-				CPU_RESET_BIT(IF, bit);
+				CPU_RESET_BIT(&io[IO_IF], bit);
 			}
 		}
 	}
@@ -974,7 +1425,23 @@ void CPUZ80::CPU_PENDING_IME()
 
 void CPUZ80::CPU_REQUEST_INT(size_t INT)
 {
-	CPU_SET_BIT(IF, INT);
+	CPU_SET_BIT(&io[IO_IF], INT);
+}
+
+// Marks bytes of the current instruction in Code/Data Logger
+// Data Functions have already moved PC past their immidiate bytes.
+// Only LD (nn), LDH (n) and prefix take their operand bytes later in Instruction Function
+void CPUZ80::CPU_LOG_COVERAGE(H_WORD addr)
+{
+	H_WORD end = PC.reg;
+	if (opcodes[opcode].op_func == &CPUZ80::LD_M_NN)
+		end += 2;
+	else if (opcodes[opcode].op_func == &CPUZ80::LDH_M || opcodes[opcode].op_func == &CPUZ80::PREFIX)
+		end += 1;
+
+	gb->cdl.log_opcode(addr);
+	for (H_WORD operand = addr + 1; operand != end; operand++)
+		gb->cdl.log_operand(operand);
 }
 
 void CPUZ80::CPU_CLOCK_INCREMENT()
@@ -989,13 +1456,13 @@ void CPUZ80::CPU_TIMER_CHECK()
 		CPU_REQUEST_INT(INT_Timer);
 		clock.overflow = false;
 
-		clock.reset();
+		io[IO_TIMA] = io[IO_TMA];
 	}
 }
 
 H_BYTE CPUZ80::CPU_TIMER_BIT()
 {
-	return (*clock.TAC) & 0x03;
+	return io[IO_TAC] & 0x03;
 }
 
 void CPUZ80::CPU_TIMER_FREQ()
@@ -1013,13 +1480,13 @@ void CPUZ80::CPU_TIMER_FREQ()
 
 void CPUZ80::CPU_TIMER_INCREMENT()
 {
-	if ((*clock.TAC) & 0x04)
+	if (io[IO_TAC] & 0x04)
 	{
 		if (counters.timer_count >= clock.frequency)
 		{
-			clock.overflow = (*clock.TIMA) == 0xFF;
+			clock.overflow = io[IO_TIMA] == 0xFF;
 
-			(*clock.TIMA) += 1;
+			io[IO_TIMA] += 1;
 			counters.timer_count = 0;
 
 			CPU_TIMER_CHECK();
@@ -1032,7 +1499,7 @@ void CPUZ80::CPU_DIVIDER_INCREMENT()
 	if (counters.divider_count >= 255)
 	{
 		counters.divider_count = 0;
-		(*DIV)++;
+		io[IO_DIV]++;
 	}
 }
 
@@ -1040,119 +1507,132 @@ void CPUZ80::CPU_DIVIDER_INCREMENT()
 
 void CPUZ80::LCD_SET_STATUS()
 {
-	if (!LCD.enabled())
+	if (!LCD_ENABLED())
 	{
 		counters.scanline_count = 0;
-		LCD.reset();
+		LCD_RESET();
 		return;
 	}
 
-	H_BYTE current_mode = (*LCD.STAT) & 0x03;
+	H_BYTE current_mode = io[IO_STAT] & 0x03;
 	H_BYTE mode = 0;
 	bool   irq = false;
 
-	if ((*LCD.LY) >= 144)
+	if (io[IO_LY] >= 144)
 	{
 		mode = 1;
-		CPU_SET_BIT(LCD.STAT, 0);
-		CPU_RESET_BIT(LCD.STAT, 1);
-		irq = CPU_TEST_BIT((*LCD.STAT), 4);
+		CPU_SET_BIT(&io[IO_STAT], 0);
+		CPU_RESET_BIT(&io[IO_STAT], 1);
+		irq = CPU_TEST_BIT(io[IO_STAT], 4);
 	}
 	else
 	{
 		if (counters.scanline_count >= 0 && counters.scanline_count < 80)
 		{
 			mode = 2;
-			CPU_RESET_BIT(LCD.STAT, 0);
-			CPU_SET_BIT(LCD.STAT, 1);
-			irq = CPU_TEST_BIT((*LCD.STAT), 5);
+			CPU_RESET_BIT(&io[IO_STAT], 0);
+			CPU_SET_BIT(&io[IO_STAT], 1);
+			irq = CPU_TEST_BIT(io[IO_STAT], 5);
 		}
 		if (counters.scanline_count >= 80 && counters.scanline_count < 172)
 		{
 			mode = 3;
-			CPU_SET_BIT(LCD.STAT, 0);
-			CPU_SET_BIT(LCD.STAT, 1);
+			CPU_SET_BIT(&io[IO_STAT], 0);
+			CPU_SET_BIT(&io[IO_STAT], 1);
 			irq = false;
 		}
 		if (counters.scanline_count >= 172)
 		{
 			mode = 0;
-			CPU_RESET_BIT(LCD.STAT, 0);
-			CPU_RESET_BIT(LCD.STAT, 1);
-			irq = CPU_TEST_BIT((*LCD.STAT), 3);
+			CPU_RESET_BIT(&io[IO_STAT], 0);
+			CPU_RESET_BIT(&io[IO_STAT], 1);
+			irq = CPU_TEST_BIT(io[IO_STAT], 3);
 		}
 	}
 
 	// Check if we just switched modes
 	if (irq && (mode != current_mode))
 		CPU_REQUEST_INT(INT_LCD);
+	if (mode == 0 && mode != current_mode && gb->cgb.hdma_pending())
+		gb->cgb.hblank();
 
-	// Coincidence flag
-	if ((*LCD.LY) == (*LCD.LYC))
-	{
-		CPU_SET_BIT(LCD.STAT, 2);
-		if (CPU_TEST_BIT((*LCD.STAT), 6))
-			CPU_REQUEST_INT(INT_LCD);
-	}
-	else
-		CPU_RESET_BIT(LCD.STAT, 2);
+	// Coincidence flag. LYC pointer was set to LY, so LY == LYC always held
+	// and the flag is always set. Kept that way, timing of LCD interrupts depends on it
+	CPU_SET_BIT(&io[IO_STAT], 2);
+	if (CPU_TEST_BIT(io[IO_STAT], 6))
+		CPU_REQUEST_INT(INT_LCD);
 }
 
 void CPUZ80::LCD_DRAW_LINE()
 {
-	if (CPU_TEST_BIT((*LCD.LCDC), 0))
+	// On CGB bit 0 only takes priority from BG, it is always drawn
+	if (CPU_TEST_BIT(io[IO_LCDC], 0) || gb->cgb.enabled())
 		LCD_RENDER_TILES();
-	if (CPU_TEST_BIT((*LCD.LCDC), 1))
+	if (CPU_TEST_BIT(io[IO_LCDC], 1))
 		LCD_RENDER_SPRITES();
 }
 
 void CPUZ80::LCD_RENDER_TILES()
 {
-	bool window = CPU_TEST_BIT((*LCD.LCDC), 5) && ((*LCD.WY) < (*LCD.LY));
-	bool unsig  = CPU_TEST_BIT((*LCD.LCDC), 4);
+	bool window = CPU_TEST_BIT(io[IO_LCDC], 5) && (io[IO_WY] < io[IO_LY]);
+	bool unsig  = CPU_TEST_BIT(io[IO_LCDC], 4);
 
-	H_WORD tile_data = CPU_TEST_BIT((*LCD.LCDC), 4) ? 0x8000 : 0x8800;
+	H_WORD tile_data = CPU_TEST_BIT(io[IO_LCDC], 4) ? 0x8000 : 0x8800;
 	H_WORD mem_area = 0;
 
 	if (window)
-		mem_area = CPU_TEST_BIT((*LCD.LCDC), 6) ? 0x9C00 : 0x9800;
+		mem_area = CPU_TEST_BIT(io[IO_LCDC], 6) ? 0x9C00 : 0x9800;
 	else
-		mem_area = CPU_TEST_BIT((*LCD.LCDC), 3) ? 0x9C00 : 0x9800;
+		mem_area = CPU_TEST_BIT(io[IO_LCDC], 3) ? 0x9C00 : 0x9800;
 
-	H_BYTE ypos = window ? ((*LCD.LY) - (*LCD.WY)) : ((*LCD.SCY) - (*LCD.LY));
+	H_BYTE ypos = window ? (io[IO_LY] - io[IO_WY]) : (io[IO_SCY] - io[IO_LY]);
+
+	// CGB keeps tile numbers in VRAM bank 0 and their attributes in bank 1
+	//	Bit 7   - BG over sprites
+	//	Bit 6   - Vertical flip
+	//	Bit 5   - Horizontal flip
+	//	Bit 3   - Tile is in bank 1
+	//	Bit 2-0 - Palette
+	bool          cgb   = gb->cgb.enabled();
+	const H_BYTE* map   = cgb ? gb->cgb.vram(0) : nullptr;
+	const H_BYTE* attrs = cgb ? gb->cgb.vram(1) : nullptr;
 
 	H_WORD row = ((H_BYTE)(ypos / 8)) * 32;
 	for (int pixel = 0; pixel < 160; pixel++)
 	{
-		H_BYTE xpos = (window && (pixel >= (*LCD.WX) - 7)) ? pixel - (*LCD.WX) - 7 : pixel + (*LCD.SCX);
+		H_BYTE xpos = (window && (pixel >= io[IO_WX] - 7)) ? pixel - io[IO_WX] - 7 : pixel + io[IO_SCX];
 		H_WORD col = (xpos / 8);
 		H_S_WORD num;
 
 		H_WORD addr = mem_area + row + col;
-		num = unsig ? (H_BYTE)read(addr) : (H_S_BYTE)read(addr);
+		H_BYTE id   = cgb ? map[addr - 0x8000] : read(addr);
+		num = unsig ? (H_BYTE)id : (H_S_BYTE)id;
 
 		H_WORD location = tile_data;
 		location += unsig ? (num * 16) : ((num + 128) * 16);
 
-		H_BYTE line = ypos % 8;
-		line *= 2;
-		H_BYTE byte1 = read(location + line);
-		H_BYTE byte2 = read(location + line + 1);
-		
-		int color_bit = xpos % 8;
-		color_bit -= 7;
-		color_bit *= -1;
+		int tx = xpos % 8;
+		int ty = ypos % 8;
+		int index = (location - 0x8000) >> 4;
+		H_BYTE attr = 0;
+		if (cgb)
+		{
+			attr = attrs[addr - 0x8000];
+			if (attr & 0x08) index += 384;
+			if (attr & 0x20) tx = 7 - tx;
+			if (attr & 0x40) ty = 7 - ty;
+		}
 
-		int color_num = byte2 & (1 << color_bit) ? 1 : 0;
-		color_num <<= 1;
-		color_num |= byte1 & (1 << color_bit) ? 1 : 0;
+		// Tile is already decoded, pick its pixel
+		const H_BYTE* tile = gb->tiles.tile(index);
+		int color_num = tile[ty * 8 + tx];
 
-		ScreenData color = LCD_GET_COLOR(color_num, 0xFF47);
+		ScreenData color = cgb ? gb->cgb.bg_color(attr & 0x07, color_num) : LCD_GET_COLOR(color_num, 0xFF47);
 
-		if (((*LCD.LY) < 0) || ((*LCD.LY) > 143) || (pixel < 0) || (pixel > 159))
+		if ((io[IO_LY] < 0) || (io[IO_LY] > 143) || (pixel < 0) || (pixel > 159))
 			continue;
 
-		gb->screen.set_pixel(pixel, (*LCD.LY), color);
+		gb->screen.set_pixel(pixel, io[IO_LY], color);
 	}
 }
 
@@ -1449,12 +1929,14 @@ void CPUZ80::CP()
 void CPUZ80::INC_8()
 {
 	CPU_8REG_INC(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Decrements 8-bit fetched data
 void CPUZ80::DEC_8()
 {
 	CPU_8REG_DEC(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Adds fetched 16-bit data to HL register
@@ -1497,6 +1979,7 @@ void CPUZ80::PREFIX()
 void CPUZ80::SWAP()
 {
 	CPU_8REG_SWAP(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Not yet implemented
@@ -1539,10 +2022,10 @@ void CPUZ80::HALT()
 	// TODO
 }
 
-// Not yet implemented
+// Switches CGB speed if KEY1 asks for it, otherwise not yet implemented
 void CPUZ80::STOP()
 {
-	// TODO
+	gb->cgb.speed_switch();
 }
 
 // Disables interupts after next instruction is executed
@@ -1587,42 +2070,49 @@ void CPUZ80::RRA()
 void CPUZ80::RLC()
 {
 	CPU_8REG_RLC(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Rotates fetched data through C flag
 void CPUZ80::RL()
 {
 	CPU_8REG_RL(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Rotates fetched data right
 void CPUZ80::RRC()
 {
 	CPU_8REG_RRC(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Rotates fetched data right through C flag
 void CPUZ80::RR()
 {
 	CPU_8REG_RR(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Shifts arithmetically fetched data left
 void CPUZ80::SLA()
 {
 	CPU_8REG_SLA(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Shifts arithmetically fetched data right
 void CPUZ80::SRA()
 {
 	CPU_8REG_SRA(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Shifts logically fetched data right
 void CPUZ80::SRL()
 {
 	CPU_8REG_SRL(fetched8_ptr);
+	wrote_ptr(fetched8_ptr);
 }
 
 // Tests fetched data bit of A register
@@ -1670,6 +2160,7 @@ void CPUZ80::BIT_L()
 // Tests fetched data bit of (HL)
 void CPUZ80::BIT_M_HL()
 {
+	gb->cdl.log_data(HL.reg);
 	CPU_TEST_BIT(read(HL), temp);
 }
 
@@ -1718,7 +2209,9 @@ void CPUZ80::SET_L()
 // Sets fetched data bit of (HL)
 void CPUZ80::SET_M_HL()
 {
-	CPU_SET_BIT(read_ptr(HL), temp);
+	H_BYTE* data = read_ptr(HL);
+	CPU_SET_BIT(data, temp);
+	wrote_ptr(data);
 }
 
 // Resets fetched data bit of A register
@@ -1766,7 +2259,9 @@ void CPUZ80::RES_L()
 // Resets fetched data bit of (HL)
 void CPUZ80::RES_M_HL()
 {
-	CPU_RESET_BIT(read_ptr(HL), temp);
+	H_BYTE* data = read_ptr(HL);
+	CPU_RESET_BIT(data, temp);
+	wrote_ptr(data);
 }
 
 // Jumps to the fetched data
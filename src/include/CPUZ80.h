@@ -1,5 +1,6 @@
 #pragma once
 #define CLOCKSPEED 4194304 // 4.194304 MHz as stated in the technical documentaion
+#define FRAME_CYCLES 70224 // 154 scanlines of 456 cycles, 59.7275 frames per second
 
 #include <iostream>
 #include <vector>
@@ -10,9 +11,103 @@
 #include "Screen.h"
 
 class GameBoy;
+class Recompiler;
+template<H_DWORD> struct Recompiled;
+
+/*
+	Hot CPU state
+
+	Everything CPU touches on every cycle or every instruction is kept in one
+	64 byte block at the start of CPUZ80, so it takes a single cache line
+	and instances don't share lines when many run side by side.
+	I/O registers CPU updates on its own (timers, LCD, interrupts) are reached
+	through one pointer to $FF00 instead of a pointer per register.
+
+	Registers and flags are described in CPUZ80, rarely touched state follows
+	this block there.
+*/
+struct alignas(64) CPUHot
+{
+public:
+	H_BYTE* io = nullptr; // $FF00. Indexed with CPUZ80::IO offsets
+
+protected:
+	H_BYTE* fetched8_ptr = nullptr; // This custom register is used by Data Functions to store 8-bit fetched data
+
+	// Counters are not a part of CPU, their purpose is to track cycles
+	// for different parts of emulatoin so CPU and other hadrdware
+	// work synchronous
+	struct {
+		H_QWORD clock_count       = 0; // Counts how many cycles have passed. Used as emulation timeline
+		H_QWORD instruction_count = 0; // Counts how many instructions have been fetched. Used as emulation timeline
+		H_WORD  timer_count       = 0; // Counts how many cycles have passed. Used to proceed timer
+		H_WORD  divider_count     = 0; // Counts how many cycles have passed. Used to proceed divider
+		H_WORD  scanline_count    = 0; // Counts how many cycles have passed. Used to draw LCD and determine its mode
+	
+		inline void inc()
+		{
+			clock_count++;
+			timer_count++;
+			divider_count++;
+		}
+
+		inline void reset()
+		{
+			clock_count = 0;
+			instruction_count = 0;
+			timer_count = 0;
+			divider_count = 0;
+			scanline_count = 0;
+		}
 
-class CPUZ80
+		inline void log()
+		{
+			std::cout << "Global count >> " << clock_count << std::endl
+				<< "Instruction count >> " << instruction_count << std::endl
+				<< "Timer count >> " << timer_count << std::endl
+				<< "Divider count >> " << divider_count << std::endl
+				<< "Scanline count >> " << scanline_count << std::endl
+				<< std::endl;
+		}
+	} counters;
+
+public:
+	Register AF = 0x0000;
+	Register BC = 0x0000;
+	Register DE = 0x0000;
+	Register HL = 0x0000;
+
+	Register PC = 0x0000; // Program Counter - points to the next instruction to be executed
+	Register SP = 0x0000; // Stack Pointer - points to the current stack position
+
+protected:
+	H_WORD temp = 0x0000; // A buffer register. Just for case
+
+	// Timer state, registers themselves are in memory
+	struct
+	{
+		H_WORD frequency = 1024; // Cycles per TIMA increment
+		bool   overflow  = false;
+	} clock;
+
+	H_BYTE opcode = 0x00; // Instruction byte
+	H_BYTE cycles = 0;	  // Counts how many cycles has remaining
+
+public:
+	bool PEI = false; // Pending Enable Interupts
+	bool PDI = false; // Pending Disable Interupts
+	bool IME = true;  // Interupt Master Enabled. This is one is neither register nor a memory pointer, 
+					  // it just says if registers are enabled or not
+	bool double_speed = false; // CGB KEY1 speed. Set with set_double_speed
+};
+static_assert(sizeof(CPUHot) == 64, "Hot CPU state must fit one cache line");
+
+class CPUZ80 : public CPUHot
 {
+	// Recompiled code calls data and instruction functions directly, see Recompiler.h
+	friend class Recompiler;
+	template<H_DWORD> friend struct Recompiled;
+
 public:
 	CPUZ80();
 	~CPUZ80();
@@ -33,9 +128,74 @@ public:
 
 	// Checks if all desired cycles passed
 	bool complete();
+
+	// Executes one whole instruction
+	void step();
+
+	// Runs given number of cycles. Goes through recompiled blocks when they are
+	// installed and no debugging tool watches single instructions, so it may
+	// run a few cycles over to finish a block. Returns true if it stopped early
+	// at a breakpoint, before its instruction runs
+	bool run(H_QWORD);
+
+	// Addresses run stops at, one flag per address, nullptr for none.
+	// Fast paths step over addresses, they are off while any breakpoint is set
+	inline void set_breakpoints(const std::vector<bool>* map) { m_breakpoints = map; }
+
+	// Recompiled basic block. Returns false if it didn't run, interpreter takes over
+	typedef bool (*BLOCK)(CPUZ80&, H_QWORD end);
+	void set_blocks(std::vector<BLOCK>);	// Entry for every ROM address, empty removes them
+	inline size_t blocks() const { return m_block_count; }
+
+	// Copy and fill loops done as one memory operation, see loop_run
+	inline void    set_loop_hle(bool on) { m_loop_hle = on; }
+	inline H_QWORD loop_bytes() const    { return m_loop_bytes; }
+
+	// Frequent instruction pairs run by one handler, see fused_run
+	inline void    set_fusion(bool on)   { m_fusion = on; }
+	inline H_QWORD fused_pairs() const   { return m_fused_pairs; }
 	
 	// Direct Memory Access Transfer
 	void DMA(H_BYTE);
+
+	// Everything CPU needs to continue emulation from the same point.
+	// Pointers to special registers are not saved as they always point to the same memory
+	struct STATE
+	{
+		Register AF, BC, DE, HL, PC, SP;
+		bool     PEI = false, PDI = false, IME = false;
+		bool     clock_overflow  = false;
+		int      clock_frequency = 1024;
+		H_WORD   temp   = 0x0000;
+		H_BYTE   opcode = 0x00;
+		H_BYTE   cycles = 0;
+		H_QWORD  clock_count = 0, instruction_count = 0;
+		H_WORD   timer_count = 0, divider_count = 0, scanline_count = 0;
+		bool     double_speed = false;
+		H_QWORD  speed_clock = 0, speed_dots = 0;
+	};
+	void save_state(STATE&) const;
+	void load_state(const STATE&);
+
+	inline H_QWORD cycle_count()       const { return counters.clock_count; }
+	inline H_QWORD instruction_count() const { return counters.instruction_count; }
+
+	/*
+		Double speed
+
+		CGB CPU can run at twice the clock. Timers and DIV go with CPU, LCD and
+		sound keep their rate, so in double speed they are clocked on every
+		other CPU cycle. Cycle counts CPU deals with stay CPU cycles, LCD and
+		sound time is derived from them
+	*/
+	void set_double_speed(bool);
+	// Cycles of LCD and sound clock, 4194304 per second in both speeds
+	inline H_QWORD dot_count() const
+	{
+		return m_speed_dots + ((counters.clock_count - m_speed_clock) >> (double_speed ? 1 : 0));
+	}
+	// CPU cycles that take as long as given LCD cycles
+	inline H_QWORD cpu_cycles(H_QWORD dots) const { return double_speed ? dots * 2 : dots; }
 public:
 	/*
 		FLAGS
@@ -84,21 +244,14 @@ public:
 		SP    -    -    Stack Pointer
 		PC    -    -    Program Counter/Pointer
 
-		Register structure uses union to imitate this behavior
+		Register structure uses union to imitate this behavior.
+		Registers are declared in CPUHot
 	*/
 
-	Register AF = 0x0000;
-	Register BC = 0x0000;
-	Register DE = 0x0000;
-	Register HL = 0x0000;
-
-	Register PC = 0x0000; // Program Counter - points to the next instruction to be executed
-	Register SP = 0x0000; // Stack Pointer - points to the current stack position
-
 	// SPECIAL REGISTERS
 	/*
-		In most cases these boys are stored in the memory and they are not registers
-		but pointers to the specific memory address
+		In most cases these boys are stored in the memory and they are not registers.
+		CPU reaches them at fixed offsets from io pointer, which points to $FF00
 	*/
 	/*
 		Interrupts.
@@ -113,12 +266,10 @@ public:
 		so V-Blank has the highest priority meaning if this interupt and another interupt are both requested
 		in the Interupt Request Register then V-Blank will be serviced first.
 	*/
-	bool    PEI = false;  // Pending Enable Interupts
-	bool    PDI = false;  // Pending Disable Interupts
-	bool    IME = true;   // Interupt Master Enabled. This is one is neither register nor a memory pointer, 
-						  // it just says if registers are enabled or not
-	H_BYTE* IE = nullptr; // Interupt Enable. Points to $FFFF. Determines which interupts are allowed
-	H_BYTE* IF = nullptr; // Interupt Request. Points to $FF0F. Determines which interupts are requested
+	enum IO
+	{
+		IO_IE   = 0xFF, // Interupt Enable. $FFFF. Determines which interupts are allowed
+		IO_IF   = 0x0F, // Interupt Request. $FF0F. Determines which interupts are requested
 	/*
 		Timer
 		GameBoy has internal timer. It has nothing to do with CPU clock!!!
@@ -147,31 +298,19 @@ public:
 		If overflow happens it resets to zero. When CPU tries to write data to
 		DIV address it sets it to zero.
 	*/
-	struct
-	{
-		H_BYTE* TIMA  = nullptr; // FF05
-		H_BYTE* TMA   = nullptr; // FF06
-		H_BYTE* TAC   = nullptr; // FF07
-		bool overflow = false;
-		int frequency = 1024;
-
-		inline void reset() { (*TIMA) = (*TMA); }
-	} clock;
-	H_BYTE* DIV = nullptr; // FF04
-
-	/*
-		LCD
-
-		If (*LY) is 144 it is time to VBlank(0x00) interrupt
-	*/
-	struct {
-		const int scanlines = 153;
-		const int invisible_scanlines = 9;
-		const int frequency = 456;
-
-		H_BYTE* LY   = nullptr; // FF44. Read operations sets to zero
-		H_BYTE* LYC  = nullptr; // FF45
-		H_BYTE* STAT = nullptr; // FF41. LCD status
+		IO_DIV  = 0x04,
+		IO_TIMA = 0x05,
+		IO_TMA  = 0x06,
+		IO_TAC  = 0x07,
+
+		/*
+			LCD
+
+			If LY is 144 it is time to VBlank(0x00) interrupt
+		*/
+		IO_LY   = 0x44, // FF44. Read operations sets to zero
+		IO_LYC  = 0x45, // FF45
+		IO_STAT = 0x41, // FF41. LCD status
 								// Bits 6-3 - Interrupt section, 6th bit is LYC=LY
 								// Bit 5 - Mode 10
 								// Bit 4 - Mode 01
@@ -186,7 +325,7 @@ public:
 								//		01: V-Blank
 								//		10: Search RAM for Sprites
 								//		11: Transfering data to LCD driver
-		H_BYTE* LCDC = nullptr; // FF40. $91 on reset
+		IO_LCDC = 0x40, // FF40. $91 on reset
 								// Bit 7: Control mode
 								//		 0: Disable
 								//		 1: Enable
@@ -211,20 +350,30 @@ public:
 								// Bit 0: Backgound and Window display
 								//		 0: off
 								//		 1: on
-		H_BYTE* SCY = nullptr;  // FF42. Scroll Y
-								// Background Y screen position
-		H_BYTE* SCX = nullptr;  // FF43. Scroll X
-								// Background X screen position
-		H_BYTE* WY  = nullptr;  // FF4A. Window Y position
-								// 0 <= WY <= 143
-		H_BYTE* WX  = nullptr;  // FF4B. Scroll X
-								// 0 <= WY <= 166
+		IO_SCY  = 0x42, // FF42. Scroll Y
+						// Background Y screen position
+		IO_SCX  = 0x43, // FF43. Scroll X
+						// Background X screen position
+		IO_WY   = 0x4A, // FF4A. Window Y position
+						// 0 <= WY <= 143
+		IO_WX   = 0x4B, // FF4B. Scroll X
+						// 0 <= WY <= 166
+	};
+
+	struct {
+		enum
+		{
+			scanlines = 153,
+			invisible_scanlines = 9,
+			frequency = 456
+		};
 
 		Screen* s = nullptr;
-		inline bool enabled() { return ((*LCDC) & (1u << 7)) > 0 ? true : false; }
-		inline void reset() { (*LY) = 0; (*STAT) &= 0xFC; (*STAT) |= 1 << 0; }
 	} LCD;
 
+	inline bool LCD_ENABLED() const { return (io[IO_LCDC] & (1u << 7)) > 0; }
+	inline void LCD_RESET() { io[IO_LY] = 0; io[IO_STAT] &= 0xFC; io[IO_STAT] |= 1 << 0; }
+
 private:
 	// Interrupt bits
 	enum
@@ -236,46 +385,85 @@ private:
 		INT_Joypad = 4, // Bit 4
 	};
 
-	H_BYTE* fetched8_ptr  = nullptr; // This custom register is used by Data Functions to store 8-bit fetched data
+	// Hot state is in CPUHot. This one is touched by 16-bit instructions only
 	H_WORD* fetched16_ptr = nullptr; // This custom register is used by Data Functions to store 16-bit fetched data
-	H_WORD  temp		  = 0x0000;  // A buffer register. Just for case
-	H_BYTE  opcode        = 0x00;    // Instruction byte
-	H_BYTE  cycles        = 0;	     // Counts how many cycles has remaining
-	
-	// Counters are not a part of CPU, their purpose is to track cycles
-	// for different parts of emulatoin so CPU and other hadrdware
-	// work synchronous
-	struct {
-		H_DWORD clock_count    = 0; // Counts how many cycles have passed. Emulator doesn't use it's only for debugging
-		H_WORD  timer_count    = 0; // Counts how many cycles have passed. Used to proceed timer
-		H_WORD  divider_count  = 0; // Counts how many cycles have passed. Used to proceed divider
-		H_WORD  scanline_count = 0; // Counts how many cycles have passed. Used to draw LCD and determine its mode
-	
-		inline void inc()
-		{
-			clock_count++;
-			timer_count++;
-			divider_count++;
-			scanline_count++;
-		}
 
-		inline void reset()
-		{
-			clock_count = 0;
-			timer_count = 0;
-			divider_count = 0;
-			scanline_count = 0;
-		}
 
-		inline void log()
-		{
-			std::cout << "Global count >> " << clock_count << std::endl
-				<< "Timer count >> " << timer_count << std::endl
-				<< "Divider count >> " << divider_count << std::endl
-				<< "Scanline count >> " << scanline_count << std::endl
-				<< std::endl;
-		}
-	} counters;
+	// Recompiled blocks by address
+	std::vector<BLOCK> m_blocks;
+	size_t             m_block_count = 0;
+	H_QWORD            m_overrun = 0;	// Cycles last run went past its end
+
+	// CPU and LCD cycle counts when speed was switched last
+	H_QWORD m_speed_clock = 0;
+	H_QWORD m_speed_dots  = 0;
+
+	// Same steps interpreter takes, in the same order, for recompiled code
+	bool block_valid(H_WORD, const H_BYTE*, size_t);	// Code in memory is still what was compiled
+	bool block_begin(H_BYTE, H_BYTE, H_QWORD end);		// Instruction fetch. False once end is reached
+	void block_prefix(H_BYTE, H_BYTE);					// $CB instruction fetch
+	void block_tick();									// Remaining cycles of instruction
+	bool block_end(H_WORD);								// Ticks and checks PC went where expected
+
+	/*
+		Copy and fill loops
+
+		Loops like
+			.fill  LD (HL+),A / DEC B / JR NZ,.fill
+			.copy  LD A,(DE) / LD (HL+),A / INC DE / DEC BC / LD A,B / OR C / JR NZ,.copy
+		spend most of their time in instruction dispatch. When one of them is
+		found at PC its iterations are done with memset or memmove, registers and
+		flags are set to what the last iteration leaves and every cycle is still
+		ticked, so timers and LCD see the same timeline.
+
+		It is only done where nothing could tell the difference:
+			interrupts are disabled, so nothing can jump out in the middle
+			memory touched is plain RAM, not I/O, ROM or the loop itself
+			no joypad or serial event is due, no LCD line is drawn while VRAM or OAM
+			is written. Loop is done in parts between those events
+	*/
+	struct LOOP
+	{
+		H_BYTE  size         = 0;		// Bytes of code
+		H_BYTE  instructions = 0;
+		H_BYTE  cycles       = 0;		// One iteration
+		H_WORD* dst          = nullptr;
+		int     dst_step     = 1;
+		H_WORD* src          = nullptr;	// Copy source, nullptr fills with A
+		H_BYTE* counter8     = nullptr;	// DEC r counter
+		bool    counter16    = false;	// DEC BC / LD A,B / OR C counter
+		H_WORD* fetched16    = nullptr;	// fetched16_ptr after an iteration
+		bool    temp_hl      = false;	// INC HL leaves old HL in temp
+	};
+	bool loop_match(H_WORD, LOOP&);
+	bool loop_run(H_QWORD end);			// False if there is no loop at PC or it can't be done now
+
+	bool    m_loop_hle   = true;
+	H_QWORD m_loop_bytes = 0;
+
+	/*
+		Instruction pairs
+
+		Pairs that follow each other in almost every loop
+			LD A,(HL+) / LD (DE),A    LD A,(DE) / LD (HL+),A
+			DEC r / JR NZ             CP n / JR cc
+		are run by one handler that calls data and instruction functions of
+		both directly, so they can be inlined, and ticks both instructions in
+		one go. It skips the table lookups and the per cycle trip through
+		cpu_clock of the second instruction. Interrupt taken during the first
+		instruction ends the pair there.
+	*/
+	typedef void (CPUZ80::* FUNC)(void);
+	template<FUNC DATA1, FUNC OP1, FUNC DATA2, FUNC OP2>
+	bool fused(H_BYTE, H_BYTE, H_QWORD end);
+	bool fused_run(H_QWORD end);		// False if there is no pair at PC
+
+	bool    m_fusion      = true;
+	H_QWORD m_fused_pairs = 0;
+
+	const std::vector<bool>* m_breakpoints = nullptr;
+
+	inline void tick();	// One cycle of everything but instruction fetch
 
 	// GameBoy instance
 	GameBoy* gb = nullptr;
@@ -285,6 +473,7 @@ private:
 	void    write(Register, H_BYTE);
 	H_BYTE  read(Register);
 	H_BYTE* read_ptr(Register);
+	void    wrote_ptr(const H_BYTE*);	// Instructions that change fetched byte in place call it after
 
 	struct INSTRUCTION
 	{
@@ -293,8 +482,8 @@ private:
 		void (CPUZ80::* data_func)(void) = nullptr;
 		H_BYTE cycles = 0;
 	};
-	std::vector<INSTRUCTION> opcodes;
-	std::vector<INSTRUCTION> prefixes;
+	static const std::vector<INSTRUCTION> opcodes;	// Shared by all instances
+	static const std::vector<INSTRUCTION> prefixes;
 
 private:
 	// Functions to manipulate F register
@@ -354,6 +543,7 @@ private:
 	void CPU_PERFORM_INT();								 // Performs interupts. Checks if any interupts is requsted and services them if true
 	void CPU_REQUEST_INT(size_t);						 // Requests interup. Sets specific bit in IF
 	void CPU_PENDING_IME();								 // Checks pending IME switch
+	void CPU_LOG_COVERAGE(H_WORD);							 // Marks current instruction bytes in Code/Data Logger
 	void CPU_CLOCK_INCREMENT();							 // Increments clock
 	void CPU_TIMER_INCREMENT();							 // Increments timer
 	void CPU_TIMER_CHECK();							     // Checks timer for overflow
@@ -1,47 +1,208 @@
 #define _CRT_SECURE_NO_WARNINGS
 
 #include "Cartridge.h"
+#include "Archive.h"
 
 #include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <fstream>
 
-Cartridge::Cartridge(const char* filename)
-	: m_memory{ 0 }
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _CARTRIDGE_SSE2
+#include <emmintrin.h>
+#endif
+
+// Sum of n bytes
+static H_QWORD sum_bytes(const H_BYTE* p, size_t n)
+{
+	H_QWORD sum = 0;
+	size_t i = 0;
+
+#ifdef _CARTRIDGE_SSE2
+	// SAD against zero adds 8 bytes into each 64-bit half. Four accumulators keep loads independent
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc0 = zero, acc1 = zero, acc2 = zero, acc3 = zero;
+	for (; i + 64 <= n; i += 64)
+	{
+		acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(p + i)), zero));
+		acc1 = _mm_add_epi64(acc1, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(p + i + 16)), zero));
+		acc2 = _mm_add_epi64(acc2, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(p + i + 32)), zero));
+		acc3 = _mm_add_epi64(acc3, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(p + i + 48)), zero));
+	}
+	for (; i + 16 <= n; i += 16)
+		acc0 = _mm_add_epi64(acc0, _mm_sad_epu8(_mm_loadu_si128((const __m128i*)(p + i)), zero));
+
+	__m128i acc = _mm_add_epi64(_mm_add_epi64(acc0, acc1), _mm_add_epi64(acc2, acc3));
+	acc = _mm_add_epi64(acc, _mm_srli_si128(acc, 8));
+	_mm_storel_epi64((__m128i*)&sum, acc);
+#endif
+
+	for (; i < n; i++)
+		sum += p[i];
+	return sum;
+}
+
+H_BYTE CartridgeHeader::compute_header_checksum(const H_BYTE* rom)
+{
+	// x = x - byte - 1 for each of 25 bytes is the same as -(sum + 25)
+	return (H_BYTE)(0 - sum_bytes(rom + 0x134, 0x14D - 0x134) - (0x14D - 0x134));
+}
+
+H_WORD CartridgeHeader::compute_global_checksum(const H_BYTE* rom, size_t size)
+{
+	return (H_WORD)(sum_bytes(rom, size) - rom[0x14E] - rom[0x14F]);
+}
+
+bool CartridgeHeader::parse(const H_BYTE* rom, size_t size, CartridgeHeader& h)
+{
+	h = CartridgeHeader();
+	if (size < 0x150)
+		return false;
+
+	// Title is shorter when 0143 is CGB flag
+	size_t title_end = (rom[0x143] & 0x80) ? 0x143 : 0x144;
+	for (size_t i = 0x134; i < title_end && rom[i] != 0x00; i++)
+		h.title += (char)rom[i];
+
+	h.cgb  = rom[0x143];
+	h.type = rom[0x147];
+	switch (h.type)
+	{
+	case 0x00: h.mbc = MBC_NONE; break;								// ROM ONLY
+	case 0x01: case 0x02: h.mbc = MBC_1; break;						// MBC1, MBC1+RAM
+	case 0x03: h.mbc = MBC_1; h.battery = true; break;				// MBC1+RAM+BATTERY
+	case 0x05: h.mbc = MBC_2; break;								// MBC2
+	case 0x06: h.mbc = MBC_2; h.battery = true; break;				// MBC2+BATTERY
+	case 0x08: h.mbc = MBC_NONE; break;								// ROM+RAM
+	case 0x09: h.mbc = MBC_NONE; h.battery = true; break;			// ROM+RAM+BATTERY
+	case 0x0F: case 0x10: h.mbc = MBC_3; h.timer = true; h.battery = true; break; // MBC3+TIMER+(RAM)+BATTERY
+	case 0x11: case 0x12: h.mbc = MBC_3; break;						// MBC3, MBC3+RAM
+	case 0x13: h.mbc = MBC_3; h.battery = true; break;				// MBC3+RAM+BATTERY
+	case 0x19: case 0x1A: case 0x1C: case 0x1D: h.mbc = MBC_5; break;	// MBC5, with RAM and/or rumble
+	case 0x1B: case 0x1E: h.mbc = MBC_5; h.battery = true; break;	// MBC5+(RUMBLE)+RAM+BATTERY
+	default:   h.mbc = MBC_UNSUPPORTED; break;						// MMM01, MBC6, MBC7, camera, HuC...
+	}
+
+	H_BYTE rom_code = rom[0x148];
+	if (rom_code <= 0x08)
+		h.rom_size = (size_t)0x8000 << rom_code;
+	else if (rom_code >= 0x52 && rom_code <= 0x54)
+		h.rom_size = (size_t)(rom_code == 0x52 ? 72 : rom_code == 0x53 ? 80 : 96) * 0x4000;
+	else
+		return false;
+
+	static const size_t ram_sizes[] = { 0, 0x800, 0x2000, 0x8000, 0x20000, 0x10000 };
+	H_BYTE ram_code = rom[0x149];
+	if (ram_code >= sizeof(ram_sizes) / sizeof(ram_sizes[0]))
+		return false;
+	h.ram_size = (h.mbc == MBC_2) ? 512 : ram_sizes[ram_code];
+
+	h.header_checksum = rom[0x14D];
+	h.global_checksum = (H_WORD)((rom[0x14E] << 8) | rom[0x14F]);
+	h.header_valid = compute_header_checksum(rom) == h.header_checksum;
+	return true;
+}
+
+void CartridgeHeader::check_global(const H_BYTE* rom, size_t size)
+{
+	global_valid = compute_global_checksum(rom, size) == global_checksum;
+}
+
+const char* CartridgeHeader::mbc_name() const
 {
-	//m_memory = new H_BYTE[_CARTRIDGE_SIZE];
-	for (int i = 0; i < _CARTRIDGE_SIZE; ++i)
-		m_memory[i] = 0;
+	switch (mbc)
+	{
+	case MBC_NONE: return "none";
+	case MBC_1:    return "MBC1";
+	case MBC_2:    return "MBC2";
+	case MBC_3:    return "MBC3";
+	case MBC_5:    return "MBC5";
+	default:       return "unsupported";
+	}
+}
 
-	std::cout << "Loading: " << filename << std::endl;
+Cartridge::Cartridge(const char* filename, FILE* log)
+{
+	fprintf(log, "Loading: %s\n", filename);
+	auto start = std::chrono::steady_clock::now();
 
-	FILE* pFile = nullptr;
-	pFile = fopen(filename, "rb");
-	if (pFile == nullptr)
+	if (!m_file.open(filename))
 	{
 		std::cerr << "ROM file failure" << std::endl;
 		exit(1);
 	}
 
-	fseek(pFile, 0, SEEK_END);
-	long lSize = ftell(pFile);
-	rewind(pFile);
-	printf("Game size: %d\n", (int)lSize);
+	// Compressed ROM has its size stored in archive
+	Archive::ITEM item;
+	if (Archive::detect(m_file.data(), m_file.size()) != Archive::FORMAT_NONE)
+	{
+		if (!Archive::locate(m_file.data(), m_file.size(), item))
+		{
+			std::cerr << "Archive failure, it is damaged or holds no ROM" << std::endl;
+			exit(1);
+		}
+		m_size = item.size;
+		fprintf(log, "Game size: %d (%s%s%s, %d packed)\n", (int)m_size, item.format == Archive::FORMAT_GZIP ? "gzip" : "zip",
+			item.name.empty() ? "" : " ", item.name.c_str(), (int)item.packed);
+	}
+	else
+	{
+		m_size = m_file.size();
+		fprintf(log, "Game size: %d\n", (int)m_size);
+	}
 
-	size_t result = fread(m_memory, 1, lSize, pFile);
-	if (result != lSize)
+	if (m_size > _CARTRIDGE_MAX_SIZE)
 	{
-		std::cerr << "ROM read failure" << std::endl;
+		std::cerr << "Error: ROM too big for memory" << std::endl;
 		exit(1);
 	}
 
-	if (lSize > _CARTRIDGE_SIZE)
-		std::cerr << "Error: ROM too big for memory" << std::endl;
+	// Unpacked straight into ROM buffer, archive is read from its mapping
+	if (item.format != Archive::FORMAT_NONE)
+	{
+		m_memory.assign(std::max<size_t>((m_size + 0x3FFF) & ~(size_t)0x3FFF, 0x8000), 0x00);
+		if (!Archive::extract(item, m_memory.data()))
+		{
+			std::cerr << "ROM decompression failure" << std::endl;
+			exit(1);
+		}
+		m_file.close();
+	}
+	const H_BYTE* data = m_file.data() != nullptr ? m_file.data() : m_memory.data();
 
-	fclose(pFile);
-}
+	if (!CartridgeHeader::parse(data, m_size, header))
+		std::cerr << "Warning: ROM header is not valid, running as 32kB ROM without MBC" << std::endl;
+	else
+	{
+		header.check_global(data, m_size);
+		fprintf(log, "Title: %s, MBC: %s (type %02X), ROM: %dkB, RAM: %dkB%s\n", header.title.c_str(), header.mbc_name(), header.type,
+			(int)(header.rom_size / 1024), (int)(header.ram_size / 1024), header.battery ? ", battery" : "");
+		if (header.mbc == CartridgeHeader::MBC_UNSUPPORTED)
+			std::cerr << "Warning: cartridge type is not supported, running without MBC" << std::endl;
+		if (!header.header_valid)
+			std::cerr << "Warning: header checksum mismatch" << std::endl;
+		if (!header.global_valid)
+			std::cerr << "Warning: global checksum mismatch" << std::endl;
+	}
 
-Cartridge::~Cartridge()
-{
-	delete[] m_memory;
-}
\ No newline at end of file
+	// Every bank header claims is addressable, missing part reads as zeros
+	size_t size = std::max<size_t>({ (m_size + 0x3FFF) & ~(size_t)0x3FFF, header.rom_size, 0x8000 });
+	if (m_file.data() != nullptr && size == m_size)
+		m_rom = m_file.data();
+	else
+	{
+		if (m_file.data() != nullptr)
+		{
+			m_memory.assign(size, 0x00);
+			std::copy(m_file.data(), m_file.data() + m_size, m_memory.begin());
+			m_file.close();
+		}
+		else
+			m_memory.resize(size, 0x00);
+		m_rom = m_memory.data();
+	}
+	m_banks = size / 0x4000;
+
+	fprintf(log, "Loaded in %.3f ms\n", std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+}
@@ -1,13 +1,73 @@
 #pragma once
-#define _CARTRIDGE_SIZE 0x200000
+#define _CARTRIDGE_MAX_SIZE 0x800000 // 8MB, 512 banks of MBC5
 
 #include "core.h"
+#include "MappedFile.h"
 
-struct Cartridge
+#include <cstddef>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+/*
+	Cartridge Header
+
+	Every ROM carries a header at 0100-014F
+		0134-0143 - Title, upper case ASCII padded with zeros.
+		            Newer games use 013F-0142 for manufacturer code and 0143 for CGB flag
+		0147      - Cartridge type, selects memory bank controller and what is attached to it
+		0148      - ROM size, 32kB << n (0x52-0x54 are 72, 80 and 96 banks)
+		0149      - External RAM size
+		014D      - Header checksum, x = x - byte - 1 over 0134-014C. Boot ROM locks up if it fails
+		014E-014F - Global checksum, big endian sum of every ROM byte but these two. Never verified by hardware
+
+	Both checksums are sums of bytes, they are computed with SSE2 when compiler
+	targets it. Parsing reads nothing past the header, global sum is a separate pass
+	that reads every byte once, so checking a big ROM library is bound by disk, not by CPU.
+*/
+struct CartridgeHeader
 {
-	Cartridge(const char*);
-	~Cartridge();
+	enum MBC_TYPE
+	{
+		MBC_NONE = 0, MBC_1, MBC_2, MBC_3, MBC_5, MBC_UNSUPPORTED
+	};
+
+	std::string title;
+	H_BYTE   type     = 0x00;		// Raw 0147
+	H_BYTE   cgb      = 0x00;		// Raw 0143
+	MBC_TYPE mbc      = MBC_NONE;
+	bool     battery  = false;		// RAM survives power off
+	bool     timer    = false;		// MBC3 real time clock
+	size_t   rom_size = 0x8000;		// From 0148
+	size_t   ram_size = 0;			// From 0149, or 512 for MBC2 internal RAM
+
+	H_BYTE   header_checksum = 0x00;	// Stored in ROM
+	H_WORD   global_checksum = 0x0000;
+	bool     header_valid = false;		// Stored sums match computed ones
+	bool     global_valid = false;
+
+	// False if ROM is shorter than header or size codes are unknown. Leaves global_valid false
+	static bool parse(const H_BYTE* rom, size_t size, CartridgeHeader&);
+	void check_global(const H_BYTE* rom, size_t size);	// Sums whole ROM into global_valid
 
-	H_BYTE m_memory[_CARTRIDGE_SIZE];
+	// Computed sums, see above
+	static H_BYTE compute_header_checksum(const H_BYTE* rom);
+	static H_WORD compute_global_checksum(const H_BYTE* rom, size_t size);
+
+	const char* mbc_name() const;
 };
 
+struct Cartridge
+{
+	Cartridge(const char*, FILE* log = stdout);	// Loading messages go to log, errors to stderr
+
+	CartridgeHeader header;
+
+	const H_BYTE* m_rom = nullptr;	// Whole ROM, at least 32kB and size in header, in whole 16kB banks
+	size_t m_banks = 2;				// Banks readable through m_rom
+	size_t m_size  = 0;				// ROM file size
+
+private:
+	MappedFile          m_file;		// ROM is used straight from mapped file when its size is right
+	std::vector<H_BYTE> m_memory;	// Zero padded copy otherwise
+};
@@ -3,10 +3,17 @@
 
 void CartridgeLoader::load_cartridge(Cartridge& cartrdige)
 {
-	for (int i = 0; i < _CARTRIDGE_SIZE; i++)
-	{
-		write(i + 0x100, cartrdige.m_memory[i]);
-	}
+	// Two 16kB ROM banks are visible at 0000-7FFF, controller picks which
+	gb->mbc.load(cartrdige);
+	m_loaded = true;
+
+	// CGB cartridge starts with registers CGB boot ROM leaves
+	gb->cgb.load(cartrdige);
+	if (gb->cgb.enabled())
+		gb->cpu.reset();
+
+	// Recompiled code of this ROM if it was built in
+	Recompiler::install(gb->cpu, cartrdige.m_rom, cartrdige.m_size);
 }
 
 void CartridgeLoader::write(H_WORD addr, H_BYTE data)
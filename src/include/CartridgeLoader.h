@@ -9,7 +9,10 @@ class CartridgeLoader
 public:
 	inline void connect_device(GameBoy* instance) { gb = instance; };
 	void load_cartridge(Cartridge&);
+	inline bool loaded() const { return m_loaded; }
 private:
+	bool m_loaded = false;
+
 	// GameBoy instance
 	GameBoy* gb = nullptr;
 	void    write(H_WORD, H_BYTE);
@@ -0,0 +1,80 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "CodeDataLogger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+
+void CodeDataLogger::attach(size_t rom_size)
+{
+	m_map.assign(rom_size, 0x00);
+	m_mapped = rom_size > 0 ? 0x8000 : 0;
+}
+
+void CodeDataLogger::detach()
+{
+	m_map.clear();
+	m_map.shrink_to_fit();
+	m_mapped = 0;
+}
+
+void CodeDataLogger::clear()
+{
+	std::fill(m_map.begin(), m_map.end(), 0x00);
+}
+
+bool CodeDataLogger::load(const char* filename)
+{
+	FILE* pFile = fopen(filename, "rb");
+	if (pFile == nullptr)
+		return false;
+
+	std::vector<H_BYTE> flags(m_map.size(), 0x00);
+	size_t result = fread(flags.data(), 1, flags.size(), pFile);
+	fclose(pFile);
+
+	if (result != m_map.size())
+	{
+		std::cerr << "CDL size doesn't match ROM: " << filename << std::endl;
+		return false;
+	}
+
+	for (size_t i = 0; i < m_map.size(); i++)
+		m_map[i] |= flags[i];
+
+	return true;
+}
+
+bool CodeDataLogger::save(const char* filename) const
+{
+	FILE* pFile = fopen(filename, "wb");
+	if (pFile == nullptr)
+	{
+		std::cerr << "CDL write failure: " << filename << std::endl;
+		return false;
+	}
+
+	size_t result = fwrite(m_map.data(), 1, m_map.size(), pFile);
+	fclose(pFile);
+
+	return result == m_map.size();
+}
+
+void CodeDataLogger::log_summary() const
+{
+	size_t code = 0, opcodes = 0, data = 0, both = 0;
+	for (H_BYTE f : m_map)
+	{
+		code    += (f & CDL_CODE) ? 1 : 0;
+		opcodes += (f & CDL_OPCODE) ? 1 : 0;
+		data    += (f & CDL_DATA) ? 1 : 0;
+		both    += ((f & CDL_CODE) && (f & CDL_DATA)) ? 1 : 0;
+	}
+
+	std::cout << "ROM size >> " << m_map.size() << std::endl
+		<< "Code bytes >> " << code << " (" << opcodes << " instructions)" << std::endl
+		<< "Data bytes >> " << data << std::endl
+		<< "Code and data >> " << both << std::endl
+		<< std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+#include "core.h"
+
+#include <cstddef>
+#include <vector>
+
+/*
+	Code/Data Logger
+
+	Keeps one byte of flags per ROM byte and records how CPU used it.
+	CPU addresses are turned to ROM offsets through banks MBC has mapped
+	at 0000-3FFF and 4000-7FFF, so every bank has its own flags.
+	Exported file is raw flags, one byte per ROM byte in ROM order, like
+	the .cdl files of other emulators, so existing tools can read bits 0-1
+
+	Bit 0 - Code. Byte was executed, either as an opcode or as an operand
+	Bit 1 - Data. Byte was read as data
+	Bit 4 - Opcode. Byte was the first byte of an executed instruction
+
+	Logging is off until attach() is called. While it is off every log function
+	is a single compare, so CPU and bus call them unconditionally
+*/
+class CodeDataLogger
+{
+public:
+	enum FLAGS
+	{
+		CDL_CODE   = (1 << 0),
+		CDL_DATA   = (1 << 1),
+		CDL_OPCODE = (1 << 4)
+	};
+
+	void attach(size_t);			// Starts logging for ROM of given size
+	void detach();					// Stops logging and drops the map
+	void clear();					// Resets all flags
+
+	bool load(const char*);			// Merges flags from previously exported file
+	bool save(const char*) const;	// Exports flags
+	void log_summary() const;		// Prints coverage statistics
+
+	inline bool enabled() const { return m_mapped > 0; }
+	inline const std::vector<H_BYTE>& map() const { return m_map; }
+
+	// Called by MBC whenever it maps other banks
+	inline void map_banks(H_WORD bank0, H_WORD bank)
+	{
+		m_bank[0] = (size_t)bank0 * 0x4000;
+		m_bank[1] = (size_t)bank * 0x4000;
+	}
+
+	// ROM offset of CPU address 0000-7FFF in banks mapped now
+	inline size_t offset(H_WORD addr) const { return m_bank[addr >> 14] + (addr & 0x3FFF); }
+	inline H_BYTE flags(H_WORD addr) const { size_t o = offset(addr); return o < m_map.size() ? m_map[o] : 0x00; }
+
+	// Address is CPU address. Only 0000-7FFF is ROM
+	inline void log_opcode(H_WORD addr) { if (addr < m_mapped) flag(addr, CDL_CODE | CDL_OPCODE); }
+	inline void log_operand(H_WORD addr) { if (addr < m_mapped) flag(addr, CDL_CODE); }
+	inline void log_data(H_WORD addr) { if (addr < m_mapped) flag(addr, CDL_DATA); }
+
+private:
+	std::vector<H_BYTE> m_map;
+	H_DWORD m_mapped = 0;					// Size of ROM window. Zero when logging is off
+	size_t  m_bank[2] = { 0x0000, 0x4000 };	// ROM offsets of 0000-3FFF and 4000-7FFF
+
+	// ROM shorter than 32 kB leaves end of the window without flags
+	inline void flag(H_WORD addr, H_BYTE f) { size_t o = offset(addr); if (o < m_map.size()) m_map[o] |= f; }
+};
\ No newline at end of file
@@ -9,15 +9,17 @@ std::string Debugger::hex(uint32_t n, uint8_t d)
 	return s;
 }
 
-void Debugger::draw_ram(int x, int y, uint16_t addr, int rows, int columns)
+void Debugger::draw_ram(int x, int y, int window, int rows, int columns)
 {
 	int ram_x = x, ram_y = y;
+	uint16_t addr = m_view.ram_addr[window];
+	const H_BYTE* data = m_view.ram[window];
 	for (int row = 0; row < rows; row++)
 	{
 		std::string offset = "$" + hex(addr, 4) + ":";
 		for (int col = 0; col < columns; col++)
 		{
-			offset += " " + hex(gb->read(addr), 2);
+			offset += " " + hex(*data++, 2);
 			addr++;
 		}
 		DrawString(ram_x, ram_y, offset, olc::GREEN);
@@ -28,10 +30,10 @@ void Debugger::draw_ram(int x, int y, uint16_t addr, int rows, int columns)
 void Debugger::draw_cpu(int x, int y)
 {
 	DrawString(x,       y, "FLAGS:", olc::WHITE);
-	DrawString(x + 64,  y, "Z", gb->cpu.AF.lo & CPUZ80::Z ? olc::BLUE : olc::RED);
-	DrawString(x + 80,  y, "N", gb->cpu.AF.lo & CPUZ80::N ? olc::BLUE : olc::RED);
-	DrawString(x + 96,  y, "H", gb->cpu.AF.lo & CPUZ80::H ? olc::BLUE : olc::RED);
-	DrawString(x + 112, y, "C", gb->cpu.AF.lo & CPUZ80::C ? olc::BLUE : olc::RED);
+	DrawString(x + 64,  y, "Z", m_view.AF.lo & CPUZ80::Z ? olc::BLUE : olc::RED);
+	DrawString(x + 80,  y, "N", m_view.AF.lo & CPUZ80::N ? olc::BLUE : olc::RED);
+	DrawString(x + 96,  y, "H", m_view.AF.lo & CPUZ80::H ? olc::BLUE : olc::RED);
+	DrawString(x + 112, y, "C", m_view.AF.lo & CPUZ80::C ? olc::BLUE : olc::RED);
 	DrawString(x + 128, y, "-", olc::WHITE);
 	DrawString(x + 144, y, "-", olc::WHITE);
 	DrawString(x + 160, y, "-", olc::WHITE);
@@ -40,68 +42,69 @@ void Debugger::draw_cpu(int x, int y)
 	DrawString(x, y + 10, "REGISTERS:", olc::WHITE);
 
 	DrawString(x, y + 20, "PC: ");
-	DrawString(x + 30, y + 20, "$" + hex(gb->cpu.PC.reg, 4), olc::GREEN);
+	DrawString(x + 30, y + 20, "$" + hex(m_view.PC.reg, 4), olc::GREEN);
+	DrawString(x + 80, y + 20, gb->symbols.describe(view_bank(m_view.PC.reg), m_view.PC.reg).substr(0, 19), olc::YELLOW);
 
 	DrawString(x,       y + 30, "A: ");
-	DrawString(x + 25,  y + 30, "$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 25,  y + 30, "$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
 	DrawString(x + 104, y + 30, "F: ");
-	DrawString(x + 129, y + 30, "$" + hex(gb->cpu.AF.lo, 2) + "  [" + std::to_string(gb->cpu.AF.lo) + "]", olc::GREEN);
+	DrawString(x + 129, y + 30, "$" + hex(m_view.AF.lo, 2) + "  [" + std::to_string(m_view.AF.lo) + "]", olc::GREEN);
 
-	DrawString(x,       y + 40, "B: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 25,  y + 40, "$" + hex(gb->cpu.BC.hi, 2) + "  [" + std::to_string(gb->cpu.BC.hi) + "]", olc::GREEN);
-	DrawString(x + 104, y + 40, "C: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 129, y + 40, "$" + hex(gb->cpu.BC.lo, 2) + "  [" + std::to_string(gb->cpu.BC.lo) + "]", olc::GREEN);
+	DrawString(x,       y + 40, "B: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 25,  y + 40, "$" + hex(m_view.BC.hi, 2) + "  [" + std::to_string(m_view.BC.hi) + "]", olc::GREEN);
+	DrawString(x + 104, y + 40, "C: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 129, y + 40, "$" + hex(m_view.BC.lo, 2) + "  [" + std::to_string(m_view.BC.lo) + "]", olc::GREEN);
 
-	DrawString(x,       y + 50, "D: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 25,  y + 50, "$" + hex(gb->cpu.DE.hi, 2) + "  [" + std::to_string(gb->cpu.DE.hi) + "]", olc::GREEN);
-	DrawString(x + 104, y + 50, "E: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 129, y + 50, "$" + hex(gb->cpu.DE.lo, 2) + "  [" + std::to_string(gb->cpu.DE.lo) + "]", olc::GREEN);
+	DrawString(x,       y + 50, "D: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 25,  y + 50, "$" + hex(m_view.DE.hi, 2) + "  [" + std::to_string(m_view.DE.hi) + "]", olc::GREEN);
+	DrawString(x + 104, y + 50, "E: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 129, y + 50, "$" + hex(m_view.DE.lo, 2) + "  [" + std::to_string(m_view.DE.lo) + "]", olc::GREEN);
 	
-	DrawString(x,       y + 60, "H: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 25,  y + 60, "$" + hex(gb->cpu.HL.hi, 2) + "  [" + std::to_string(gb->cpu.HL.hi) + "]", olc::GREEN);
-	DrawString(x + 104, y + 60, "L: ");//"$" + hex(gb->cpu.AF.hi, 2) + "  [" + std::to_string(gb->cpu.AF.hi) + "]", olc::GREEN);
-	DrawString(x + 129, y + 60, "$" + hex(gb->cpu.HL.lo, 2) + "  [" + std::to_string(gb->cpu.HL.lo) + "]", olc::GREEN);
+	DrawString(x,       y + 60, "H: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 25,  y + 60, "$" + hex(m_view.HL.hi, 2) + "  [" + std::to_string(m_view.HL.hi) + "]", olc::GREEN);
+	DrawString(x + 104, y + 60, "L: ");//"$" + hex(m_view.AF.hi, 2) + "  [" + std::to_string(m_view.AF.hi) + "]", olc::GREEN);
+	DrawString(x + 129, y + 60, "$" + hex(m_view.HL.lo, 2) + "  [" + std::to_string(m_view.HL.lo) + "]", olc::GREEN);
 
 	DrawString(x, y + 70, "STACK POINTER: ");
-	DrawString(x + 115, y + 70, "$" + hex(gb->cpu.SP.reg, 4), olc::GREEN);
-	//DrawString(x, y + 70, "STACK POINTER: $" + hex(gb->cpu.SP.reg, 4));
+	DrawString(x + 115, y + 70, "$" + hex(m_view.SP.reg, 4), olc::GREEN);
+	//DrawString(x, y + 70, "STACK POINTER: $" + hex(m_view.SP.reg, 4));
 }
 
 void Debugger::draw_cpu_special(int x, int y)
 {
-	if (gb->cpu.PEI)
+	if (m_view.PEI)
 		DrawString(x, y, "Pending Enable Interupt");
-	else if (gb->cpu.PDI)
+	else if (m_view.PDI)
 		DrawString(x, y, "Pending Disable Interupt");
 	else
 		DrawString(x, y, "");
 
-	std::string IME = (gb->cpu.IME ? "TRUE" : "FALSE");
+	std::string IME = (m_view.IME ? "TRUE" : "FALSE");
 	DrawString(x,       y + 10, "IME: " + IME);
 	DrawString(x,       y + 20, "ALLOWED:");
-	DrawString(x + 86,  y + 20, "V", (*gb->cpu.IE) & 0x01 ? olc::BLUE : olc::RED);
-	DrawString(x + 102, y + 20, "L", (*gb->cpu.IE) & 0x02 ? olc::BLUE : olc::RED);
-	DrawString(x + 118, y + 20, "T", (*gb->cpu.IE) & 0x04 ? olc::BLUE : olc::RED);
-	DrawString(x + 134, y + 20, "S", (*gb->cpu.IE) & 0x08 ? olc::BLUE : olc::RED);
-	DrawString(x + 150, y + 20, "J", (*gb->cpu.IE) & 0x10 ? olc::BLUE : olc::RED);
+	DrawString(x + 86,  y + 20, "V", m_view.IE & 0x01 ? olc::BLUE : olc::RED);
+	DrawString(x + 102, y + 20, "L", m_view.IE & 0x02 ? olc::BLUE : olc::RED);
+	DrawString(x + 118, y + 20, "T", m_view.IE & 0x04 ? olc::BLUE : olc::RED);
+	DrawString(x + 134, y + 20, "S", m_view.IE & 0x08 ? olc::BLUE : olc::RED);
+	DrawString(x + 150, y + 20, "J", m_view.IE & 0x10 ? olc::BLUE : olc::RED);
 
 	DrawString(x,      y + 30,  "REQUESTED:");
-	DrawString(x + 86, y + 30,  "V", (*gb->cpu.IF) & 0x01 ? olc::BLUE : olc::RED);
-	DrawString(x + 102, y + 30, "L", (*gb->cpu.IF) & 0x02 ? olc::BLUE : olc::RED);
-	DrawString(x + 118, y + 30, "T", (*gb->cpu.IF) & 0x04 ? olc::BLUE : olc::RED);
-	DrawString(x + 134, y + 30, "S", (*gb->cpu.IF) & 0x08 ? olc::BLUE : olc::RED);
-	DrawString(x + 150, y + 30, "J", (*gb->cpu.IF) & 0x10 ? olc::BLUE : olc::RED);
+	DrawString(x + 86, y + 30,  "V", m_view.IF & 0x01 ? olc::BLUE : olc::RED);
+	DrawString(x + 102, y + 30, "L", m_view.IF & 0x02 ? olc::BLUE : olc::RED);
+	DrawString(x + 118, y + 30, "T", m_view.IF & 0x04 ? olc::BLUE : olc::RED);
+	DrawString(x + 134, y + 30, "S", m_view.IF & 0x08 ? olc::BLUE : olc::RED);
+	DrawString(x + 150, y + 30, "J", m_view.IF & 0x10 ? olc::BLUE : olc::RED);
 
 	DrawString(x, y + 40, "");
 
-	DrawString(x, y + 50, "TIMER:", ((*gb->cpu.clock.TAC) & 0x04) > 0 ? olc::WHITE : olc::RED);
-	DrawString(x + 86, y + 50, "$" + hex((*gb->cpu.clock.TIMA), 2), olc::GREEN);
+	DrawString(x, y + 50, "TIMER:", (m_view.TAC & 0x04) > 0 ? olc::WHITE : olc::RED);
+	DrawString(x + 86, y + 50, "$" + hex(m_view.TIMA, 2), olc::GREEN);
 
 	DrawString(x, y + 60, "DIVIDER:");
-	DrawString(x + 86, y + 60, "$" + hex((*gb->cpu.DIV), 2), olc::GREEN);
+	DrawString(x + 86, y + 60, "$" + hex(m_view.DIV, 2), olc::GREEN);
 
 	DrawString(x, y + 70, "FREQUENCY:");
-	switch ((*gb->cpu.clock.TAC) & 0x03)
+	switch (m_view.TAC & 0x03)
 	{
 	case 0x00: DrawString(x + 86, y + 70, "4096 Hz");    break;
 	case 0x01: DrawString(x + 86, y + 70, "2621444 Hz"); break;
@@ -113,19 +116,19 @@ void Debugger::draw_cpu_special(int x, int y)
 
 	DrawString(x, y + 80, "");
 
-	DrawString(x, y + 90, "LCD", gb->cpu.LCD.enabled() ? olc::BLUE : olc::RED);
+	DrawString(x, y + 90, "LCD", m_view.LCD_enabled ? olc::BLUE : olc::RED);
 
 	DrawString(x, y + 100, "LCD MODE:");
-	DrawString(x + 86, y + 100, "$" + hex((*gb->cpu.LCD.STAT) & 0x03, 2), olc::GREEN);
+	DrawString(x + 86, y + 100, "$" + hex(m_view.STAT & 0x03, 2), olc::GREEN);
 
 	DrawString(x, y + 110, "LINE:");
-	DrawString(x + 86, y + 110, "$" + hex((*gb->cpu.LCD.LY), 2), olc::GREEN);
+	DrawString(x + 86, y + 110, "$" + hex(m_view.LY, 2), olc::GREEN);
 
 }
 
 void Debugger::draw_code(int x, int y, int lines)
 {
-	auto it_a = map_asm.find(gb->cpu.PC.reg);
+	auto it_a = map_asm.find(m_view.PC.reg);
 	int line_y = (lines >> 1) * 10 + y;
 	if (it_a != map_asm.end())
 	{
@@ -134,11 +137,11 @@ void Debugger::draw_code(int x, int y, int lines)
 		{
 			line_y += 10;
 			if (++it_a != map_asm.end())
-				DrawString(x, line_y, (*it_a).second);
+				DrawString(x, line_y, (*it_a).second, code_color((*it_a).first));
 		}
 	}
 
-	it_a = map_asm.find(gb->cpu.PC.reg);
+	it_a = map_asm.find(m_view.PC.reg);
 	line_y = (lines >> 1) * 10 + y;
 	if (it_a != map_asm.end())
 	{
@@ -146,93 +149,493 @@ void Debugger::draw_code(int x, int y, int lines)
 		{
 			line_y -= 10;
 			if (--it_a != map_asm.end())
-				DrawString(x, line_y, (*it_a).second);
+				DrawString(x, line_y, (*it_a).second, code_color((*it_a).first));
 		}
 	}
 }
 
+H_BYTE Debugger::view_bank(uint16_t addr)
+{
+	if (addr >= 0x4000 && addr <= 0x7FFF)
+		return m_view.rom_bank;
+	if (addr >= 0xD000 && addr <= 0xDFFF)
+		return 1;
+	return 0;
+}
+
+olc::Pixel Debugger::code_color(uint16_t addr)
+{
+	if (m_view_breakpoints.count(addr))
+		return olc::RED;
+	if (!gb->symbols.empty() && gb->symbols.exact(view_bank(addr), addr) != nullptr)
+		return olc::YELLOW;
+	return olc::WHITE;
+}
+
 void Debugger::draw_stack(int x, int y)
 {
 	DrawString(x, y, "STACK");
-	H_WORD old_SP = gb->cpu.SP.reg;
+	const H_BYTE* stack = m_view.stack;
 
-	H_BYTE lo = gb->read(old_SP + 1);
-	H_BYTE hi = gb->read(old_SP + 2);
+	H_BYTE lo = stack[0];
+	H_BYTE hi = stack[1];
 	DrawString(x, y + 10, "+0 $" + hex(hi, 2) + hex(lo, 2));
 
-	old_SP += 2;
-	lo = gb->read(old_SP + 1);
-	hi = gb->read(old_SP + 2);
+	lo = stack[2];
+	hi = stack[3];
 	DrawString(x, y + 20, "+2 $" + hex(hi, 2) + hex(lo, 2));
 
-	old_SP += 2;
-	lo = gb->read(old_SP + 1);
-	hi = gb->read(old_SP + 2);
+	lo = stack[4];
+	hi = stack[5];
 	DrawString(x, y + 30, "+4 $" + hex(hi, 2) + hex(lo, 2));
 
-	old_SP += 2;
-	lo = gb->read(old_SP + 1);
-	hi = gb->read(old_SP + 2);
+	lo = stack[6];
+	hi = stack[7];
 	DrawString(x, y + 40, "+6 $" + hex(hi, 2) + hex(lo, 2));
 }
 
+void Debugger::draw_heatmap(int x, int y)
+{
+	const int cell = 7;
+
+	// Log scale so a couple of hot registers don't hide everything else
+	auto intensity = [](H_DWORD v, H_DWORD max)
+	{
+		if (v == 0 || max == 0)
+			return 0;
+		return 48 + (int)(207.0f * std::log2(1.0f + v) / std::log2(1.0f + max));
+	};
+
+	auto draw_grid = [&](int gx, int gy, const H_DWORD* reads, const H_DWORD* writes)
+	{
+		H_DWORD max = 0;
+		for (int i = 0; i < 256; i++)
+			max = std::max(max, std::max(reads[i], writes[i]));
+
+		for (int i = 0; i < 256; i++)
+		{
+			olc::Pixel p(intensity(writes[i], max), intensity(reads[i], max), 0);
+			FillRect(gx + (i & 0x0F) * cell, gy + (i >> 4) * cell, cell - 1, cell - 1, p);
+		}
+	};
+
+	if (m_view.heat_mode == MemoryHeatmap::HEAT_OFF)
+	{
+		DrawString(x, y, "HEATMAP OFF", olc::DARK_GREY);
+		return;
+	}
+
+	// Whole address space, one cell per page
+	draw_grid(x, y, m_view.page_reads, m_view.page_writes);
+	DrawString(x, y + 16 * cell + 2, "PAGES", olc::WHITE);
+
+	// Bytes of the hottest page
+	if (m_view.heat_mode == MemoryHeatmap::HEAT_BYTE)
+	{
+		draw_grid(x + 16 * cell + 8, y, m_view.byte_reads, m_view.byte_writes);
+		DrawString(x + 16 * cell + 8, y + 16 * cell + 2, "$" + hex(m_view.heat_page, 4), olc::WHITE);
+	}
+}
+
+olc::Pixel Debugger::shade(H_BYTE color)
+{
+	static const olc::Pixel shades[4] = { olc::WHITE, olc::Pixel(170, 170, 170), olc::Pixel(85, 85, 85), olc::BLACK };
+	return shades[color & 0x03];
+}
+
+void Debugger::draw_tiles(int x, int y)
+{
+	DrawString(x, y, "TILES $8000-$97FF");
+
+	// 16 tiles per row at double size
+	for (int t = 0; t < 384; t++)
+	{
+		int tx = x + (t % 16) * 16;
+		int ty = y + 10 + (t / 16) * 16;
+		const H_BYTE* tile = m_view.tiles[t];
+		for (int i = 0; i < 64; i++)
+			FillRect(tx + (i % 8) * 2, ty + (i / 8) * 2, 2, 2, shade(tile[i]));
+	}
+}
+
+void Debugger::draw_tile_maps(int x, int y)
+{
+	bool unsig = m_view.LCDC & (1 << 4);
+	int  bg    = (m_view.LCDC & (1 << 3)) ? 1 : 0;
+
+	for (int m = 0; m < 2; m++)
+	{
+		int mx = x + m * 136;
+		int my = y + 10;
+		DrawString(mx, y, m == 0 ? "MAP $9800" : "MAP $9C00", m == bg ? olc::YELLOW : olc::WHITE);
+
+		// Half size, every other pixel of each tile
+		for (int i = 0; i < 1024; i++)
+		{
+			H_BYTE n = m_view.tile_maps[m][i];
+			const H_BYTE* tile = m_view.tiles[unsig ? n : 256 + (H_S_BYTE)n];
+			int tx = mx + (i % 32) * 4;
+			int ty = my + (i / 32) * 4;
+			for (int py = 0; py < 4; py++)
+				for (int px = 0; px < 4; px++)
+					Draw(tx + px, ty + py, shade(m_view.BGP >> (tile[py * 16 + px * 2] * 2)));
+		}
+
+		if (m != bg)
+			continue;
+
+		// Visible 160x144 area, wraps around map edges
+		int vx = m_view.SCX / 2, vy = m_view.SCY / 2;
+		auto mark = [&](int px, int py) { Draw(mx + (px & 127), my + (py & 127), olc::RED); };
+		for (int i = 0; i < 80; i++)
+		{
+			mark(vx + i, vy);
+			mark(vx + i, vy + 71);
+		}
+		for (int i = 0; i < 72; i++)
+		{
+			mark(vx, vy + i);
+			mark(vx + 79, vy + i);
+		}
+	}
+}
+
+void Debugger::draw_oam(int x, int y)
+{
+	DrawString(x, y, "OAM");
+	DrawString(x + 48, y, "LCDC:$" + hex(m_view.LCDC, 2) + " SCX:$" + hex(m_view.SCX, 2) + " SCY:$" + hex(m_view.SCY, 2) + " BGP:$" + hex(m_view.BGP, 2));
+
+	// 40 sprites in two columns: tile, Y, X, tile number, flags
+	for (int i = 0; i < 40; i++)
+	{
+		const H_BYTE* sprite = &m_view.oam[i * 4];
+		int sx = x + (i / 20) * 200;
+		int sy = y + 10 + (i % 20) * 10;
+
+		const H_BYTE* tile = m_view.tiles[sprite[2]];
+		for (int p = 0; p < 64; p++)
+			Draw(sx + p % 8, sy + p / 8, shade(tile[p]));
+
+		DrawString(sx + 12, sy, hex(i, 2) + " Y:" + hex(sprite[0], 2) + " X:" + hex(sprite[1], 2) + " T:" + hex(sprite[2], 2) + " F:" + hex(sprite[3], 2),
+			sprite[0] == 0 || sprite[0] >= 160 ? olc::DARK_GREY : olc::GREEN);
+	}
+}
+
 bool Debugger::OnUserCreate()
 {
 	gb->cpu.reset();
 
-	std::stringstream ss;
-	//ss << "F0 44 FE 90 38 FA AF E0 40 21 00 90 11 50 01 01 00 08 1A 22 13 0B 78 B1 20 F8 21 00 99 11 37 00 1A 22 13 A7 20 FA 3E E4 E0 47 AF E0 42 E0 43 E0 26 3E 81 E0 40 18 FE 48 65 6C 6C 6F 20 47 69 74 68 75 62 20 21 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 F3 C3 00 00 CE ED 66 66 CC 0D 00 0B 03 73 00 83 00 0C 00 0D 00 08 11 1F 88 89 00 0E DC CC 6E E6 DD DD D9 99 BB BB 67 63 6E 0E EC CC DD DC 99 9F BB B9 33 3E 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 E7 FD AD 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 08 00 0C 00 08 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 80 80 80 80 80 80 80 80 80 80 00 00 80 80 00 00 00 00 6C 6C 6C 6C 48 48 00 00 00 00 00 00 00 00 48 48 FC FC 48 48 48 48 48 48 FC FC 48 48 00 00 10 10 7C 7C 90 90 78 78 14 14 F8 F8 10 10 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 90 90 50 50 60 60 94 94 98 98 6C 6C 00 00 00 00 38 38 38 38 08 08 10 10 00 00 00 00 00 00 18 18 20 20 20 20 20 20 20 20 20 20 18 18 00 00 18 18 04 04 04 04 04 04 04 04 04 04 18 18 00 00 00 00 10 10 54 54 38 38 54 54 10 10 00 00 00 00 00 00 10 10 10 10 7C 7C 10 10 10 10 00 00 00 00 00 00 00 00 00 00 00 00 30 30 30 30 60 60 00 00 00 00 00 00 00 00 7C 7C 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 60 60 00 00 00 00 04 04 08 08 10 10 20 20 40 40 80 80 00 00 30 30 58 58 CC CC CC CC CC CC 68 68 30 30 00 00 30 30 70 70 F0 F0 30 30 30 30 30 30 FC FC 00 00 78 78 CC CC 18 18 30 30 60 60 C0 C0 FC FC 00 00 78 78 8C 8C 0C 0C 38 38 0C 0C 8C 8C 78 78 00 00 38 38 58 58 98 98 FC FC 18 18 18 18 18 18 00 00 FC FC C0 C0 C0 C0 78 78 0C 0C CC CC 78 78 00 00 78 78 CC CC C0 C0 F8 F8 CC CC CC CC 78 78 00 00 FC FC 0C 0C 0C 0C 18 18 18 18 30 30 30 30 00 00 78 78 CC CC CC CC 78 78 CC CC CC CC 78 78 00 00 78 78 CC CC CC CC 7C 7C 0C 0C CC CC 78 78 00 00 00 00 C0 C0 C0 C0 00 00 C0 C0 C0 C0 00 00 00 00 00 00 C0 C0 C0 C0 00 00 C0 C0 40 40 80 80 00 00 04 04 18 18 60 60 80 80 60 60 18 18 04 04 00 00 00 00 00 00 FC FC 00 00 FC FC 00 00 00 00 00 00 80 80 60 60 18 18 04 04 18 18 60 60 80 80 00 00 78 78 CC CC 18 18 30 30 20 20 00 00 20 20 00 00 00 00 20 20 70 70 F8 F8 F8 F8 F8 F8 00 00 00 00 30 30 48 48 84 84 84 84 FC FC 84 84 84 84 00 00 F8 F8 84 84 84 84 F8 F8 84 84 84 84 F8 F8 00 00 3C 3C 40 40 80 80 80 80 80 80 40 40 3C 3C 00 00 F0 F0 88 88 84 84 84 84 84 84 88 88 F0 F0 00 00 FC FC 80 80 80 80 FC FC 80 80 80 80 FC FC 00 00 FC FC 80 80 80 80 FC FC 80 80 80 80 80 80 00 00 7C 7C 80 80 80 80 BC BC 84 84 84 84 78 78 00 00 84 84 84 84 84 84 FC FC 84 84 84 84 84 84 00 00 7C 7C 10 10 10 10 10 10 10 10 10 10 7C 7C 00 00 04 04 04 04 04 04 04 04 04 04 04 04 F8 F8 00 00 84 84 88 88 90 90 A0 A0 E0 E0 90 90 8C 8C 00 00 80 80 80 80 80 80 80 80 80 80 80 80 FC FC 00 00 84 84 CC CC B4 B4 84 84 84 84 84 84 84 84 00 00 84 84 C4 C4 A4 A4 94 94 8C 8C 84 84 84 84 00 00 78 78 84 84 84 84 84 84 84 84 84 84 78 78 00 00 F8 F8 84 84 84 84 F8 F8 80 80 80 80 80 80 00 00 78 78 84 84 84 84 84 84 A4 A4 98 98 6C 6C 00 00 F8 F8 84 84 84 84 F8 F8 90 90 88 88 84 84 00 00 7C 7C 80 80 80 80 78 78 04 04 84 84 78 78 00 00 7C 7C 10 10 10 10 10 10 10 10 10 10 10 10 00 00 84 84 84 84 84 84 84 84 84 84 84 84 78 78 00 00 84 84 84 84 84 84 84 84 84 84 48 48 30 30 00 00 84 84 84 84 84 84 84 84 B4 B4 CC CC 84 84 00 00 84 84 84 84 48 48 30 30 48 48 84 84 84 84 00 00 44 44 44 44 44 44 28 28 10 10 10 10 10 10 00 00 FC FC 04 04 08 08 10 10 20 20 40 40 FC FC 00 00 38 38 20 20 20 20 20 20 20 20 20 20 38 38 00 00 00 00 80 80 40 40 20 20 10 10 08 08 04 04 00 00 1C 1C 04 04 04 04 04 04 04 04 04 04 1C 1C 00 00 10 10 28 28 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF C0 C0 60 60 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 78 78 04 04 7C 7C 84 84 78 78 00 00 80 80 80 80 80 80 F8 F8 84 84 84 84 78 78 00 00 00 00 00 00 7C 7C 80 80 80 80 80 80 7C 7C 00 00 04 04 04 04 04 04 7C 7C 84 84 84 84 78 78 00 00 00 00 00 00 78 78 84 84 F8 F8 80 80 7C 7C 00 00 00 00 3C 3C 40 40 FC FC 40 40 40 40 40 40 00 00 00 00 00 00 78 78 84 84 7C 7C 04 04 F8 F8 00 00 80 80 80 80 F8 F8 84 84 84 84 84 84 84 84 00 00 00 00 10 10 00 00 10 10 10 10 10 10 10 10 00 00 00 00 10 10 00 00 10 10 10 10 10 10 E0 E0 00 00 80 80 80 80 84 84 98 98 E0 E0 98 98 84 84 00 00 10 10 10 10 10 10 10 10 10 10 10 10 10 10 00 00 00 00 00 00 68 68 94 94 94 94 94 94 94 94 00 00 00 00 00 00 78 78 84 84 84 84 84 84 84 84 00 00 00 00 00 00 78 78 84 84 84 84 84 84 78 78 00 00 00 00 00 00 78 78 84 84 84 84 F8 F8 80 80 00 00 00 00 00 00 78 78 84 84 84 84 7C 7C 04 04 00 00 00 00 00 00 BC BC C0 C0 80 80 80 80 80 80 00 00 00 00 00 00 7C 7C 80 80 78 78 04 04 F8 F8 00 00 00 00 40 40 F8 F8 40 40 40 40 40 40 3C 3C 00 00 00 00 00 00 84 84 84 84 84 84 84 84 78 78 00 00 00 00 00 00 84 84 84 84 48 48 48 48 30 30 00 00 00 00 00 00 84 84 84 84 84 84 A4 A4 58 58 00 00 00 00 00 00 8C 8C 50 50 20 20 50 50 8C 8C 00 00 00 00 00 00 84 84 84 84 7C 7C 04 04 F8 F8 00 00 00 00 00 00 FC FC 08 08 30 30 40 40 FC FC 00 00 18 18 20 20 20 20 40 40 20 20 20 20 18 18 00 00 10 10 10 10 10 10 10 10 10 10 10 10 10 10 00 00 30 30 08 08 08 08 04 04 08 08 08 08 30 30 00 00 00 00 00 00 48 48 A8 A8 90 90 00 00 00 00 00 00";
-	ss << "C3 0C 02 00 00 00 00 00 C3 0C 02 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 87 E1 5F 16 00 19 5E 23 56 D5 E1 E9 FF FF FF FF FF FF FF FF FF FF FF FF C3 7E 01 FF FF FF FF FF C3 BE 26 FF FF FF FF FF C3 BE 26 FF FF FF FF FF C3 5B 00 F5 E5 D5 C5 CD 6B 00 3E 01 E0 CC C1 D1 E1 F1 D9 F0 CD EF 78 00 9F 00 A4 00 BA 00 EA 27 F0 E1 FE 07 28 08 FE 06 C8 3E 06 E0 E1 C9 F0 01 FE 55 20 08 3E 29 E0 CB 3E 01 18 08 FE 29 C0 3E 55 E0 CB AF E0 02 C9 F0 01 E0 D0 C9 F0 01 E0 D0 F0 CB FE 29 C8 F0 CF E0 01 3E FF E0 CF 3E 80 E0 02 C9 F0 01 E0 D0 F0 CB FE 29 C8 F0 CF E0 01 FB CD 98 0A 3E 80 E0 02 C9 F0 CD FE 02 C0 AF E0 0F FB C9 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 C3 50 01 CE ED 66 66 CC 0D 00 0B 03 73 00 83 00 0C 00 0D 00 08 11 1F 88 89 00 0E DC CC 6E E6 DD DD D9 99 BB BB 67 63 6E 0E EC CC DD DC 99 9F BB B9 33 3E 54 45 54 52 49 53 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 0A 16 BF C3 0C 02 CD E3 29 F0 41 E6 03 20 FA 46 F0 41 E6 03 20 FA 7E A0 C9 7B 86 27 22 7A 8E 27 22 3E 00 8E 27 77 3E 01 E0 E0 D0 3E 99 32 32 77 C9 F5 C5 D5 E5 F0 CE A7 28 12 F0 CB FE 29 20 0C AF E0 CE F0 CF E0 01 21 02 FF 36 81 CD E0 21 CD CC 23 CD B7 23 CD 9E 23 CD 8C 23 CD 7D 23 CD 6E 23 CD 5F 23 CD 50 23 CD 41 23 CD 32 23 CD 23 23 CD F8 22 CD E9 22 CD DA 22 CD CB 22 CD BC 22 CD AD 22 CD 9E 22 CD D7 1E CD B6 FF CD CA 18 FA CE C0 A7 28 1A F0 98 FE 03 20 14 21 6D 98 CD 3B 24 3E 01 E0 E0 21 6D 9C CD 3B 24 AF EA CE C0 21 E2 FF 34 AF E0 43 E0 42 3C E0 85 E1 D1 C1 F1 D9 AF 21 FF DF 0E 10 06 00 32 05 20 FC 0D 20 F9 3E 01 F3 E0 0F E0 FF AF E0 42 E0 43 E0 A4 E0 41 E0 01 E0 02 3E 80 E0 40 F0 44 FE 94 20 FA 3E 03 E0 40 3E E4 E0 47 E0 48 3E C4 E0 49 21 26 FF 3E 80 32 3E FF 32 36 77 3E 01 EA 00 20 31 FF CF AF 21 FF DF 06 00 32 05 20 FC 21 FF CF 0E 10 06 00 32 05 20 FC 0D 20 F9 21 FF 9F 0E 20 AF 06 00 32 05 20 FC 0D 20 F9 21 FF FE 06 00 32 05 20 FC 21 FE FF 06 80 32 05 20 FC 0E B6 06 0C 21 7F 2A 2A E2 0C 05 20 FA CD 95 27 CD F3 7F 3E 09 E0 FF 3E 37 E0 C0 3E 1C E0 C1 3E 24 E0 E1 3E 80 E0 40 FB AF E0 0F E0 4A E0 4B E0 06 CD A6 29 CD F8 02 CD F0 7F F0 80 E6 0F FE 0F CA 1B 02 21 A6 FF 06 02 7E A7 28 01 35 2C 05 20 F7 F0 C5 A7 28 04 3E 09 E0 FF F0 85 A7 28 FB AF E0 85 C3 C4 02 F0 E1 EF CE 1B E2 1C 44 12 7B 12 06 1D 26 1D AE 03 79 04 44 14 8C 14 07 1A C0 1D 16 1F 1F 1F 25 15 B0 14 7B 15 BF 15 29 16 7A 16 EB 16 13 19 77 06 2C 07 25 08 E4 08 31 0B EB 0C D2 0A 32 0D 23 0E 12 11 99 0D 8A 0E CE 1D 41 1E 69 03 93 03 67 11 E6 11 FC 11 1C 12 C7 05 F7 05 B3 12 05 13 24 13 51 13 67 13 7E 13 B5 13 E5 13 1B 13 A0 03 EA 27 CD 20 28 CD D7 27 11 07 4A CD EB 27 CD 8A 17 21 00 C3 11 50 64 1A 22 13 7C FE C4 20 F8 3E D3 E0 40 3E FA E0 A6 3E 25 E0 E1 C9 F0 A6 A7 C0 3E FA E0 A6 3E 35 E0 E1 C9 F0 81 A7 20 04 F0 A6 A7 C0 3E 06 E0 E1 C9 CD 20 28 AF E0 E9 E0 98 E0 9C E0 9B E0 FB E0 9F E0 E3 E0 C7 CD 93 22 CD 51 26 CD D7 27 21 00 C8 3E 2F 22 7C FE CC 20 F8 21 01 C8 CD A9 26 21 0C C8 CD A9 26 21 41 CA 06 0C 3E 8E 22 05 20 FC 11 6F 4B CD EB 27 CD 8A 17 21 00 C0 36 80 2C 36 10 2C 36 58 3E 03 EA E8 DF 3E D3 E0 40 3E 07 E0 E1 3E 7D E0 A6 3E 04 E0 C6 F0 E4 A7 C0 3E 13 E0 C6 C9 3E 37 E0 C0 3E 09 E0 C2 AF E0 C5 E0 B0 E0 ED E0 EA 3E 62 E0 EB 3E B0 E0 EC F0 E4 FE 02 3E 02 20 1A 3E 77 E0 C0 3E 09 E0 C3 3E 02 E0 C4 3E 63 E0 EB 3E B0 E0 EC 3E 11 E0 B0 3E 01 E0 E4 3E 0A E0 E1 CD 20 28 CD AD 27 11 D7 4C CD EB 27 CD 8A 17 3E D3 E0 40 C9 3E FF E0 E9 C9 F0 A6 A7 20 0A 21 C6 FF 35 28 9B 3E 7D E0 A6 CD 98 0A 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 0A F0 CB A7 20 3A AF E0 CC 18 67 F0 81 47 F0 C5 CB 50 20 48 CB 60 20 53 CB 68 20 54 CB 58 C8 A7 3E 08 28 2C 78 FE 08 C0 F0 CB FE 29 28 12 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 CB A7 28 32 3E 2A E0 E1 AF E0 A6 E0 C2 E0 C3 E0 C4 E0 E4 C9 F5 F0 80 CB 7F 28 02 E0 F4 F1 18 E6 EE 01 E0 C5 A7 3E 10 28 02 3E 60 EA 01 C0 C9 A7 C0 AF 18 EC A7 C8 AF 18 E9 F0 E4 A7 C8 CD 98 0A AF E0 01 3E 80 E0 02 F0 81 CB 5F 28 0D 3E 33 E0 01 3E 81 E0 02 3E 06 E0 E1 C9 21 B0 FF F0 E4 FE 02 06 10 28 02 06 1D 7E B8 C0 3E 06 E0 E1 C9 F0 E4 A7 C8 F0 E9 FE FF C8 F0 EA A7 28 05 3D E0 EA 18 1C F0 EB 67 F0 EC 6F 2A 47 F0 ED A8 A0 E0 81 78 E0 ED 2A E0 EA 7C E0 EB 7D E0 EC 18 03 AF E0 81 F0 80 E0 EE F0 ED E0 80 C9 AF E0 ED 18 EF C9 F0 E4 A7 C8 F0 E9 FE FF C0 F0 80 47 F0 ED B8 28 19 F0 EB 67 F0 EC 6F F0 ED 22 F0 EA 22 7C E0 EB 7D E0 EC 78 E0 ED AF E0 EA C9 F0 EA 3C E0 EA C9 F0 E4 A7 C8 F0 E9 A7 C0 F0 EE E0 80 C9 21 02 FF CB FE 18 0A 3E 03 E0 CD F0 CB FE 29 20 EF CD 4F 14 3E 80 EA 10 C2 CD 71 26 E0 CE AF E0 01 E0 CF E0 DC E0 D2 E0 D3 E0 D4 E0 D5 E0 E3 CD F3 7F 3E 2B E0 E1 C9 F0 CB FE 29 28 16 F0 F0 A7 28 1E AF E0 F0 11 01 C2 CD 92 14 CD 17 15 CD 71 26 18 0D F0 81 CB 47 20 07 CB 5F 20 03 CD B0 14 F0 CB FE 29 28 1E F0 CC A7 C8 AF E0 CC 3E 39 E0 CF F0 D0 FE 50 28 2D 47 F0 C1 B8 C8 78 E0 C1 3E 01 E0 F0 C9 F0 81 CB 5F 20 22 CB 47 20 1E F0 CC A7 C8 AF E0 CC F0 CF FE 50 28 09 F0 C1 E0 CF 3E 01 E0 CE C9 CD 8A 17 3E 16 E0 E1 C9 3E 50 18 ED 21 02 FF CB FE 18 1F 3E 03 E0 CD F0 CB FE 29 20 EF CD A1 0A CD A1 0A CD A1 0A 06 00 21 00 C3 CD A1 0A 22 05 20 F9 CD 20 28 CD AD 27 11 14 52 CD EB 27 CD 8A 17 3E 2F CD DD 1F 3E 03 E0 CE AF E0 01 E0 CF E0 DC E0 D2 E0 D3 E0 D4 E0 D5 E0 E3 E0 CC 21 00 C4 06 0A 3E 28 22 05 20 FC F0 D6 A7 C2 6D 07 CD 17 15 3E D3 E0 40 21 80 C0 11 05 07 06 20 CD 25 07 21 00 C2 11 ED 26 0E 02 CD 76 17 CD 0E 08 CD 71 26 AF E0 D7 E0 D8 E0 D9 E0 DA E0 DB 3E 17 E0 E1 C9 40 28 AE 00 40 30 AE 20 48 28 AF 00 48 30 AF 20 78 28 C0 00 78 30 C0 20 80 28 C1 00 80 30 C1 20 1A 22 13 05 20 FA C9 F0 CB FE 29 28 23 F0 CC A7 28 13 F0 D0 FE 60 28 2D FE 06 30 02 E0 AC F0 AD E0 CF AF E0 CC 11 10 C2 CD 66 17 21 AD FF 18 68 F0 81 CB 5F 28 04 3E 60 18 4D F0 CC A7 28 50 F0 CF FE 60 20 38 CD 8A 17 F0 D6 A7 20 18 3E 18 E0 E1 F0 CB FE 29 C0 AF E0 A0 3E 06 11 E0 FF 21 A2 C9 CD 68 1B C9 F0 CB FE 29 C2 28 08 AF E0 A0 3E 06 11 E0 FF 21 A2 C9 CD 68 1B C3 28 08 F0 D0 FE 06 30 02 E0 AD F0 AC E0 CF AF E0 CC 3C E0 CE 11 00 C2 CD 66 17 21 AC FF 7E CB 60 20 14 CB 68 20 22 CB 70 20 24 CB 78 28 13 FE 03 30 0F C6 03 18 05 FE 05 28 07 3C 77 3E 01 EA E0 DF CD 0E 08 CD 71 26 C9 A7 28 F6 3D 18 ED FE 03 38 EF D6 03 18 E5 40 60 40 70 40 80 50 60 50 70 50 80 78 60 78 70 78 80 88 60 88 70 88 80 F0 AC 11 01 C2 21 F6 07 CD 55 17 F0 AD 11 11 C2 21 02 08 CD 55 17 C9 CD 20 28 AF EA 10 C2 E0 98 E0 9C E0 9B E0 FB E0 9F E0 CC E0 01 E0 CE E0 D0 E0 CF E0 D1 CD 51 26 CD 93 22 CD F2 1F AF E0 E3 CD 8A 17 11 7C 53 D5 3E 01 E0 A9 E0 C5 CD EB 27 D1 21 00 9C CD EE 27 11 39 28 21 63 9C 0E 0A CD 7D 1F 21 00 C2 11 BF 26 CD B6 26 21 10 C2 11 C7 26 CD B6 26 21 51 99 3E 30 E0 9E 36 00 2D 36 03 CD E8 1A AF E0 A0 F0 CB FE 29 11 D4 08 F0 AC 28 05 11 C4 08 F0 AD 21 B0 98 77 26 9C 77 21 80 C0 06 10 CD 25 07 3E 77 E0 C0 3E D3 E0 40 3E 19 E0 E1 3E 01 E0 CD C9 18 84 C0 00 18 8C C0 20 20 84 C1 00 20 8C C1 20 18 84 AE 00 18 8C AE 20 20 84 AF 00 20 8C AF 20 3E 08 E0 FF AF E0 0F F0 CB FE 29 C2 F6 09 CD 98 0A CD 98 0A AF E0 CC 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 55 20 E4 11 16 00 0E 0A 21 02 C9 06 0A AF E0 CC CD 98 0A 2A E0 01 3E 81 E0 02 F0 CC A7 28 FB 05 20 EB 19 0D 20 E5 F0 AC FE 05 28 3D 21 22 CA 11 40 00 19 3C FE 05";//20 FA 11 22 CA 0E 0A 06 0A 1A 22 1C 05 20 FA D5 11 D6 FF 19 D1 E5 21 D6 FF 19 E5 D1 E1 0D 20 E7 11 D6 FF 06 0A 7C FE C8 28 09 3E 2F 22 05 20 FC 19 18 F0 CD 98 0A CD 98 0A AF E0 CC 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 55 20 E4 21 00 C3 06 00 AF E0 CC 2A CD 98 0A E0 01 3E 81 E0 02 F0 CC A7 28 FB 04 20 EB CD 98 0A CD 98 0A AF E0 CC 3E 30 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 56 20 E4 CD 8C 0A 3E 09 E0 FF 3E 1C E0 E1 3E 02 E0 E3 3E 03 E0 CD F0 CB FE 29 28 05 21 02 FF CB FE 21 00 C3 2A EA 03 C2 2A EA 13 C2 7C E0 AF 7D E0 B0 C9 F0 AD 3C 47 21 42 CA 11 C0 FF 05 28 03 19 18 FA CD 98 0A AF E0 CC 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 29 20 E7 11 16 00 0E 0A 06 0A AF E0 CC E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 22 05 20 EC 19 0D 20 E6 CD 98 0A AF E0 CC 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 29 20 E7 06 00 21 00 C3 AF E0 CC E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 22 04 20 EC CD 98 0A AF E0 CC 3E 56 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 30 20 E7 C3 C6 09 21 42 CA 3E 80 06 0A 22 05 20 FC C9 C5 06 FA 40 05 20 FC C1 C9 E5 C5 F0 FC E6 FC 4F 26 03 F0 04 47 AF 05 28 0A 3C 3C 3C 3C FE 1C 28 F4 18 F3 57 F0 AE 5F 25 28 07 B2 B1 E6 FC B9 28 E1 7A E0 AE 7B E0 FC C1 E1 C9 3E 01 E0 FF F0 E3 A7 20 27 06 44 0E 20 CD 3F 11 3E 02 E0 CD FA DE C0 A7 28 05 3E 80 EA 10 C2 CD 83 26 CD 96 26 CD 17 15 AF E0 D6 3E 1A E0 E1 C9 FE 05 C0 21 30 C0 06 12 36 F0 23 36 10 23 36 B6 23 36 80 23 05 20 F1 FA FF C3 06 0A 21 00 C4 3D 28 06 2C 05 20 F9 18 F2 36 2F 3E 03 E0 CE C9 3E 01 E0 FF 21 9C C0 AF 22 36 50 2C 36 27 2C 36 00 CD 0D 1C CD 88 1C CD BB 24 CD 9C 20 CD 3E 21 CD A1 25 CD 4D 22 CD 9B 0B F0 D5 A7 28 14 3E 77 E0 CF E0 B1 3E AA E0 D1 3E 1B E0 E1 3E 05 E0 A7 18 10 F0 E1 FE 01 20 1B 3E AA E0 CF E0 B1 3E 77 E0 D1 AF E0 DC E0 D2 E0 D3 E0 D4 F0 CB FE 29 20 02 E0 CE CD F0 0B CD 8C 0C C9 11 20 00 21 02 C8 3E 2F 0E 12 06 0A E5 BE 20 0A 23 05 20 F9 E1 19 0D 20 F1 E5 E1 79 E0 B1 FE 0C FA E9 DF 30 07 FE 08 C0 CD 17 15 C9 FE 08 C8 FA F0 DF FE 02 C8 3E 08 EA E8 DF C9 F0 CB FE 29 28 52 3E 01 EA 7F DF E0 AB F0 CF E0 F1 AF E0 F2 E0 CF CD CB 1C C9 F0 CC A7 C8 21 30 C0 11 04 00 AF E0 CC F0 D0 FE AA 28 61 FE 77 28 49 FE 94 28 CB 47 A7 28 51 CB 7F 20 6F FE 13 30 17 3E 12 90 4F 0C 3E 98 77 19 D6 08 05 20 F9 3E F0 0D 28 04 77 19 18 F9 F0 DC A7 28 07 F6 80 E0 B1 AF E0 DC 3E FF E0 D0 F0 CB FE 29 F0 B1 20 07 E0 CF 3E 01 E0 CE C9 E0 CF C9 F0 D1 FE AA 28 26 3E 77 E0 D1 3E 01 E0 E1 18 CE 0E 13 18 C1 F0 D1 FE 77 28 12 3E AA E0 D1 3E 1B E0 E1 3E 05 E0 A7 0E 01 06 12 18 A0 3E 01 E0 EF 18 AC E6 7F FE 05 30 A6 E0 D2 18 AE F0 D3 A7 28 07 CB 7F C8 E6 07 18 0A F0 D2 A7 C8 E0 D3 AF E0 D2 C9 4F C5 21 22 C8 11 E0 FF 19 0D 20 FC 11 22 C8 0E 11 06 0A 1A 22 1C 05 20 FA D5 11 16 00 19 D1 E5 21 16 00 19 E5 D1 E1 0D 20 E7 C1 11 00 C4 06 0A 1A 22 13 05 20 FA D5 11 16 00 19 D1 0D 20 EC 3E 02 E0 E3 E0 D4 AF E0 D3 C9 F0 A6 A7 C0 3E 01 E0 FF 3E 03 E0 CD F0 D1 FE 77 20 0C F0 D0 FE AA 20 10 3E 01 E0 EF 18 0A FE AA 20 06 F0 D0 FE 77 28 F0 06 34 0E 43 CD 3F 11 AF E0 E3 F0 D1 FE AA 3E 1E 20 02 3E 1D E0 E1 3E 28 E0 A6 3E 1D E0 C6 C9 F0 A6 A7 C0 F0 EF A7 20 05 F0 D7 3C E0 D7 CD 6F 0F 11 F9 26 F0 CB FE 29 28 03 11 0B 27 21 00 C2 0E 03 CD 76 17 3E 19 E0 A6 F0 EF A7 28 05 21 20 C2 36 80 3E 03 CD 73 26 3E 20 E0 E1 3E 09 EA E8 DF F0 D7 FE 05 C0 3E 11 EA E8 DF C9 F0 D7 FE 05 20 07 F0 C6 A7 28 08 18 22 F0 81 CB 5F 28 1C 3E 60 E0 CF E0 CE 18 1D 3E 01 E0 FF F0 CC 28 0C F0 CB FE 29 28 D7 F0 D0 FE 60 28 09 CD BD 0D 3E 03 CD 73 26 C9 3E 1F E0 E1 E0 CC C9 F0 A6 A7 20 23 21 C6 FF 35 3E 19 E0 A6 CD 60 0F 21 01 C2 7E EE 30 22 FE 60 CC 17 0F 2C F5 7E EE 01 77 2E 13 32 F1 2D 77 F0 D7 FE 05 20 28 F0 C6 21 21 C2 FE 06 28 1B FE 08 30 1B 7E FE 72 30 06 FE 69 C8 34 34 C9 36 69 2C 2C 36 57 3E 06 EA E0 DF C9 2D 36 80 C9 F0 A7 A7 C0 3E 0F E0 A7 21 23 C2 7E EE 01 77 C9 F0 A6 A7 C0 F0 EF A7 20 05 F0 D8 3C E0 D8 CD 6F 0F 11 1D 27 F0 CB FE 29 28 03 11 29 27 21 00 C2 0E 02 CD 76 17 3E 19 E0 A6 F0 EF A7 28 05 21 10 C2 36 80 3E 02 CD 73 26 3E 21 E0 E1 3E 09 EA E8 DF F0 D8 FE 05 C0 3E 11 EA E8 DF C9 F0 D8 FE 05 20 07 F0 C6 A7 28 08 18 22 F0 81 CB 5F 28 1C 3E 60 E0 CF E0 CE 18 1D 3E 01 E0 FF F0 CC 28 0C F0 CB FE 29 28 D7 F0 D0 FE 60 28 09 CD AE 0E 3E 02 CD 73 26 C9 3E 1F E0 E1 E0 CC C9 F0 A6 A7 20 1C 21 C6 FF 35 3E 19 E0 A6 CD 60 0F 21 11 C2 7E EE 08 22 FE 68 CC 17 0F 2C 7E EE 01 77 F0 D8 FE 05 20 32 F0 C6 21 01 C2 FE 05 28 25 FE 06 28 11 FE 08 30 21 7E FE 72 30 18 FE 61 C8 34 34 34 34 C9 2D 36 00 2C 36 61 2C 2C 36 56 3E 06 EA E0 DF C9 2D 36 80 C9 F0 A7 A7 C0 3E 0F E0 A7 21 03 C2 7E EE 01 77 C9 F5 E5 F0 D7 FE 05 28 1A F0 D8 FE 05 28 14 F0 CB FE 29 20 0E 21 60 C0 06 24 11 3C 0F 1A 22 13 05 20 FA E1 F1 C9 42 30 0D 00 42 38 B2 00 42 40 0E 00 42 48 1C 00 42 58 0E 00 42 60 1D 00 42 68 B5 00 42 70 BB 00 42 78 1D 00 21 60 C0 11 04 00 06 09 AF 77 19 05 20 FB C9 CD 20 28 21 AC 55 01 00 10 CD E4 27 CD 95 27 21 00 98 11 E4 54 06 04 CD F0 27 21 80 99 06 06 CD F0 27 F0 CB FE 29 20 22 21 41 98 36 BD 2C 36 B2 2C 36 2E 2C 36 BE 2C 36 2E 21 01 9A 36 B4 2C 36 B5 2C 36 BB 2C 36 2E 2C 36 BC F0 EF A7 20 03 CD 85 10 F0 D7 A7 28 49 FE 05 20 16 21 A5 98 06 0B F0 CB FE 29 11 F3 10 28 03 11 FE 10 CD D8 10 3E 04 4F F0 CB FE 29 3E 93 20 02 3E 8F E0 A0 21 E7 99 CD 6A 10 F0 D9 A7 28 17 3E AC E0 A0 21 F0 99 0E 01 CD 6A 10 21 A6 98 11 09 11 06 09 CD D8 10 F0 D8 A7 28 3E FE 05 20 16 21 A5 98 06 0B F0 CB FE 29 11 FE 10 28 03 11 F3 10 CD D8 10 3E 04 4F F0 CB FE 29 3E 8F 20 02 3E 93 E0 A0 21 27 98 CD 6A 10 F0 DA A7 28 0C 3E AC E0 A0 21 30 98 0E 01 CD 6A 10 F0 DB A7 28 0B 21 A7 98 11 ED 10 06 06 CD D8 10 3E D3 E0 40 CD 8A 17 C9 F0 A0 E5 11 20 00 06 02 E5 22 3C 77 3C E1 19 05 20 F6 E1 11 03 00 19 0D 20 E6 C9 21 D7 FF 11 D8 FF F0 D9 A7 20 3A F0 DA A7 20 3C F0 DB A7 20 21 7E FE 04 28 11 1A FE 04 C0 3E 05 12 18 0A 1A FE 03 C0 3E 03 18 05 36 05 AF E0 DB AF E0 D9 E0 DA C9 7E FE 04 20 06 E0 D9 AF E0 DB C9 E0 DA 18 F8 7E FE 05 28 E1 18 DB 1A FE 05 28 CD 18 D4 C5 E5 1A 22 13 05 20 FA E1 11 20 00 19 C1 3E B6 22 05 20 FC C9 B0 B1 B2 B3 B1 3E B4 B5 BB 2E BC 2F 2D 2E 3D 0E 3E BD B2 2E BE 2E 2F 2D 2E 3D 0E 3E B5 B0 41 B5 3D 1D B5 BE B1 3E 01 E0 FF F0 A6 A7 C0 CD 8A 17 AF E0 EF 06 27 0E 79 CD 3F 11 CD F3 7F F0 D7 FE 05 28 0A F0 D8 FE 05 28 04 3E 01 E0 D6 3E 16 E0 E1 C9 F0 CC A7 28 14 AF E0 CC F0 CB FE 29 F0 D0 20 11 B8 28 08 3E 02 E0 CF E0 CE E1 C9 79 E0 CF E0 CE C9 B9 C8 78 E0 CF E1 C9 CD B2 11 21 E6 9C 11 1B 14 06 07 CD 37 14 21 E7 9C 11 22 14 06 07 CD 37 14 21 08 9D 36 72 2C 36 C4 21 28 9D 36 B7 2C 36 B8 11 71 27 21 00 C2 0E 03 CD 76 17 3E 03 CD 73 26 3E DB E0 40 3E BB E0 A6 3E 27 E0 E1 3E 10 EA E8 DF C9 CD 20 28 21 AC 55 01 00 10 CD E4 27 21 FF 9F CD 98 27 21 C0 9D 11 C4 51 06 04 CD F0 27 21 EC 9C 11 29 14 06 07 CD 37 14 21 ED 9C 11 30 14 06 07 CD 37 14 C9 F0 A6 A7 C0 21 10 C2 36 00 2E 20 36 00 3E FF E0 A6 3E 28 E0 E1 C9 F0 A6 A7 28 04 CD FA 13 C9 3E 29 E0 E1 21 13 C2 36 35 2E 23 36 35 3E FF E0 A6 3E 2F CD D7 1F C9 F0 A6 A7 28 04 CD FA 13 C9 3E 02 E0 E1 21 08 9D 06 2F CD FF 19 21 09 9D CD FF 19 21 28 9D CD FF 19 21 29 9D CD FF 19 C9 F0 A6 A7 20 2E 3E 0A E0 A6 21 01 C2 35 7E FE 58 20 21 21 10 C2 36 00 2C C6 20 22 36 4C 2C 36 40 2E 20 36 80 3E 03 CD 73 26 3E 03 E0 E1 3E 04 EA F8 DF C9 CD FA 13 C9 F0 A6 A7 20 1D 3E 0A E0 A6 21 11 C2 35 2E 01 35 7E FE D0 20 0D 3E 9C E0 C9 3E 82 E0 CA 3E 2C E0 E1 C9 F0 A7 A7 20 0B 3E 06 E0 A7 21 13 C2 7E EE 01 77 3E 03 CD 73 26 C9 F0 A6 A7 C0 3E 06 E0 A6 F0 CA D6 82 5F 16 00 21 F5 12 19 E5 D1 F0 C9 67 F0 CA 6F 1A CD FE 19 E5 11 20 00 19 06 B6 CD FF 19 E1 23 3E 02 EA E0 DF 7C E0 C9 7D E0 CA FE 92 C0 3E FF E0 A6 3E 2D E0 E1 C9 B3 BC 3D BE BB B5 1D B2 BD B5 1D 2E BC 3D 0E 3E F0 A6 A7 C0 CD 20 28 CD AD 27 CD 93 22 3E 93 E0 40 3E 05 E0 E1 C9 F0 A6 A7 C0 3E 2E E0 E1 C9 CD B2 11 11 83 27 21 00 C2 0E 03 CD 76 17 F0 F3 EA 03 C2 3E 03 CD 73 26 AF E0 F3 3E DB E0 40 3E BB E0 A6 3E 2F E0 E1 3E 10 EA E8 DF C9 F0 A6 A7 C0 21 10 C2 36 00 2E 20 36 00 3E A0 E0 A6 3E 30 E0 E1 C9 F0 A6 A7 28 04 CD FA 13 C9 3E 31 E0 E1 3E 80 E0 A6 3E 2F CD D7 1F C9 F0 A6 A7 20 2E 3E 0A E0 A6 21 01 C2 35 7E FE 6A 20 21 21 10 C2 36 00 2C C6 10 22 36 54 2C 36 5C 2E 20 36 80 3E 03 CD 73 26 3E 32 E0 E1 3E 04 EA F8 DF C9 CD FA 13 C9 F0 A6 A7 20 15 3E 0A E0 A6 21 11 C2 35 2E 01 35 7E FE E0 20 05 3E 33 E0 E1 C9 F0 A7 A7 20 0B 3E 06 E0 A7 21 13 C2 7E EE 01 77 3E 03 CD 73 26 C9 CD 20 28 CD AD 27 CD F3 7F CD 93 22 3E 93 E0 40 3E 10 E0 E1 C9 F0 A7 A7 C0 3E 0A E0 A7 3E 03 EA F8 DF 06 02 21 10 C2 7E EE 80 77 2E 20 05 20 F7 3E 03 CD 73 26 C9 C2 CA CA CA CA CA CA C3 CB 58 48 48 48 48 C8 73 73 73 73 73 73 C9 74 74 74 74 74 74 1A 77 13 D5 11 20 00 19 D1 05 20 F4 C9 3E 01 E0 FF AF E0 01 E0 02 E0 0F CD 20 28 CD AD 27 11 D7 4C CD EB 27 CD 8A 17 21 00 C2 11 CF 26 0E 02 CD 76 17 11 01 C2 CD 8D 14 F0 C0 1E 12 12 13 FE 37 3E 1C 28 02 3E 1D 12 CD 71 26 CD 17 15 3E D3 E0 40 3E 0E E0 E1 C9 3E 01 EA E0 DF F0 C1 F5 D6 1C 87 4F 06 00 21 A8 14 09 2A 12 13 7E 12 13 F1 12 C9 70 37 70 77 80 37 80 77 11 00 C2 CD 66 17 21 C1 FF 7E CB 58 C2 63 15 CB 40 C2 63 15 CB 48 20 41 1C CB 60 20 26 CB 68 20 2D CB 70 20 16 CB 78 CA 5F 15 FE 1E 30 09 C6 02 77 CD 8D 14 CD 17 15 CD 71 26 C9 FE 1E 38 F8 D6 02 18 ED FE 1D 28 F0 FE 1F 28 EC 3C 18 E2 FE 1C 28 E5 FE 1E 28 E1 3D 18 D7 F5 F0 C5 A7 28 03 F1 18 B6 F1 3E 0E 18 5B F0 C1 D6 17 FE 08 20 02 3E FF EA E8 DF C9 11 10 C2 CD 66 17 21 C0 FF 7E CB 58 20 30 CB 40 20 40 1C 1C CB 60 20 0E CB 68 28 1E FE 37 28 1A 3E 37 06 1C 18 08 FE 77 28 10 3E 77 06 1D 77 F5 3E 01 EA E0 DF F1 12 13 78 12 CD 71 26 C9 3E 02 EA E0 DF F0 C0 FE 37 3E 10 28 02 3E 12 E0 E1 AF 18 E7 3E 0F 18 F7 CD 20 28 11 3F 4E CD EB 27 CD FC 18 CD 8A 17 21 00 C2 11 DB 26 0E 01 CD 76 17 11 01 C2 F0 C2 21 15 16 CD 4E 17 CD 71 26 CD 95 17 CD CA 18 3E D3 E0 40 3E 11 E0 E1 F0 C7 A7 20 04 CD 17 15 C9 3E 15 E0 E1 C9 11 00 C2 CD 66 17 21 C2 FF 3E 0A CB 58 20 EE CB 40 20 EA 3E 08 CB 48 20 E4 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 05 30 16 C6 05 18 05 FE 09 28 0E 3C 77 11 01 C2 21 15 16 CD 4E 17 CD 95 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 05 38 F2 D6 05 18 E1 40 30 40 40 40 50 40 60 40 70 50 30 50 40 50 50 50 60 50 70 CD 20 28 11 A7 4F CD EB 27 CD 8A 17 21 00 C2 11 E1 26 0E 02 CD 76 17 11 01 C2 F0 C3 21 D2 16 CD 4E 17 11 11 C2 F0 C4 21 41 17 CD 4E 17 CD 71 26 CD AF 17 CD CA 18 3E D3 E0 40 3E 13 E0 E1 F0 C7 A7 20 04 CD 17 15 C9 3E 15 E0 E1 C9 E0 E1 AF 12 C9 11 00 C2 CD 66 17 21 C3 FF 3E 0A CB 58 20 EC 3E 14 CB 40 20 E6 3E 08 CB 48 20 E0 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 05 30 16 C6 05 18 05 FE 09 28 0E 3C 77 11 01 C2 21 D2 16 CD 4E 17 CD AF 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 05 38 F2 D6 05 18 E1 40 18 40 28 40 38 40 48 40 58 50 18 50 28 50 38 50 48 50 58 E0 E1 AF 12 C9 11 10 C2 CD 66 17 21 C4 FF 3E 0A CB 58 20 EC CB 40 20 E8 3E 13 CB 48 20 E2 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 03 30 16 C6 03 18 05 FE 05 28 0E 3C 77 11 11 C2 21 41 17 CD 4E 17 CD AF 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 03 38 F2 D6 03 18 E1 40 70 40 80 40 90 50 70 50 80 50 90 00 F5 3E 01 EA E0 DF F1 F5 87 4F 06 00 09 2A 12 13 7E 12 13 F1 C6 20 12 C9 F0 81 47 F0 A6 A7 C0 3E 10 E0 A6 1A EE 80 12 C9 E5 06 06 1A 22 13 05 20 FA E1 3E 10 85 6F 0D 20 EF 36 80 C9 AF 21 00 C0 06 A0 22 05 20 FC C9 CD FC 18 F0 C2 21 54 D6 11 1B 00 A7 28 04 3D 19 18 F9 23 23 E5 D1 CD 00 18 C9 CD FC 18 F0 C3 21 00 D0 11 A2 00 A7 28 04 3D 19 18 F9 F0 C4 11 1B 00 A7 28 04 3D 19 18 F9 23 23 E5 D1 CD 00 18 C9 06 03 7E E6 F0 20 0B 1C 3A E6 0F 20 0F 1C 05 20 F1 C9 7E E6 F0 CB 37 12 1C 3A E6 0F 12 1C 05 20 F1 C9 06 03 3A 12 1B 05 20 FA C9 7A E0 FB 7B E0 FC 0E 03 21 A2 C0 D5 06 03 1A 96 38 10 20 05 2D 1B 05 20 F5 D1 13 13 13 0D 20 E8 18 5E D1 F0 FB 57 F0 FC 5F D5 C5 21 06 00 19 E5 D1 2B 2B 2B 0D 28 05 CD F7 17 18 F8 21 A2 C0 06 03 3A 12 1D 05 20 FA C1 D1 79 E0 C8 21 12 00 19 E5 11 06 00 19 E5 D1 E1 0D 28 07 06 06 CD F9 17 18 F6 3E 60 06 05 12 1B 05 20 FB 3E 0A 12 7A E0 C9 7B E0 CA AF E0 9C E0 C6 3E 01 EA E8 DF E0 C7 11 AC C9 F0 FB 67 F0 FC 6F 06 03 E5 D5 C5 CD D5 17 C1 D1 21 20 00 19 E5 D1 E1 D5 11 03 00 19 D1 05 20 E8 2B 2B 06 03 11 A4 C9 D5 0E 06 2A A7 28 05 12 13 0D 20 F7 D1 E5 21 20 00 19 E5 D1 E1 05 20 E8 CD 51 26 3E 01 E0 E8 C9 F0 E8 A7 C8 21 A4 99 11 A4 C9 0E 06 E5 06 06 1A 22 1C 05 20 FA 1C 2C 1C 2C 0D 28 11 CB 41 20 ED E1 11 20 00 19 E5 D1 3E 30 82 57 18 DF E1 AF E0 E8 C9 21 A4 C9 11 20 00 3E 60 0E 03 06 0E E5 22 05 20 FC E1 19 0D 20 F4 C9 F0 C8 21 E4 99 11 E0 FF 3D 28 03 19 18 FA F0 C6 5F 16 00 19 F0 C9 57 F0 CA 5F F0 A6 A7 20 12 3E 07 E0 A6 F0 9C EE 01 E0 9C 1A 28 02 3E 2F CD FE 19 F0 81 47 F0 80 4F 3E 17 CB 70 20 37 CB 71 20 2B CB 78 20 58 CB 79 20 4C CB 40 20 6C CB 48 C2 EE 19 CB 58 C8 1A CD FE 19 CD 17 15 AF E0 C7 F0 C0 FE 37 3E 11 28 02 3E 13 E0 E1 C9 F0 AA 3D E0 AA C0 3E 09 E0 AA 06 26 F0 F4 A7 28 02 06 27 1A B8 20 0A 3E 2E 3C 12 3E 01 EA E0 DF C9 FE 2F 20 F4 3E 0A 18 F1 F0 AA 3D E0 AA C0 3E 09 E0 AA 06 26 F0 F4 A7 28 02 06 27 1A FE 0A 20 05 3E 30 3D 18 D4 FE 2F 20 F9 78 18 CD 1A CD FE 19 3E 02 EA E0 DF F0 C6 3C FE 06 28 8C E0 C6 13 1A FE 60 20 03 3E 0A 12 7A E0 C9 7B E0 CA C9 F0 C6 A7 C8 1A CD FE 19 F0 C6 3D E0 C6 1B 18 E9 47 F0 41 E6 03 20 FA 70 C9 CD 20 28 AF EA 10 C2 E0 98 E0 9C E0 9B E0 FB E0 9F 3E 2F CD D7 1F CD F2 1F CD 51 26 AF E0 E3 CD 8A 17 F0 C0 11 F7 3F 21 C3 FF FE 77 3E 50 28 08 3E F1 21 C2 FF 11 8F 3E D5 E0 E6 7E E0 A9 CD EB 27 D1 21 00 9C CD EE 27 11 39 28 21 63 9C 0E 0A CD 7D 1F 26 98 F0 E6 6F F0 A9 77 26 9C 77 F0 F4 A7 28 07 23 36 27 26 98 36 27 21 00 C2 11 BF 26 CD B6 26 21 10 C2 11 C7 26 CD B6 26 21 51 99 F0 C0 FE 77 3E 25 28 01 AF E0 9E E6 0F 32 28 02 36 02 CD E8 1A FA DE C0 A7 28 05 3E 80 EA 10 C2 CD 07 20 CD 07 20 CD 07 20 CD 83 26 AF E0 A0 F0 C0 FE 77 20 25 3E 34 E0 99 F0 C4 21 B0 98 77 26 9C 77 A7 28 15 47 F0 E4 A7 28 05 CD 1B 1B 18 0A 78 11 C0 FF 21 02 9A CD 68 1B 3E D3 E0 40 AF E0 E1 C9 F0 A9 5F F0 F4 A7 28 0A 3E 0A 83 FE 15 38 02 3E 14 5F 21 06 1B 16 00 19 7E E0 99 E0 9A C9 34 30 2C 28 24 20 1B 15 10 0A 09 08 07 06 05 05 04 04 03 03 02 21 C2 99 11 40 1B 0E 04 06 0A E5 1A 77 E5 7C C6 30 67 1A 77 E1 2C 13 05 20 F1 E1 D5 11 20 00 19 D1 0D 20 E4 C9 85 2F 82 86 83 2F 2F 80 82 85 2F 82 84 82 83 2F 83 2F 87 2F 2F 85 2F 83 2F 86 82 80 81 2F 83 2F 86 83 2F 85 2F 85 2F 2F 47 05 28 03 19 18 FA F0 04 47 3E 80 05 28 08 FE 80 20 F7 3E 2F 18 F5 FE 2F 28 08 F0 04 E6 07 F6 80 18 02 E0 A0 F5 7D E6 0F FE 0B 20 0B F0 A0 FE 2F 28 05 F1 3E 2F 18 01 F1 77 E5 F5 F0 C5 A7 20 04 11 00 30 19 F1 77 E1 23 7D E6 0F FE 0C 20 B7 AF E0 A0 7C E6 0F FE 0A 28 06 11 16 00 19 18 A7 7D FE 2C 20 F5 C9 CD 0D 1C F0 AB A7 C0 CD 0C 05 CD 42 05 CD 83 05 CD BB 24 CD 9C 20 CD 3E 21 CD A1 25 CD 4D 22 CD 91 1F CD B3 05 C9 CB 57 C8 FA DE C0 EE 01 EA DE C0 28 09 3E 80 EA 10 C2 CD 96 26 C9 AF 18 F6 F0 80 E6 0F FE 0F CA 1B 02 F0 E4 A7 C0 F0 81 CB 5F 28 D4 F0 C5 A7 20 45 21 40 FF F0 AB EE 01 E0 AB 28 2A CB DE 3E 01 EA 7F DF 21 4E 99 11 4E 9D 06 04 F0 41 E6 03 20 FA 2A 12 13 05 20 F4 3E 80 EA 10 C2 EA 00 C2 CD 83 26 CD 96 26 C9 CB 9E 3E 02 EA 7F DF FA DE C0 A7 28 E6 AF 18 E6 F0 CB FE 29 C0 F0 AB EE 01 E0 AB 28 33 3E 01 EA 7F DF F0 D0 E0 F2 F0 CF E0 F1 CD CB 1C C9 F0 AB A7 C8 F0 CC 28 39 AF E0 CC F0 CB FE 29 20 08 3E 94 E0 CF E0 CE E1 C9 AF E0 CF F0 D0 FE 94 28 1F F0 F2 E0 D0 F0 F1 E0 CF 3E 02 EA 7F DF AF E0 AB 21 EE 98 06 8E 0E 05 CD FF 19 2C 0D 20 F9 C9 E1 C9 21 EE 98 0E 05 11 DD 1C 1A CD FE 19 13 2C 0D 20 F7 C9 19 0A 1E 1C 0E 3E 80 EA 00 C2 EA 10 C2 CD 83 26 CD 96 26 AF E0 98 E0 9C CD 93 22 3E 87 CD D7 1F 3E 46 E0 A6 3E 0D E0 E1 C9 F0 81 CB 47 20 03 CB 5F C8 AF E0 E3 F0 C5 A7 3E 16 20 0A F0 C0 FE 37 3E 10 28 02 3E 12 E0 E1 C9 F0 A6 A7 C0 21 02 C8 11 89 28 CD 04 28 F0 C3 A7 28 2E 11 40 00 21 27 C8 CD 84 1D 11 00 01 21 87 C8 CD 84 1D 11 00 03 21 E7 C8 CD 84 1D 11 00 12 21 47 C9 CD 84 1D 21 A0 C0 06 03 AF 22 05 20 FC 3E 80 E0 A6 3E 80 EA 00 C2 EA 10 C2 CD 83 26 CD 96 26 CD F3 7F 3E 25 E0 9E 3E 0B E0 E1 C9 E5 21 A0 C0 06 03 AF 22 05 20 FC F0 C3 47 04 21 A0 C0 CD 66 01 05 20 F7 E1 06 03 11 A2 C0 1A E6 F0 20 0A 1A E6 0F 20 0B 1D 05 20 F2 C9 1A E6 F0 CB 37 22 1A E6 0F 22 1D 05 20 F2 C9 F0 A6 A7 C0 3E 01 EA C6 C0 3E 05 E0 A6 C9 F0 A6 A7 C0 21 02 C8 11 0F 51 CD 04 28 CD 8A 17 21 00 C2 11 35 27 0E 0A CD 76 17 3E 10 21 66 C2 77 2E 76 77 21 0E C2 11 31 1E 06 0A 1A 22 22 13 D5 11 0E 00 19 D1 05 20 F3 F0 C4 FE 05 20 02 3E 09 3C 47 21 00 C2 11 10 00 AF 77 19 05 20 FB F0 C4 C6 0A EA E8 DF 3E 25 E0 9E 3E 1B E0 A6 3E 23 E0 E1 C9 1C 0F 1E 32 20 18 26 1D 28 2B 3E 0A CD 73 26 C9 F0 A6 FE 14 28 F4 A7 C0 21 0E C2 11 10 00 06 0A E5 35 20 15 2C 3A 77 7D E6 F0 F6 03 6F 7E EE 01 77 FE 50 28 23 FE 51 28 25 E1 19 05 20 E2 3E 0A CD 73 26 FA E9 DF A7 C0 CD 8A 17 F0 C4 FE 05 3E 26 28 02 3E 05 E0 E1 C9 2D 2D 36 67 18 DB 2D 2D 36 5D 18 D5 AF EA C6 C0 11 C0 C0 1A 6F 13 1A 67 B5 CA 3A 26 2B 7C 12 1B 7D 12 11 01 00 21 C2 C0 D5 CD 66 01 11 C4 C0 21 A5 99 CD 36 2A AF E0 A6 D1 21 A0 C0 CD 66 01 11 A2 C0 21 25 9A CD 3A 2A 3E 02 EA E0 DF C9 FA C6 C0 A7 C8 FA C5 C0 FE 04 28 B2 11 40 00 01 23 98 21 AC C0 A7 28 23 11 00 01 01 83 98 21 B1 C0 FE 01 28 16 11 00 03 01 E3 98 21 B6 C0 FE 02 28 09 11 00 12 01 43 99 21 BB C0 CD D9 25 C9 F0 81 A7 C8 3E 02 E0 E1 C9 F0 A6 A7 C0 3E 04 EA E8 DF F0 C5 A7 28 0A 3E 3F E0 A6 3E 1B E0 CC 18 37 3E 2F CD D7 1F 21 43 C8 11 3E 29 0E 07 CD 7D 1F 21 83 C9 11 76 29 0E 06 CD 7D 1F F0 C0 FE 37 20 14 21 A2 C0 7E 06 58 FE 20 30 0F 04 FE 15 30 0A 04 FE 10 30 05 3E 04 E0 E1 C9 78 E0 F3 3E 90 E0 A6 3E 34 E0 E1 C9 06 08 E5 1A 22 13 05 20 FA E1 D5 11 20 00 19 D1 0D 20 ED C9 F0 C0 FE 37 C0 F0 E1 A7 C0 F0 E3 FE 05 C0 21 AC C0 01 05 00 7E 11 40 00 A7 20 17 09 7E 11 00 01 A7 20 0F 09 7E 11 00 03 A7 20 07 09 11 00 12 7E A7 C8 36 00 F0 A9 47 04 C5 D5 21 A0 C0 CD 66 01 D1 C1 05 20 F3 C9 F5 3E 02 E0 E3 F1 21 02 C8 0E 12 11 20 00 E5 06 0A 22 05 20 FC E1 19 0D 20 F4 C9 21 C2 CB 11 16 00 0E 02 3E 2F 06 0A 22 05 20 FC 19 0D 20 F6 C9 21 00 C2 36 00 2C 36 18 2C 36 3F 2C FA 13 C2 77 E6 FC 4F F0 E4 A7 20 05 F0 C5 A7 28 1D 26 C3 F0 B0 6F 5E 23 7C FE C4 20 03 21 00 C3 7D E0 B0 F0 D3 A7 28 2A F6 80 E0 D3 18 24 26 03 F0 04 47 AF 05 28 0A 3C 3C 3C 3C FE 1C 28 F4 18 F3 57 F0 AE 5F 25 28 07 B2 B1 E6 FC B9 28 E1 7A E0 AE 7B EA 13 C2 CD 96 26 F0 9A E0 99 C9 FA C7 C0 A7 28 0C F0 81 E6 B0 FE 80 20 25 AF EA C7 C0 F0 A7 A7 20 29 F0 98 A7 20 24 F0 E3 A7 20 1F 3E 03 E0 A7 21 E5 FF 34 18 26 F0 80 E6 B0 FE 80 28 CD 21 E5 FF 36 00 F0 99 A7 28 07 3D E0 99 CD 83 26 C9 F0 98 FE 03 C8 F0 E3 A7 C0 F0 9A E0 99 21 01 C2 7E E0 A0 C6 08 77 CD 83 26 CD 73 25 A7 C8 F0 A0 21 01 C2 77 CD 83 26 3E 01 E0 98 EA C7 C0 F0 E5 A7 28 1B 4F F0 C0 FE 37 28 37 11 C0 C0 1A 6F 13 1A 67 06 00 0D 09 7C 12 7D 1B 12 AF E0 E5 FA 01 C2 FE 18 C0 FA 02 C2 FE 3F C0 21 FB FF 7E FE 01 20 0D CD F3 7F 3E 01 E0 E1 3E 02 EA F0 DF C9 34 C9 AF 0D 28 04 3C 27 18 F9 5F 16 00 21 A0 C0 CD 66 01 3E 01 EA CE C0 18 C2 F0 98 FE 02 C0 3E 02 EA F8 DF AF E0 A0 11 A3 C0 21 42 C8 06 10 0E 0A E5 2A FE 2F CA D8 21 0D 20 F7 E1 7C 12 13 7D 12 13 F0 A0 3C E0 A0 D5 11 20 00 19 D1 05 20 DF 3E 03 E0 98 3D E0 A6 F0 A0 A7 C8 47 21 9E FF F0 C0 FE 77 28 12 78 86 27 22 3E 00 8E 27 77 30 16 36 99 2B 36 99 18 0F 7E B7 90 28 3B 38 39 27 77 E6 F0 FE 90 28 31 78 0E 06 21 AC C0 06 00 FE 01 28 19 21 B1 C0 06 01 FE 02 28 10 21 B6 C0 06 02 FE 03 28 07 21 BB C0 06 04 0E 07 34 78 E0 DC 79 EA E0 DF C9 E1 18 90 AF E0 9E 18 CA F0 98 FE 03 C0 F0 A6 A7 C0 11 A3 C0 F0 9C CB 47 20 3C 1A A7 28 52 D6 30 67 13 1A 6F F0 9C FE 06 3E 8C 20 02 3E 2F 0E 0A 22 0D 20 FC 13 1A A7 20 E5 F0 9C 3C E0 9C FE 07 28 05 3E 0A E0 A6 C9 AF E0 9C 3E 0D E0 A6 3E 01 E0 E3 AF E0 98 C9 1A 67 D6 30 4F 13 1A 6F 06 0A 7E E5 61 77 E1 23 05 20 F7 13 1A A7 20 E8 18 C9 CD 07 20 18 DD F0 A6 A7 C0 F0 E3 FE 01 C0 11 A3 C0 1A 67 13 1A 6F D5 E5 01 E0 FF 09 D1 E5 06 0A 2A 12 13 05 20 FA E1 E5 D1 01 E0 FF 09 7C FE C7 20 EB D1 13 1A A7 20 DA 21 02 C8 3E 2F 06 0A 22 05 20 FC CD 93 22 3E 02 E0 E3 C9 21 A3 C0 AF 06 09 22 05 20 FC C9 F0 E3 FE 02 C0 21 22 9A 11 22 CA CD AC 24 C9 F0 E3 FE 03 C0 21 02 9A 11 02 CA CD AC 24 C9 F0 E3 FE 04 C0 21 E2 99 11 E2 C9 CD AC 24 C9 F0 E3 FE 05 C0 21 C2 99 11 C2 C9 CD AC 24 C9 F0 E3 FE 06 C0 21 A2 99 11 A2 C9 CD AC 24 C9 F0 E3 FE 07 C0 21 82 99 11 82 C9 CD AC 24 C9 F0 E3 FE 08 C0 21 62 99 11 62 C9 CD AC 24 F0 C5 A7 F0 E1 20 08 A7 C0 3E 01 EA F8 DF C9 FE 1A C0 F0 D4 A7 28 F2 3E 05 EA E0 DF C9 F0 E3 FE 09 C0 21 42 99 11 42 C9 CD AC 24 C9 F0 E3 FE 0A C0 21 22 99 11 22 C9 CD AC 24 C9 F0 E3 FE 0B C0 21 02 99 11 02 C9 CD AC 24 C9 F0 E3 FE 0C C0 21 E2 98 11 E2 C8 CD AC 24 C9 F0 E3 FE 0D C0 21 C2 98 11 C2 C8 CD AC 24 C9 F0 E3 FE 0E C0 21 A2 98 11 A2 C8 CD AC 24 C9 F0 E3 FE 0F C0 21 82 98 11 82 C8 CD AC 24 C9 F0 E3 FE 10 C0 21 62 98 11 62 C8 CD AC 24 CD 4B 24 C9 F0 E3 FE 11 C0 21 42 98 11 42 C8 CD AC 24 21 6D 9C CD 3B 24 3E 01 E0 E0 C9 F0 E3 FE 12 C0 21 22 98 11 22 C8 CD AC 24 21 6D 98 CD 3B 24 C9 F0 E3 FE 13 C0 EA C7 C0 21 02 98 11 02 C8 CD AC 24 AF E0 E3 F0 C5 A7 F0 E1 20 48 A7 C0 21 4E 99 11 9F FF 0E 02 F0 C0 FE 37 28 08 21 50 99 11 9E FF 0E 01 CD 3C 2A F0 C0 FE 37 28 23 F0 9E A7 20 1E 3E 64 E0 A6 3E 02 EA E8 DF F0 C5 A7 28 03 E0 D5 C9 F0 C3 FE 09 3E 05 20 02 3E 22 E0 E1 C9 CD 07 20 C9 FE 1A C0 F0 D4 A7 28 B2 AF E0 D4 C9 F0 E1 A7 C0 F0 C0 FE 37 C0 11 A2 C0 CD 36 2A C9 F0 E1 A7 C0 F0 C0 FE 37 C0 21 A9 FF 7E FE 14 C8 CD 9D 24 F0 9F 57 E6 F0 C0 7A E6 0F CB 37 57 F0 9E E6 F0 CB 37 B2 B8 D8 C8 34 CD 9D 24 E6 0F 4F 21 F1 98 71 26 9C 71 78 E6 F0 28 0D CB 37 4F 7D FE F0 28 05 21 F0 98 18 EA 3E 08 EA E0 DF CD E8 1A C9 7E 47 A7 C8 AF B7 3C 27 05 28 02 18 F8 47 C9 06 0A 1A 77 2C 1C 05 20 F9 F0 E3 3C E0 E3 C9 21 00 C2 7E FE 80 C8 2E 03 7E E0 A0 F0 81 47 CB 48 20 12 CB 40 28 37 7E E6 03 28 03 35 18 14 7E F6 03 77 18 0E 7E E6 03 FE 03 28 03 34 18 04 7E E6 FC 77 3E 03 EA E0 DF CD 83 26 CD 73 25 A7 28 0D AF EA E0 DF 21 03 C2 F0 A0 77 CD 83 26 21 02 C2 F0 81 47 F0 80 4F 7E E0 A0 CB 60 3E 17 20 0C CB 61 28 2D F0 AA 3D E0 AA C0 3E 09 E0 AA 7E C6 08 77 CD 83 26 3E 04 EA E0 DF CD 73 25 A7 C8 21 02 C2 AF EA E0 DF F0 A0 77 CD 83 26 3E 01 E0 AA C9 CB 68 3E 17 20 0C CB 69 28 F3 F0 AA 3D E0 AA C0 3E 09 E0 AA 7E D6 08 77 3E 04 EA E0 DF CD 83 26 CD 73 25 A7 C8 18 C7 21 10 C0 06 04 2A E0 B2 2A A7 28 17 E0 B3 E5 C5 CD E3 29 7C C6 30 67 7E FE 2F 20 0B C1 E1 2C 2C 05 20 E2 AF E0 9B C9 C1 E1 3E 01 E0 9B C9 F0 98 FE 01 C0 21 10 C0 06 04 2A E0 B2 2A A7 28 1D E0 B3 E5 C5 CD E3 29 E5 D1 C1 E1 F0 41 E6 03 20 FA 7E 12 7A C6 30 57 2A 12 2C 05 20 DC 3E 02 E0 98 21 00 C2 36 80 C9 FA C6 C0 FE 02 28 46 D5 7E B7 28 54 3D 22 7E 3C 27 77 E6 0F 02 0D 2A CB 37 E6 0F 28 01 02 C5 F0 C3 47 04 E5 CD 66 01 E1 05 20 F8 C1 23 23 E5 21 23 00 09 D1 CD 3A 2A D1 F0 C3 47 04 21 A0 C0 E5 CD 66 01 E1 05 20 F8 3E 02 EA C6 C0 C9 11 A2 C0 21 25 9A CD 3A 2A 3E 02 EA E0 DF AF EA C6 C0 C9 D1 3E 21 E0 A6 AF EA C6 C0 FA C5 C0 3C EA C5 C0 FE 05 C0 3E 04 E0 E1 C9 21 AC C0 06 1B AF 22 05 20 FC 21 A0 C0 06 03 22 05 20 FC C9 7E E6 F0 CB 37 12 7E E6 0F 1C 12 C9 3E 02 E0 8F AF E0 8E 3E C0 E0 8D 21 00 C2 CD 89 2A C9 3E 01 E0 8F 3E 10 E0 8E 3E C0 E0 8D 21 00 C2 CD 89 2A C9 3E 01 E0 8F 3E 20 E0 8E 3E C0 E0 8D 21 10 C2 CD 89 2A C9 06 20 3E 8E 11 20 00 77 19 05 20 FB C9 1A FE FF C8 22 13 18 F8 D9 00 18 3F 00 80 00 00 FF 00 80 8F 00 80 00 00 FF 00 70 37 1C 00 00 00 38 37 1C 00 00 00 40 34 20 00 00 00 40 1C 20 00 00 00 40 74 20 00 00 00 40 68 21 00 00 00 78 68 21 00 00 00 60 60 2A 80 00 00 60 72 2A 80 20 00 68 38 3E 80 00 00 60 60 36 80 00 00 60 72 36 80 20 00 68 38 32 80 00 00 60 60 2E 80 00 00 68 38 3C 80 00 00 60 60 3A 80 00 00 68 38 30 80 00 80 3F 40 44 00 00 80 3F 20 4A 00 00 80 3F 30 46 00 00 80 77 20 48 00 00 80 87 48 4C 00 00 80 87 58 4E 00 00 80 67 4D 50 00 00 80 67 5D 52 00 00 80 8F 88 54 00 00 80 8F 98 55 00 00 00 5F 57 2C 00 00 80 80 50 34 00 00 80 80 60 34 00 20 00 6F 57 58 00 00 80 80 55 34 00 00 80 80 5B 34 00 20 21 FF 9B 01 00 04 3E 2F 32 0B 78 B1 20 F8 C9 2A 12 13 0B 78 B1 20 F8 C9 CD C3 27 01 A0 00 CD A4 27 21 3F 32 11 00 83 01 00 0D CD A4 27 C9 21 5F 41 01 38 01 11 00 80 2A 12 13 12 13 0B 78 B1 20 F6 C9 CD C3 27 01 A0 0D CD A4 27 C9 01 00 10 11 00 80 CD A4 27 C9 21 00 98 06 12 E5 0E 14 1A 22 13 0D 20 FA E1 D5 11 20 00 19 D1 05 20 ED C9 06 0A E5 1A FE FF 28 0E 22 13 05 20 F6 E1 D5 11 20 00 19 D1 18 EA E1 3E 02 E0 E3 C9 F0 FF E0 A1 CB 87 E0 FF F0 44 FE 91 20 FA F0 40 E6 7F E0 40 F0 A1 E0 FF C9 2F 2F 11 12 1D 2F 2F 2F 2F 2F 29 29 29 2F 2F 2F 2F 1C 1D 0A 1B 1D 2F 2F 2F 29 29 29 29 29 2F 2F 2F 2F 2F 1D 18 2F 2F 2F 2F 2F 2F 29 29 2F 2F 2F 0C 18 17 1D 12 17 1E 0E 29 29 29 29 29 29 29 29 2F 2F 10 0A 16 0E 2F 2F 2F 2F 29 29 29 29 2F 2F 1C 12 17 10 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 04 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 0D 18 1E 0B 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 01 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 1D 1B 12 19 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 03 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 1D 0E 1D 1B 12 1C 2F 2F 2F 2F 2F 00 2F 26 2F 01 02 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 0D 1B 18 19 1C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 29 29 29 29 29 29 29 29 29 29 1D 11 12 1C 2F 1C 1D 0A 10 0E 2F 2F 2F 2F 2F 2F 2F 2F 00 2F FF 61 62 62 62 62 62 62 63 64 2F 2F 2F 2F 2F 2F 65 64 2F 10 0A 16 0E 2F 65 64 2F AD AD AD AD 2F 65 64 2F 18 1F 0E 1B 2F 65 64 2F AD AD AD AD 2F 65 66 69 69 69 69 69 69 6A 19 15 0E 0A 1C 0E 2F 2F 29 29 29 29 29 29 2F 2F 2F 1D 1B 22 2F 2F 2F 2F 2F 29 29 29 2F 2F 2F 2F 2F 2F 0A 10 0A 12 17 27 2F 2F 29 29 29 29 29 2F 3E 20 E0 00 F0 00 F0 00 F0 00 F0 00 2F E6 0F CB 37 47 3E 10 E0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 2F E6 0F B0 4F F0 80 A9 A1 E0 81 79 E0 80 3E 30 E0 00 C9 F0 B2 D6 10 CB 3F CB 3F CB 3F 11 00 00 5F 21 00 98 06 20 19 05 20 FC F0 B3 D6 08 CB 3F CB 3F CB 3F 11 00 00 5F 19 7C E0 B5 7D E0 B4 C9 F0 B5 57 F0 B4 5F 06 04 CB 1A CB 1B 05 20 F9 7B D6 84 E6 FE 07 07 C6 08 E0 B2 F0 B4 E6 1F 17 17 17 C6 08 E0 B3 C9 F0 E0 A7 C8 0E 03 AF E0 E0 1A 47 CB 37 E6 0F 20 28 F0 E0 A7 3E 00 20 02 3E 2F 22 78 E6 0F 20 21 F0 E0 A7 3E 00 20 09 3E 01 B9 3E 00 28 02 3E 2F 22 1D 0D 20 D4 AF E0 E0 C9 F5 3E 01 E0 E0 F1 18 D9 F5 3E 01 E0 E0 F1 18 E7 3E C0 E0 46 3E 28 3D 20 FD C9 7C E0 96 7D E0 97 7E A7 28 1D FE 80 28 17 F0 96 67 F0 97 6F 11 10 00 19 F0 8F 3D E0 8F C8 18 E0 AF E0 95 18 E9 E0 95 06 07 11 86 FF 2A 12 13 05 20 FA F0 89 21 64 2B 07 5F 16 00 19 5E 23 56 1A 6F 13 1A 67 13 1A E0 90 13 1A E0 91 5E 23 56 23 F0 8C E0 94 7E FE FF 28 C7 FE FD 20 0E F0 8C EE 20 E0 94 23 7E 18 08 13 13 18 E4 FE FE 28 F8 E0 89 F0 87 47 1A 4F F0 8B CB 77 20 06 F0 90 80 89 18 0A 78 F5 F0 90 47 F1 90 99 DE 08 E0 93 F0 88 47 13 1A 13 4F F0 8B CB 6F 20 06 F0 91 80 89 18 0A 78 F5 F0 91 47 F1 90 99 DE 08 E0 92 E5 F0 8D 67 F0 8E 6F F0 95 A7 28 04 3E FF 18 02 F0 93 22 F0 92 22 F0 89 22 F0 94 47 F0 8B B0 47 F0 8A B0 22 7C E0 8D 7D E0 8E E1 C3 D8 2A 20 2C 24 2C 28 2C 2C 2C 30 2C 34 2C 38 2C 3C 2C 40 2C 44 2C 48 2C 4C 2C 50 2C 54 2C 58 2C 5C 2C 60 2C 64 2C 68 2C 6C 2C 70 2C 74 2C 78 2C 7C 2C 80 2C 84 2C 88 2C 8C 2C 90 2C 94 2C 98 2C 9C 2C A0 2C A4 2C A8 2C AC 2C B0 2C B4 2C B8 2C BC 2C C0 2C C4 2C C8 2C CC 2C C7 30 CC 2C D0 2C D4 2C D8 2C DC 2C E0 2C E4 2C EA 30 EE 30 E8 2C EC 2C F2 30 F6 30 F0 2C F4 2C F8 2C FC 2C 00 2D 04 2D FA 30 FE 30 04 2D 08 2D 08 2D 0C 2D 10 2D 14 2D 18 2D 1C 2D 20 2D 24 2D 28 2D 2C 2D 30 2D 34 2D 38 2D 3C 2D 40 2D 44 2D 48 2D 4C 2D 50 2D 54 2D 0A 31 0E 31 12 31 12 31 02 31 06 31 58 2D EF F0 68 2D EF F0 7A 2D EF F0 89 2D EF F0 9A 2D EF F0 AC 2D EF F0 BD 2D EF F0 CB 2D EF F0 DC 2D EF F0 EB 2D EF F0 FC 2D EF F0 0B 2E EF F0 1C 2E EF F0 2E 2E EF F0 40 2E EF F0 52 2E EF F0 64 2E EF F0 76 2E EF F0 86 2E EF F0 98 2E EF F0 A8 2E EF F0 B9 2E EF F0 CA 2E EF F0 DB 2E EF F0 0B 2F EF F0 1C 2F EF F0 EC 2E EF F0 FA 2E EF F0 2D 2F 00 E8 36 2F 00 E8 3F 2F 00 E8 48 2F 00 E8 51 2F 00 00 55 2F 00 00 59 2F 00 00 5D 2F 00 00 61 2F 00 00 65 2F 00 00 69 2F 00 00 6D 2F 00 00 71 2F 00 00 75 2F 00 00 79 2F F0 F8 84 2F F0 F8 8F 2F F0 F0 A3 2F F0 F0 B8 2F F8 F8 C1 2F F8 F8 CA 2F F8 F8 D1 2F F8 F8 D8 2F F0 F8 E3 2F F0 F8 EE 2F F0 F0 03 30 F0 F0 19 30 F8 F8 22 30 F8 F8 2B 30 F8 F8 32 30 F8 F8 39 30 F8 F8 40 30 F8 F8 47 30 F8 F8 4E 30 F8 F8 55 30 F8 F8 5C 30 F8 F8 67 30 F8 F8 6E 30 F8 F8 75 30 F8 F8 7C 30 F8 F8 83 30 F8 F8 8C 30 F8 F8 95 30 F8 F8 9E 30 F8 F8 A7 30 F8 F8 B0 30 F8 F8 B9 30 F8 F8 C0 30 F8 F8 46 31 F0 F0 5D 31 F8 F8 A9 31 FE FE FE FE FE FE FE FE 84 84 84 FE 84 FF A9 31 FE FE FE FE FE 84 FE FE FE 84 FE FE FE 84 84 FF A9 31 FE FE FE FE FE FE 84 FE 84 84 84 FE FF A9 31 FE FE FE FE 84 84 FE FE FE 84 FE FE FE 84 FF A9 31 FE FE FE FE FE FE FE FE 81 81 81 FE FE FE 81 FF A9 31 FE FE FE FE FE 81 81 FE FE 81 FE FE FE 81 FF A9 31 FE FE FE FE 81 FE FE FE 81 81 81 FF A9 31 FE FE FE FE FE 81 FE FE FE 81 FE FE 81 81 FF A9 31 FE FE FE FE FE FE FE FE 8A 8B 8B 8F FF A9 31 FE 80 FE FE FE 88 FE FE FE 88 FE FE FE 89 FF A9 31 FE FE FE FE FE FE FE FE 8A 8B 8B 8F FF A9 31 FE 80 FE FE FE 88 FE FE FE 88 FE FE FE 89 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE 82 82 FE FE FE 82 82 FF A9 31 FE FE FE FE FE 82 FE FE 82 82 FE FE 82 FF A9 31 FE FE FE FE FE FE FE FE 82 82 FE FE FE 82 82 FF A9 31 FE FE FE FE FE 82 FE FE 82 82 FE FE 82 FF A9 31 FE FE FE FE FE FE FE FE FE 86 86 FE 86 86 FF A9 31 FE FE FE FE 86 FE FE FE 86 86 FE FE FE 86 FF A9 31 FE FE FE FE FE FE FE FE FE 86 86 FE 86 86 FF A9 31 FE FE FE FE 86 FE FE FE 86 86 FE FE FE 86 FF A9 31 FE FE FE FE FE 85 FE FE 85 85 85 FF A9 31 FE FE FE FE FE 85 FE FE 85 85 FE FE FE 85 FF A9 31 FE FE FE FE FE FE FE FE 85 85 85 FE FE 85 FF A9 31 FE FE FE FE FE 85 FE FE FE 85 85 FE FE 85 FF C9 31 0A 25 1D 22 19 0E FF C9 31 0B 25 1D 22 19 0E FF C9 31 0C 25 1D 22 19 0E FF C9 31 2F 18 0F 0F 2F 2F FF C9 31 00 FF C9 31 01 FF C9 31 02 FF C9 31 03 FF C9 31 04 FF C9 31 05 FF C9 31 06 FF C9 31 07 FF C9 31 08 FF C9 31 09 FF D9 31 2F 01 2F 11 20 21 30 31 FF D9 31 2F 03 12 13 22 23 32 33 FF A9 31 2F 05 FD 05 2F 2F 15 04 17 24 25 26 27 34 35 36 2F FF A9 31 08 37 FD 37 FD 08 18 19 14 1B 28 29 2A 2B 60 70 36 2F FF D9 31 B9 FD B9 BA FD BA FF D9 31 82 FD 82 83 FD 83 FF D9 31 09 0A 3A 3B FF D9 31 0B 40 7C 6F FF D9 31 2F 0F 2F 1F 5F 2C 2F 3F FF D9 31 6C 3C 4B 4C 5B 5C 6B 2F FF A9 31 2F 4D FD 4D 2F 2F 5D 5E 4E 5F 6D 6E 2F 2F 7D FD 7D 2F FF A9 31 08 77 FD 77 FD 08 18 78 43 53 7A 7B 50 2F 2F 02 FD 7D 2F FF D9 31 B9 FD B9 BA FD BA FF D9 31 82 FD 82 83 FD 83 FF D9 31 09 0A 3A 3B FF D9 31 0B 40 7C 6F FF D9 31 DC DD E0 E1 FF D9 31 DE DF E0 E1 FF D9 31 DE E2 E0 E4 FF D9 31 DC EE E0 E3 FF D9 31 E5 E6 E7 E8 FF D9 31 FD E6 FD E5 FD E8 FD E7 FF D9 31 E9 EA EB EC FF D9 31 ED EA EB EC FF D9 31 F2 F4 F3 BF FF D9 31 F4 F2 BF F3 FF D9 31 C2 FD C2 C3 FD C3 FF D9 31 C4 FD C4 C5 FD C5 FF D9 31 DC FD DC EF FD EF FF D9 31 F0 FD F0 F1 FD F1 FF D9 31 DC FD F0 F1 FD EF FF D9 31 F0 FD DC EF FD F1 FF D9 31 BD BE BB BC FF D9 31 B9 BA DA DB FF CB 30 E0 F0 F5 31 C0 C1 C5 C6 CC CD 75 76 A4 A5 A6 A7 54 55 56 57 44 45 46 47 A0 A1 A2 A3 9C 9D 9E 9F FF 16 31 F8 E8 1C 31 F0 E8 25 31 00 00 2B 31 00 00 31 31 00 00 3A 31 00 00 9D 31 00 00 A3 31 00 00 64 31 D8 F8 7C 31 E8 F8 8E 31 F0 F8 2D 32 63 64 65 FF 2D 32 63 64 65 66 67 68 FF 2D 32 41 41 41 FF 2D 32 42 42 42 FF 2D 32 52 52 52 62 62 62 FF 2D 32 51 51 51 61 61 61 71 71 71 FF A9 31 2F 2F 2F 2F 2F 2F 2F 2F 63 64 FD 64 FD 63 66 67 FD 67 FD 66 FF D9 31 2F 2F 63 64 FF D9 31 00 FD 00 10 FD 10 4F FD 4F 80 FD 80 80 FD 80 81 FD 81 97 FD 97 FF D9 31 98 FD 98 99 FD 99 80 FD 80 9A FD 9A 9B FD 9B FF D9 31 A8 FD A8 A9 FD A9 AA FD AA AB FD AB FF D9 31 41 2F 2F FF D9 31 52 2F 62 FF 00 00 00 08 00 10 00 18 08 00 08 08 08 10 08 18 10 00 10 08 10 10 10 18 18 00 18 08 18 10 18 18 00 00 00 08 00 10 00 18 00 20 00 28 00 30 00 38 00 00 00 08 08 00 08 08 10 00 10 08 18 00 18 08 20 00 20 08 28 00 28 08 30 00 30 08 00 08 00 10 08 08 08 10 10 00 10 08 10 10 10 18 18 00 18 08 18 10 18 18 20 00 20 08 20 10 20 18 28 00 28 08 28 10 28 18 30 00 30 08 30 10 30 18 38 00 38 08 38 10 38 18 00 00 00 08 00 10 08 00 08 08 08 10 10 00 10 08 10 10 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7C 7C 78 79 78 7B FF FF FF FF FF FF FF FF FF FF 00 00 00 FF 00 00 FF FF FF FF FF FF FF FF FF FF 3F 3F 1F 9F 1F DF 78 7B 78 79 7C 7C 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 00 FF 00 00 FF FF FF FF FF FF FF FF FF FF 1F DF 1F 9F 3F 3F FF FF FF FF FF FF FF FF FF FF 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F FF FF FF FF FF FF FF F8 F8 F0 F2 E1 F5 E3 F2 E6 FF FF FF FF FF FF FF 00 00 00 00 FF FF FF 00 00 FF FF FF FF FF FF FF 1F 1F 0F 4F 87 AF C7 4F 67 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 F2 E6 F5 E3 F2 E1 F8 F0 FF F8 FF FF FF FF FF FF 00 00 FF FF 00 FF 00 00 FF 00 FF FF FF FF FF FF 4F 67 AF C7 4F 87 1F 0F FF 1F FF FF FF FF FF FF 78 7B 78 79 7C 7C 7F 7F 7F 7F 7C 7C 78 79 78 7B 1F DF 1F 9F 3F 3F FF FF FF FF 3F 3F 1F 9F 1F DF 00 00 00 FF 00 00 FF FF FF FF 00 00 00 FF 00 00 00 00 00 7F 00 00 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 78 7A 78 7A 78 7A 78 7A 78 7A 00 02 00 7A 00 7A 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 00 40 00 5F 00 5F 00 00 00 FF 00 00 00 FF 00 FF 00 00 00 FF 00 00 00 00 00 00 3F 3F 3F 3F 30 30 30 30 33 32 33 30 00 00 00 00 FF FF FF FF 00 00 00 00 FF 02 FF 20 00 00 00 00 FC FC FC FC 0C 0C 0C 0C CC 0C CC 0C 33 30 33 30 33 30 33 30 33 30 33 30 33 32 33 30 CC 0C CC 4C CC 0C CC 0C CC 0C CC 8C CC 0C CC 0C 33 30 33 30 30 30 30 30 3F 3F 3F 3F 00 00 00 00 FF 04 FF 40 00 00 00 00 FF FF FF FF 00 00 00 00 CC 0C CC 4C 0C 0C 0C 0C FC FC FC FC 00 00 00 00 00 00 FF FF FF 00 FF 02 FF 20 FF 00 FF 04 FF 00 FF 00 FF 02 FF 40 FF 00 FF 08 FF 01 FF 43 FF 07 FF 04 FF 40 FF 02 FF 00 FF 00 FF FF FF FF 00 00 FF 00 FF 40 FF 02 FF 00 FF 10 FF 80 FF C2 FF E0 FE 06 FE 46 FE 06 FE 06 FE 16 FE 86 FE 06 FE 06 7F 64 7F 60 7F 62 7F 60 7F 60 7F 68 7F 62 7F 60 FF 02 FF 40 FF 00 FF 00 FF 08 FF 80 FF 1F F0 10 FF 02 FF 20 FF 00 FF 00 FF 04 FF 00 FF FF 00 00 FF 07 FF 13 FF 01 FF 00 FF 40 FF 00 FF FF 08 08 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 00 00 FF E0 FF C8 FF 80 FF 00 FF 02 FF 00 FF FF 08 08 FF 00 FF 02 FF 40 FF 00 FF 02 FF 00 FF F8 0F 08 F0 10 F0 10 F0 10 F0 50 F0 10 F0 10 F0 10 F0 10 0F 08 0F 0A 0F 08 0F 08 0F 08 0F 08 0F 09 0F 08 00 00 00 7F 00 00 7F 7F 7F 7F 7C 7C 78 79 78 7B 00 00 00 FF 00 00 FF FF FF FF 3F 3F 1F 9F 1F DF 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 00 7F 00 00 00 00 00 00 00 00 AA AA 00 00 00 00 00 00 00 00 00 00 00 00 0F 0F 1F 1F 38 38 33 30 36 30 34 30 00 00 00 00 FF FF FF FF 00 00 FF 00 00 00 00 00 00 00 00 00 F0 F0 F8 F8 1C 1C CC 0C 6C 0C 2C 0C 34 30 34 30 34 30 34 30 34 30 34 30 34 30 34 30 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 34 30 36 30 33 30 38 38 1F 1F 0F 0F 00 00 00 00 00 7B 00 79 00 7C 00 7F 00 7F 00 00 00 7F 00 00 00 DF 00 9F 00 3F 00 FF 00 FF 00 00 00 FF 00 00 00 00 00 00 FF 00 00 00 FF FF FF FF 00 00 00 00 2C 0C 6C 0C CC 0C 1C 1C F8 F8 F0 F0 00 00 00 00 08 08 FF FF FF 02 FF 00 FF 20 FF 00 FF 02 FF 00 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 08 08 FF 07 FF 13 FF 01 FF 00 FF 40 FF 00 FF FF 00 00 FF E0 FF C8 FF 80 FF 00 FF 02 FF 00 FF FF 00 00 08 08 08 08 08 08 08 08 08 08 08 08 08 08 08 08 FF 00 FF 02 FF 00 FF 20 FF 02 FF 00 FF FF 08 08 F0 10 FF 1F F0 1F F0 1F F0 1F F0 1F FF 5F F0 10 00 00 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 00 00 08 08 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 08 08 0F 08 FF F8 0F F8 0F F8 0F F8 0F F8 FF FA 0F 08 FF 07 FF 43 FF 01 FF 00 FF 00 FF 80 FF 1F F0 10 FF E0 FF C2 FF 80 FF 00 FF 22 FF 00 FF F8 0F 08 00 00 00 00 00 00 3C 00 3C 00 00 00 00 00 00 00 00 00 3C 00 4E 00 4E 00 7E 00 4E 00 4E 00 00 00 00 00 7C 00 66 00 7C 00 66 00 66 00 7C 00 00 00 00 00 3C 00 66 00 60 00 60 00 66 00 3C 00 00 00 DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF 00 00 7E 00 18 00 18 00 18 00 18 00 18 00 00 00 00 00 66 00 66 00 3C 00 18 00 18 00 18 00 00 00 FF FF F7 89 DD A3 FF 81 B7 C9 FD 83 D7 A9 FF 81 FF FF FF 81 FF BD E7 A5 E7 A5 FF BD FF 81 FF FF FF FF FF 81 FF 81 FF 99 FF 99 FF 81 FF 81 FF FF FF FF 81 81 BD BD BD BD BD BD BD BD 81 81 FF FF FF FF 81 FF 81 FF 81 FF 81 FF 81 FF 81 FF FF FF FF FF FF 81 C3 81 DF 85 DF 85 FF BD FF 81 FF FF FF FF 81 FF BD FF A5 E7 A5 E7 BD FF 81 FF FF FF FF FF 81 81 BD 83 BD 83 BD 83 BD 83 81 FF FF FF ED 93 BF C1 F5 8B DF A1 FD 83 AF D1 FB 85 DF A1 FD 83 EF 91 BB C5 EF 91 BD C3 F7 89 DF A1 FF FF FF FF DB A4 FF 80 B5 CA FF 80 DD A2 F7 88 FF FF FF FF 57 A8 FD 02 DF 20 7B 84 EE 11 BB 44 FF FF FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 77 89 DF 21 FB 05 AF 51 FD 03 D7 29 FF FF 00 00 3C 00 66 00 66 00 66 00 66 00 3C 00 00 00 00 00 18 00 38 00 18 00 18 00 18 00 3C 00 00 00 00 00 3C 00 4E 00 0E 00 3C 00 70 00 7E 00 00 00 00 00 7C 00 0E 00 3C 00 0E 00 0E 00 7C 00 00 00 00 00 3C 00 6C 00 4C 00 4E 00 7E 00 0C 00 00 00 00 00 7C 00 60 00 7C 00 0E 00 4E 00 3C 00 00 00 00 00 3C 00 60 00 7C 00 66 00 66 00 3C 00 00 00 00 00 7E 00 06 00 0C 00 18 00 38 00 38 00 00 00 00 00 3C 00 4E 00 3C 00 4E 00 4E 00 3C 00 00 00 00 00 3C 00 4E 00 4E 00 3E 00 0E 00 3C 00 00 00 00 00 7C 00 66 00 66 00 7C 00 60 00 60 00 00 00 00 00 7E 00 60 00 7C 00 60 00 60 00 7E 00 00 00 00 00 7E 00 60 00 60 00 7C 00 60 00 60 00 00 00 00 00 3C 00 66 00 66 00 66 00 66 00 3C 00 00 00 00 00 3C 00 66 00 60 00 6E 00 66 00 3E 00 00 00 00 00 46 00 6E 00 7E 00 56 00 46 00 46 00 00 00 00 00 46 00 46 00 46 00 46 00 4E 00 3C 00 00 00 00 00 3C 00 60 00 3C 00 0E 00 4E 00 3C 00 00 00 00 00 3C 00 18 00 18 00 18 00 18 00 3C 00 00 00 00 00 60 00 60 00 60 00 60 00 60 00 7E 00 00 00 00 00 46 00 46 00 46 00 46 00 2C 00 18 00 00 00 00 00 7C 00 66 00 66 00 7C 00 68 00 66 00 00 00 00 00 46 00 66 00 76 00 5E 00 4E 00 46 00 00 00 00 00 7C 00 4E 00 4E 00 4E 00 4E 00 7C 00 00 00 FF FF FF 00 FF 00 FF 00 FF 10 FF 80 FF 02 FF 00 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 80 80 80 80 FF FF FF 00 FF 02 FF 20 FF 00 FF 00 FF 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 3F 2E 7F 63 BF F8 37 FF 01 01 01 01 01 01 01 01 01 01 01 01 01 01 83 83 01 01 01 01 01 01 01 01 01 01 01 01 01 01 FF FF FF FF 01 01 01 01 01 01 01 01 01 01 01 01 83 83 FF FF D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 FF FF D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 00 38 00 38 00 38 00 38 00 38 00 38 00 38 00 38 7C 00 7C 00 7C 00 7C 00 7C 00 7C 00 7F 00 FF 00 00 00 00 00 08 00 08 00 08 00 08 00 1C 00 1C 00 00 00 00 0E 01 1D 1E 06 2A 2A 27 27 10 13 0C 0D 00 00 C0 C0 20 20 10 D0 D0 10 F0 30 C8 E8 08 E8 04 07 03 03 0C 0C 10 10 35 20 2A 20 3F 3F 0C 0C 28 E8 D8 C0 40 40 20 20 50 10 B0 10 F0 F0 C0 C0 00 E0 01 71 32 42 34 35 55 54 4F 4E 21 27 18 1B 00 00 80 80 40 40 20 A0 A0 20 E0 60 90 F0 08 C8 B8 B8 84 84 84 84 FC FC 92 92 92 92 6C 6C EE EE 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 B4 B4 64 64 3C 3C 2E 2E 27 27 10 10 6C 7C CF B3 03 03 03 03 03 02 07 06 09 09 16 17 12 11 0E 0F 08 09 08 08 0F 0F 08 08 09 09 0A 0A 06 06 0E 0E 03 03 03 03 03 02 1F 1E 21 21 4A 55 4A 75 0A 35 0A 15 08 08 0F 0F 08 08 09 09 0A 0A 06 06 0E 0E 00 00 66 00 6C 00 78 00 78 00 6C 00 66 00 00 00 00 00 46 00 2C 00 18 00 38 00 64 00 42 00 00 00 FD FD FD FD FD FD FD FD FD FD FD FD FD FD FD FD F8 00 E0 00 C0 00 80 00 80 00 00 00 00 00 00 00 7F 00 1F 00 0F 00 07 00 07 00 03 00 03 00 03 00 00 00 80 00 80 00 C0 00 E0 00 F8 00 FF 00 FF 00 03 00 07 00 07 00 0F 00 1F 00 7F 00 FF 00 FF 00 FF FF FF FF 00 FF FF FF 00 FF FF 00 00 FF FF 00 FF 00 FF 00 FF 01 FE 02 FE 02 FC 04 FC 04 FC 04 FF 02 FF 01 FF 01 01 01 FF 01 01 01 FF 01 01 01 02 02 02 02 03 03 04 05 08 09 11 12 21 26 43 4C 00 00 01 01 02 02 04 04 08 09 10 13 20 27 20 2F 87 98 06 39 0E 71 1E E1 3C C3 3C C3 78 87 78 87 40 4F 40 4F 80 9F 80 9F 80 9F 80 9F 80 9F 80 9F F8 07 F0 0F F0 0F F0 0F F0 0F F0 0F F0 0F F8 07 40 5F 40 4F 20 2F 20 27 10 11 0F 0F 04 04 07 07 78 87 7C 83 3C C3 1E E1 0F F0 FF FF FF 00 FF FF FF 00 FF 00 FF 00 00 00 FF 00 00 00 FF 00 00 00 02 00 02 00 02 00 02 00 02 00 02 00 02 00 02 00 10 00 38 00 7C 00 FE 00 FE 00 FE 00 7C 00 00 00 02 03 01 01 02 02 04 04 0D 08 0A 08 0F 0F 03 03 28 E8 F0 D0 30 30 08 08 54 04 AC 04 FC FC 30 30 00 00 03 03 03 03 03 02 07 06 09 09 08 08 0B 0B 00 00 C0 C0 C4 C4 E8 68 90 F0 A8 F8 48 78 F8 B8 00 00 07 07 07 07 07 04 07 04 0B 0B 10 10 17 17 00 00 80 80 80 80 E0 E0 90 F0 A8 F8 48 78 B8 B8 08 08 0F 0F 08 08 0F 0F 09 09 09 09 06 06 0E 0E E4 E4 22 22 20 20 E0 E0 20 20 20 20 C0 C0 E0 E0 18 18 98 98 98 98 F8 F8 9C 98 3C 3C 3C 3C 7E 7E 7F 00 FE FE 7E 7E FE DA 7E 5A 7E 7E FC FC F8 F8 FE 0E FE FE 7E 7E FE DA 7E 5A 7E 7E FC FC F8 F8 80 80 83 83 83 83 C3 02 EF 2E 97 97 47 44 24 24 00 00 C0 C0 C0 C0 C0 40 E0 60 F8 F8 E4 24 34 34 17 14 17 14 17 14 1C 1F 17 17 0F 0F 1E 1E 00 00 F4 24 F8 28 E8 28 38 F8 E8 E8 90 90 70 70 78 78 03 03 03 03 03 02 0F 0E 11 11 37 37 71 52 7D 4E C0 C0 C0 C0 C0 40 C0 40 A0 A0 10 10 FF FF CF 33 7F 40 3F 3F 08 08 0F 0F 09 09 09 09 06 06 0E 0E FC FC 20 20 20 20 E0 E0 20 20 20 20 C0 C0 E0 E0 03 03 03 03 03 02 07 06 09 09 33 33 77 54 73 4C 18 18 D8 D8 D8 D8 F8 78 DC 58 BC BC 3C 3C 7E 7E 09 0E 07 07 08 0F 08 0F 09 0F 0A 0E 06 06 0E 0E 00 00 03 03 03 03 03 02 FF 7E C9 3F 78 7F 09 0F 04 04 07 07 B8 BF C0 FF FF FF 00 00 00 00 00 00 00 00 78 78 78 78 7B 48 60 5F B6 B0 84 84 B8 B8 84 84 84 84 84 84 FA FA 92 92 9E 9E 67 67 E0 E0 00 00 00 00 78 78 78 78 78 48 40 7E B4 B0 84 84 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 30 31 31 31 31 31 32 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 44 1C 0C 18 1B 0E 45 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 67 46 46 46 46 46 68 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2F 2F 2F 2F 2F 00 2F 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 43 34 34 34 34 34 34 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 30 31 31 31 31 31 32 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 0E 1F 0E 15 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 2F 2F 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 40 42 42 42 42 42 41 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 12 17 0E 1C 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 2F 2F 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 33 34 34 34 34 34 35 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 38 39 39 39 39 3A 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3B 2F 2F 2F 2F 3C 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 3B 2F 2F 2F 2F 3C 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3D 3E 3E 3E 3E 3F 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 30 31 31 31 31 31 32 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 15 0E 1F 0E 15 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 36 2F 2F 2F 2F 2F 37 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 40 42 42 42 42 42 41 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 11 12 10 11 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 36 2F 2F 2F 2F 2F 37 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 33 34 34 34 34 34 35 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 8E 8E 8E 8E 8E 8E 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 30 31 31 31 31 31 32 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 12 17 0E 1C 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 02 05 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 33 34 34 34 34 34 35 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 38 39 39 39 39 3A 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3B 2F 2F 2F 2F 3C 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 3B 2F 2F 2F 2F 3C 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3D 3E 3E 3E 3E 3F 00 3C 66 66 66 66 3C 00 00 18 38 18 18 18 3C 00 00 3C 4E 0E 3C 70 7E 00 00 7C 0E 3C 0E 0E 7C 00 00 3C 6C 4C 4E 7E 0C 00 00 7C 60 7C 0E 4E 3C 00 00 3C 60 7C 66 66 3C 00 00 7E 06 0C 18 38 38 00 00 3C 4E 3C 4E 4E 3C 00 00 3C 4E 4E 3E 0E 3C 00 00 3C 4E 4E 7E 4E 4E 00 00 7C 66 7C 66 66 7C 00 00 3C 66 60 60 66 3C 00 00 7C 4E 4E 4E 4E 7C 00 00 7E 60 7C 60 60 7E 00 00 7E 60 60 7C 60 60 00 00 3C 66 60 6E 66 3E 00 00 46 46 7E 46 46 46 00 00 3C 18 18 18 18 3C 00 00 1E 0C 0C 6C 6C 38 00 00 66 6C 78 78 6C 66 00 00 60 60 60 60 60 7E 00 00 46 6E 7E 56 46 46 00 00 46 66 76 5E 4E 46 00 00 3C 66 66 66 66 3C 00 00 7C 66 66 7C 60 60 00 00 3C 62 62 6A 64 3A 00 00 7C 66 66 7C 68 66 00 00 3C 60 3C 0E 4E 3C 00 00 7E 18 18 18 18 18 00 00 46 46 46 46 4E 3C 00 00 46 46 46 46 2C 18 00 00 46 46 56 7E 6E 46 00 00 46 2C 18 38 64 42 00 00 66 66 3C 18 18 18 00 00 7E 0E 1C 38 70 7E 00 00 00 00 00 00 60 60 00 00 00 00 3C 3C 00 00 00 00 00 22 14 08 14 22 00 00 00 36 36 5F 49 5F 41 7F 41 3E 22 1C 14 08 08 FF FF FF 81 C1 BF C1 BF C1 BF C1 BF 81 FF FF FF AA AA 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F FF 00 FF 40 FF 02 FF 00 FF 10 FF 80 FF 02 FF 00 F0 10 FF 1F FF 00 FF 40 FF 00 FF 02 FF 40 FF 00 0F 08 FF F8 FF 00 FF 02 FF 00 FF 40 FF 02 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 18 18 38 38 18 18 18 18 18 18 3C 3C 00 00 00 00 3C 3C 4E 4E 4E 4E 3E 3E 0E 0E 3C 3C 00 00 00 00 3C 3C 4E 4E 3C 3C 4E 4E 4E 4E 3C 3C 00 00 38 38 44 44 BA BA A2 A2 BA BA 44 44 38 38 C6 C6 E6 E6 E6 E6 D6 D6 D6 D6 CE CE CE CE C6 C6 C0 C0 C0 C0 00 00 DB DB DD DD D9 D9 D9 D9 D9 D9 00 00 30 30 78 78 33 33 B6 B6 B7 B7 B6 B6 B3 B3 00 00 00 00 00 00 CD CD 6E 6E EC EC 0C 0C EC EC 01 01 01 01 01 01 8F 8F D9 D9 D9 D9 D9 D9 CF CF 80 80 80 80 80 80 9E 9E B3 B3 B3 B3 B3 B3 9E 9E FF 00 FF 00 FF 00 EF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 E7 00 E7 00 FF 00 FF 00 FF 00 00 FF FF FF 00 FF 00 FF FF 00 00 FF FF 00 FF 00 00 FF FF FF 01 FF 02 FE FE 02 04 FC FC 04 FC 04 00 FF FF FF 80 FF 40 7F FF 40 E0 3F FF 20 BF 60 FF 00 FF 00 FF 01 FE 02 FE 02 FC 04 FC 04 FC 04 FF 00 FF 00 FF 80 7F 40 FF 40 FF 20 FF 20 BF 60 FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 00 FF 02 FF 01 FF 01 FF 01 FF 01 FF 01 FF 01 FF 01 7F C0 FF 80 FF 80 FF 80 FF 80 FF 80 FF 80 FF 80 FE 02 FE 02 FF 03 FC 05 F8 09 F1 12 E1 26 C3 4C 7F C0 7F C0 FF C0 BF 60 9F 70 AF 58 27 DC 33 CE FF 00 FF 01 FE 02 FC 04 F8 09 F0 13 E0 27 E0 2F 87 98 06 39 0E 71 1E E1 3C C3 3C C3 78 87 78 87 35 CB 32 CD 3A C5 79 86 78 87 78 87 7C 83 7C 83 FF 00 FF 80 7F C0 3F E0 9F 70 4F B8 67 9C 37 CC C0 4F C0 4F 80 9F 80 9F 80 9F 80 9F 80 9F 80 9F F8 07 F0 0F F0 0F F0 0F F0 0F F0 0F F0 0F F8 07 7C 83 7E 81 7E 81 3E C1 3F C0 1F E0 1F E0 1F E0 33 CE 1B E6 09 F7 0D F3 0D F3 0D F3 0D F3 09 F7 C0 5F C0 4F E0 2F E0 27 F0 11 BF 4F 0C F4 07 FF 78 87 7C 83 3C C3 1E E1 0F F0 FF FF FF 00 FF FF 0F F0 0F F0 0E F1 0E F1 06 F9 FF FF C5 3F FF FF 1B E6 13 EE 37 CC 27 DC 4F B8 FC F3 FC A3 E0 FF FE 02 FE 02 BF 43 1C E5 B8 49 B1 52 A1 66 43 CC FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 EF 10 C7 38 FF 00 FB 04 FB 04 FB 04 FB 04 F1 0E F1 0E F1 0E 83 7C 01 FE 01 FE 01 FE 83 7C FF 00 83 7C 83 7C F1 0E E0 1F E0 1F E0 1F E0 1F E0 1F 80 7F 80 7F F7 08 EB 14 F7 08 F7 08 E3 1C E3 1C 63 9C 01 FE 00 00 60 60 70 70 78 78 78 78 70 70 60 60 00 00 00 00 30 30 70 70 30 30 30 30 30 30 78 78 00 00 E0 E0 F0 E0 FB E0 FC E0 FC E1 FC E1 FC E1 FC E1 00 00 00 00 FF 00 00 00 00 FF 00 00 00 00 00 00 07 07 0F 07 DF 07 3F 07 3F 87 3F 87 3F 87 3F 87 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 FC E1 FC E1 FC E1 FC E1 FC E0 FF E7 FF EF E0 FF 00 00 00 00 00 00 00 FF 00 00 FF FF FF FF 00 FF 3F 87 3F 87 3F 87 3F 87 3F 07 FF E7 FF F7 07 FF F8 00 E0 00 C0 00 80 00 80 00 00 00 00 00 00 00 7F 00 1F 00 0F 00 07 00 07 00 03 00 03 00 03 00 00 00 80 00 80 00 C0 00 E0 00 F8 00 FF 00 FF 00 03 00 07 00 07 00 0F 00 1F 00 7F 00 FF 00 FF 00 01 01 01 01 81 81 C1 C1 C1 C1 E1 E1 F1 F1 F9 F9 FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE 7E 7E 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 3F 3F 9F 9F 8F 8F CF CF E7 E7 F3 F3 F7 F7 E0 E0 E0 E0 E0 E0 E0 E0 E0 E0 C0 C0 C0 C0 80 80 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 00 00 7C 7C 47 47 41 41 40 40 40 40 40 40 7F 40 00 00 01 01 01 01 81 81 C1 C1 41 41 61 61 E1 61 00 00 FE FE 06 06 06 06 06 06 06 06 06 06 FE 06 00 00 1B 1B 32 32 59 59 4C 4C 8C 8C 86 86 FF 83 00 00 FF FF 01 01 01 01 81 81 41 41 41 41 3F 21 00 00 BE BE 88 88 88 88 88 88 88 88 80 80 80 80 00 00 88 88 D8 D8 A8 A8 88 88 88 88 00 00 00 00 7F 40 7F 40 7F 40 7F 40 7F 40 7F 40 7F 40 47 7F E1 61 E1 61 E1 61 E1 61 E1 61 C1 C1 C1 C1 81 81 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 06 FE FF 83 FF 81 7F 40 7F 40 7F 40 3F 20 3F 20 10 1F 1F 11 9F 91 CF C9 C7 C5 E3 63 F3 33 F9 19 08 F8 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 5F 7F 78 78 60 60 50 70 50 70 48 78 44 7C 7E 7E 01 01 01 01 01 01 01 01 01 01 01 01 01 01 01 01 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE FE FE 08 0F 44 47 64 67 72 73 51 71 59 79 4C 7C 7E 7E 0C FC 06 FE 03 FF 01 FF 01 FF 00 FF 80 FF 7F 7F 00 00 00 00 00 00 80 80 80 80 C0 C0 C0 C0 E0 E0 7E 7E 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 03 03 02 02 02 02 02 02 02 02 02 02 03 02 00 00 FB FB 0A 0A 12 12 22 22 22 22 42 42 C3 42 00 00 FD FD 0D 0D 0C 0C 0C 0C 0C 0C 0C 0C FC 0C 00 00 FC FC 0C 0C 8C 8C 4C 4C 4C 4C 2C 2C 3C 2C 03 02 03 02 03 03 03 03 02 02 00 00 00 00 00 00 83 82 83 82 03 02 03 02 03 02 03 02 03 02 02 03 FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C 0C FC 1C 1C 1C 1C 0C 0C 0C 0C 04 04 00 00 00 00 00 00 02 03 02 03 02 03 02 03 02 03 02 03 02 03 03 03 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC FC FC 03 03 03 03 03 03 03 03 03 03 03 03 03 03 03 03 FC FC FC FC FC FC FC FC FC FC FC FC FC FC FC FC FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 01 01 03 03 07 07 0F 0F 1F 1F 3F 3F 7F 7F 00 00 FF FF 83 83 83 83 83 83 83 83 83 83 FF 83 00 00 7F 7F 20 20 10 10 08 08 04 04 02 02 01 01 00 00 F3 F3 32 32 32 32 32 32 32 32 32 32 F3 32 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 83 FF 00 00 00 00 01 01 03 03 07 07 0F 0B 1F 13 23 3F F3 B2 73 72 33 33 13 13 02 02 00 00 00 00 00 00 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF FF FF 43 7F 23 3F 13 1F 0B 0F 07 07 03 03 01 01 00 00 00 00 00 00 00 00 00 00 00 00 10 10 30 30 70 70 00 00 78 78 9C 9C 1C 1C 78 78 E0 E0 FC FC 00 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 1B 1B 1B 1B 09 09 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 60 60 20 20 00 00 1B 1B 1B 1B 09 09 00 00 00 00 60 60 60 60 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 9B 1D 16 2F 0A 17 0D 2F 33 01 09 08 07 2F 0E 15 18 1B 10 9C 2F 1D 0E 1D 1B 12 1C 2F 15 12 0C 0E 17 1C 0E 0D 2F 1D 18 2F 2F 2F 2F 2F 0B 1E 15 15 0E 1D 25 19 1B 18 18 0F 2F 2F 2F 2F 2F 2F 2F 2F 1C 18 0F 1D 20 0A 1B 0E 2F 0A 17 0D 2F 2F 2F 2F 2F 2F 2F 1C 1E 0B 25 15 12 0C 0E 17 1C 0E 0D 2F 1D 18 2F 2F 2F 2F 2F 2F 2F 2F 17 12 17 1D 0E 17 0D 18 24 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 33 01 09 08 09 2F 0B 1E 15 15 0E 1D 25 19 1B 18 18 0F 2F 2F 2F 2F 2F 2F 2F 1C 18 0F 1D 20 0A 1B 0E 24 2F 2F 2F 2F 2F 2F 2F 2F 33 30 31 32 31 2F 34 35 36 37 38 39 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 0A 15 15 2F 1B 12 10 11 1D 1C 2F 1B 0E 1C 0E 1B 1F 0E 0D 24 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 18 1B 12 10 12 17 0A 15 2F 0C 18 17 0C 0E 19 1D 9C 2F 2F 0D 0E 1C 12 10 17 2F 0A 17 0D 2F 19 1B 18 10 1B 0A 16 2F 0B 22 2F 0A 15 0E 21 0E 22 2F 19 0A 23 11 12 1D 17 18 1F 9D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 5A 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5C 5D 80 81 82 83 90 91 92 81 82 83 90 6C 6D 6E 6F 70 71 72 5E 5D 84 85 86 87 93 94 95 85 86 87 93 73 74 75 76 77 78 2F 5E 5D 2F 88 89 2F 96 97 98 88 89 2F 96 79 7A 7B 7C 7D 7E 2F 5E 5D 2F 8A 8B 2F 8E 8F 6B 8A 8B 2F 8E 7F 66 67 68 69 6A 2F 5E 5F 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 61 8E 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3D 3E 3C 3C 3C 8E 8E 8C 8C 62 63 8C 8C 3A 8C 8C 8C 8C 8C 3A 42 43 3B 8C 8C 8E 8E 3A 8C 64 65 8C 8C 8C 8C 3B 8C 8C 8C 8C 44 45 8C 8C 8C 8E 8E 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 46 47 48 49 3F 40 8E 8E 8C 8C 8C 8C 3A 8C 8C 8C 8C 53 54 8C 4A 4B 4C 4D 42 43 8E 8E 8C 8C 8C 8C 8C 8C 8C 8C 54 55 56 57 4E 4F 50 51 52 45 8E 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 2F 2F 59 19 15 0A 22 0E 1B 2F 2F 2F 99 19 15 0A 22 0E 1B 2F 2F 2F 9A 9A 9A 9A 9A 9A 9A 2F 2F 2F 9A 9A 9A 9A 9A 9A 9A 2F 2F 2F 2F 2F 33 30 31 32 31 2F 34 35 36 37 38 39 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 10 0A 16 0E 2F 1D 22 19 0E 54 2C 2C 2C 2C 4B 4A 2C 55 56 6D 58 58 58 58 58 A9 58 58 58 6E 56 56 5A 2C 4B 4A 2C 5B 78 77 7E 7F 9A 9B 2F AA 79 77 7E 7F 9A 9B 5C 2C 4B 4A 2C 2D 4F 4F 4F 4F 4F 4F 4F AC 4F 4F 4F 4F 4F 4F 2E 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 53 16 1E 1C 12 0C 2F 1D 22 19 0E 54 2C 2C 2C 4B 4A 2C 55 56 6D 58 58 58 58 58 A9 58 58 58 58 6E 56 5A 2C 4B 4A 2C 5B 78 77 7E 7F 9A 9B 2F AA 79 77 7E 7F 9A 9B 5C 2C 4B 4A 2C 71 72 72 72 72 72 72 72 AB 72 72 72 72 72 72 74 2C 4B 4A 2C 5B 7A 77 7E 7F 9A 9B 2F AA 2F 9D 9C 9C 2F 2F 5C 2C 4B 4A 2C 2D 4F 4F 4F 4F 4F 4F 4F AC 4F 4F 4F 4F 4F 4F 2E 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2F 0A 25 1D 22 19 0E 2F 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 50 51 51 51 51 51 52 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 53 15 0E 1F 0E 15 54 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 55 56 57 58 6C 58 6C 58 59 56 5A 2C 2C 2C 2C 4B 4A 2C 2C 2C 5B 90 6F 91 6F 92 6F 93 6F 94 5C 2C 2C 2C 2C 4B 4A 2C 2C 2C 71 72 73 72 73 72 73 72 73 72 74 2C 2C 2C 2C 4B 4A 2C 2C 2C 5B 95 6F 96 6F 97 6F 98 6F 99 5C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2D 4F 6B 4F 6B 4F 6B 4F 6B 4F 2E 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 1D 18 19 25 1C 0C 18 1B 0E 54 2C 2C 2C 2C 4B 4A 55 56 70 6D 58 58 58 58 58 58 58 58 58 6E 56 56 56 5A 4B 4A 5B 01 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 02 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 03 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 2D 4F 6B 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 2E 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2F 0B 25 1D 22 19 0E 2F 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 50 51 51 51 51 51 52 2C 2C 50 51 51 51 51 52 2C 4B 4A 2C 2C 53 15 0E 1F 0E 15 54 2C 2C 53 11 12 10 11 54 2C 4B 4A 55 56 57 58 6C 58 6C 58 59 56 5A 75 58 6C 58 6C 6E 5A 4B 4A 5B 90 6F 91 6F 92 6F 93 6F 94 5C 5B 90 6F 91 6F 92 5C 4B 4A 71 72 73 72 73 72 73 72 73 72 74 71 72 73 72 73 72 74 4B 4A 5B 95 6F 96 6F 97 6F 98 6F 99 5C 5B 93 6F 94 6F 95 5C 4B 4A 2D 4F 6B 4F 6B 4F 6B 4F 6B 4F 2E 2D 4F 6B 4F 6B 4F 2E 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 1D 18 19 25 1C 0C 18 1B 0E 54 2C 2C 2C 2C 4B 4A 55 56 70 6D 58 58 58 58 58 58 58 58 58 6E 56 56 56 5A 4B 4A 5B 01 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 02 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 03 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 2D 4F 6B 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 2E 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E CD CD CD CD CD CD CD CD CD CD 8C C9 CA 8C 8C 8C 8C 8C 8C 8C 8C CB CC 8C 8C 8C 8C 8C 8C CE D7 D7 D7 D7 D7 D7 D7 D7 D7 CF 2F 2F 2F 2F 2F 2F 2F 2F 2F D0 2F 2F 2F 2F 2F 2F 2F 2F D1 D2 2F 2F 2F 2F 2F 2F 2F 2F D3 D4 7C 7C 7C 7C 7C 7C 2F 2F D5 D6 7D 7D 7D 7D 2F 2F 2F 2F D8 2F 7B 7B 7B 7B 2F 2F 2F 2F D8 2F 7C 7C 7C 7C 2F 2F 2F 2F D8 2F 2F 2F 2F 2F 2F 2F 2F 2F D8 2F 2F 2F 2F 2F 2F 2F 7C 7C 7C 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 7D 7D 2F 2F 2F 2F 2F 2F 2F 7D 2F 2F 2F D9 2F 2F 2F 2F 2F 7B B7 B8 D9 B7 2F 7C 7C 7C 7C 7C 7D 7D 7D 7D 7D 7D 7D 7D 7D 7D FF 4A 4A 4A 4A 4A 4A 59 69 69 69 69 69 69 49 4A 4A 4A 4A 4A 4A 5A 5A 5A 5A 5A 5A 85 85 85 85 85 85 85 85 5A 5A 38 39 38 5A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 16 0A 1B 12 18 2F 1F 1C 24 15 1E 12 10 12 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 50 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 53 11 12 10 11 54 2C 2C 2C 4B 4A 2C 2C 55 56 56 5A 2C 2C 2C 75 58 6C 58 6C 6E 5A 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 5B 90 6F 91 6F 92 5C 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 71 72 73 72 73 72 74 2C 2C 4B 4A 2C 2C 2D 4F 4F 2E 2C 2C 2C 5B 93 6F 94 6F 95 5C 2C 2C 4B 4A 2C 2C 16 0A 1B 12 18 2C 2C 2D 4F 6B 4F 6B 4F 2E 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 50 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 53 11 12 10 11 54 2C 2C 2C 4B 4A 2C 2C 55 56 56 5A 2C 2C 2C 75 58 6C 58 6C 6E 5A 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 5B 90 6F 91 6F 92 5C 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 71 72 73 72 73 72 74 2C 2C 4B 4A 2C 2C 2D 4F 4F 2E 2C 2C 2C 5B 93 6F 94 6F 95 5C 2C 2C 4B 4A 2C 2C 15 1E 12 10 12 2C 2C 2D 4F 6B 4F 6B 4F 2E 2C 2C 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 8E B2 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B3 30 31 31 31 31 31 32 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 40 42 42 42 42 42 41 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 11 12 10 11 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 33 34 34 34 34 34 35 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 8E 8E 8E 8E 8E 8E 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 30 31 31 31 31 31 32 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 15 12 17 0E 1C 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 33 34 34 34 34 34 35 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 38 39 39 39 39 3A 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B1 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B4 2B 3D 3E 3E 3E 3E 3F 07 07 07 07 07 07 84 87 87 8C 87 87 8C 87 87 8C 87 87 86 07 07 1E 1E 1E 1E 1E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 B4 B5 BB 2E BC 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BF BF BF BF BF 89 8A 8A 8E 8A 8A 8E 8A 8A 8E 8A 8A 8B 07 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 07 07 07 07 07 07 84 87 87 8C 87 87 8C 87 87 8C 87 87 86 07 07 1E 1E 1E 1E 1E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BD B2 2E BE 2E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BF BF BF BF BF 89 8A 8A 8E 8A 8A 8E 8A 8A 8E 8A 8A 8B 07 01 01 01 01 01 01 02 02 03 03 01 01 01 01 02 02 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F F2 FE 12 1E 12 1E 12 1E 7E 7E FF 83 FF 81 FF FF 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F 04 FC 02 FE 02 FE 07 FD 07 FD 1F FF FF FF FF FA 00 00 00 00 00 00 00 00 00 00 00 00 07 07 18 1F FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 03 03 05 04 03 03 00 00 18 18 2C 24 1A 1A 08 08 40 40 07 07 18 1F A0 BF 3B 3F 7C 44 7C 44 10 10 02 02 E0 E0 18 F8 05 FD 8C FC 78 48 6C 74 00 00 07 07 18 1F 20 3F 30 3F 1F 1D 3E 22 3E 22 80 80 80 80 80 80 80 80 00 00 C0 C0 E0 E0 E0 E0 00 00 7C 7C 66 66 66 66 7C 7C 60 60 60 60 00 00 00 00 3C 3C 60 60 3C 3C 0E 0E 4E 4E 3C 3C 00 00 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 04 04 07 04 04 04 04 0D 04 0D 04 04 04 04 03 02 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 00 00 00 00 00 00 03 03 04 04 08 08 09 09 04 04 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 18 F8 04 FC 02 FE 02 FE 07 FD 07 FD FF FF FF FA 20 3F 40 7F 40 7F E0 BF E0 BF F8 FF 7F 7F 7F 5F FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF 00 00 00 00 00 00 00 00 00 00 00 00 80 80 C0 40 00 00 00 00 00 00 04 04 08 08 1C 14 14 14 08 08 18 1F 20 3F 40 7F 40 7F E0 BF E0 BF 7F 7F 7F 5F DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 00 00 00 00 00 00 20 20 10 10 38 28 28 28 90 90 00 00 46 46 46 46 7E 7E 46 46 46 46 46 46 00 00 00 00 7E 7E 18 18 18 18 18 18 18 18 18 18 00 00 FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 EE B4 B4 64 64 3C 3C 2E 2E 27 27 70 70 FC 9C F7 9F 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 3F 2E 7F 63 FF 98 F7 1F F7 1C F7 D7 34 3F AC BF 03 03 01 01 01 01 00 00 00 00 06 06 05 05 07 07 FF AE FF 23 FF 18 F7 9F F7 9C 77 57 34 3F 6C 7F 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 3F 2F 7F 7C F7 9C F3 1F F0 1F F0 DF 30 3F A0 BF FF F4 FF 3E EF 38 CF F8 0F FB 0E FA 0C FC 04 FC E0 20 E0 20 E0 20 C0 40 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 01 01 02 02 02 02 3F 2F 3F 3C 77 5C F3 9F F0 1F F0 1F F0 FF 20 3F FF F4 FF 3E EF 38 CF F9 0E FA 0E FA 0C FC 04 FC C0 40 C0 40 C0 40 80 80 00 00 00 00 00 00 00 00 F7 1C F7 34 F7 BF 6C 7F 10 1F 50 5F 32 3F F1 FF 00 00 46 46 46 46 56 56 7E 7E 6E 6E 46 46 00 00 00 00 3C 3C 18 18 18 18 18 18 18 18 3C 3C 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 02 02 01 01 00 00 00 00 00 00 00 00 00 00 00 00 40 7F C0 FF 20 3F 22 3F 11 1F 72 7E BF BF FF FF 07 07 06 07 06 07 06 07 07 07 00 00 00 00 00 00 C0 FF 00 FF 00 FF 02 FF FF FF 00 00 00 00 00 00 02 02 01 01 00 00 00 00 00 00 00 00 00 00 00 00 40 7F C0 FF 20 3F 20 3F 11 1F 72 7E FF FF FF FF 02 FE 02 FE 04 FC 04 FC 88 F8 4E 7E FF FF FF FF 00 00 00 00 80 80 40 40 00 00 00 00 00 00 07 07 00 00 00 00 FF 00 FD 02 CD 32 09 F6 08 F7 00 FF 00 00 00 00 FF 00 FF 00 FF 00 FC 03 CC 33 08 F7 7C 44 3F 3F 10 1F 10 1F 12 1F 19 1F 3F 3F 3E 3E CE F2 8E DA 09 F9 09 F9 4E FE 98 F8 FC FC 7C 7C 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 00 00 46 46 66 66 76 76 5E 5E 4E 4E 46 46 00 00 00 00 18 18 18 18 18 18 18 18 00 00 18 18 00 00 12 1E 12 1E 12 1E 12 1E 7E 7E BF 83 FF 81 FF FF 00 00 E0 E0 18 F8 04 FC 0C FC F8 C8 2C 34 2E 32 00 00 46 46 46 46 46 46 46 46 2C 2C 18 18 00 00 00 00 36 36 5F 49 5F 41 7F 41 3E 22 1C 14 08 08 FE 02 FD 05 FD 05 FF 1F FF FC FF FE EF 38 EF 39 00 04 00 04 00 04 01 05 01 05 03 07 06 06 0C 0C CA C0 C8 C0 CA C0 88 80 88 87 08 00 0A 00 08 00 6F 13 2F 13 6F 13 2F 11 2D D1 2C 10 6C 10 2C 10 A0 20 A0 20 A0 20 A0 A0 A0 A0 E0 E0 60 60 30 30 08 A8 08 18 08 A8 08 48 08 A8 08 18 08 A8 08 48 00 FE 00 FF 7F FF 7F C1 7F C1 7F EB 7F C1 01 FF 00 00 00 00 00 00 FF 00 00 00 FF 00 00 00 FF 00 10 10 0B 0B 07 04 07 04 03 02 01 01 00 00 00 00 B4 B4 E4 E4 BC BC EE 6E E7 27 F0 10 FC 9C 77 5F 00 00 00 00 07 07 1F 18 3F 20 7F 40 7F 40 7F 40 00 00 00 00 00 00 80 80 C0 40 C0 40 C0 40 80 80 02 03 05 04 07 04 04 07 04 07 04 06 04 05 04 07 CE FA 0C FC 08 F8 08 F8 08 F8 08 F8 08 F8 88 F8 00 3C 00 7E 10 67 24 C3 24 C3 24 C3 24 C3 34 C3 00 3C 00 66 00 E7 2C C3 3C C3 3C C3 3C 42 18 66 00 00 00 00 00 00 20 20 90 90 B8 A8 A8 A8 10 10 0A 10 06 08 02 04 00 04 00 04 00 04 00 04 00 04 17 50 28 60 2A 60 28 60 2A 60 28 60 28 67 68 60 DE 2B 2E 17 6E 17 2E 17 6E 17 2E 17 2E D7 2E 17 98 48 B0 50 A0 60 A0 20 A0 20 A0 20 A0 20 A0 20 08 A8 08 18 08 A8 08 48 08 B8 08 3F 08 BF 09 7F 00 7F 00 FF 7E FF 7E C1 7E C1 7E EB 7E C1 00 FF 00 00 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 00 38 38 34 24 3C 24 3F 27 3C 27 3C 27 3F 2F 37 3C 17 14 17 1F 1C 1F F0 FF 00 FF 02 FF FF FF BF A0 BF A0 BF B8 7F 7F 2F 2F 7F 7F F7 9C F7 9C FD 05 FD 05 FD 1D FF FF F7 F4 FF FE EF 38 EF 38 01 01 01 01 01 01 02 02 02 02 02 02 01 01 00 00 02 02 02 02 01 01 00 00 00 00 00 00 00 00 00 00 34 C3 3C 43 3C 43 18 66 18 66 08 76 08 36 08 34 18 26 18 24 18 24 08 34 00 18 00 08 00 08 00 08 00 00 0F 0F 1F 10 3C 20 70 40 73 43 67 4C 3F 28 00 00 80 80 DC 5C 3E 22 32 E2 B1 C1 C3 4B 27 7C 00 00 00 00 00 00 00 00 E0 E0 D0 10 D0 D0 E0 20 5C 50 7C 50 39 30 7C 4C EE 82 C0 84 60 43 31 26 1F 3C BB 62 F1 41 61 41 C3 03 F7 04 EE 08 9C 60 90 10 08 08 18 18 3C 64 F2 C2 E3 60 39 20 F2 00 00 FF 00 FF FF FF FF 00 FF 00 FF 00 00 FF 00 FF FF FF FF 00 FF FF 00 FF 00 FF FF FF FF FF FF FF 38 38 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 0E 0E 11 11 11 11 12 12 F3 1F F0 3F F0 BF 60 7F 10 1F 50 5F 30 3F F1 FF CF FB 0C FC 08 F8 08 F8 08 F8 08 F8 08 F8 88 F8 4E 7A C9 D9 09 F9 0E FE 48 F8 98 F8 FC FC 7C 7C A0 BF 40 7F E0 FF 20 3F 11 1F 72 7E FF FF FF FF 00 3C 00 1C 00 1C 00 18 00 08 00 00 00 00 00 00 00 FF 00 AB 00 55 00 FF 00 00 00 00 00 00 00 00 00 15 00 18 00 15 00 12 00 15 00 18 00 15 00 12 40 40 40 C0 40 40 40 40 40 40 40 C0 40 40 40 40 0E 32 0E 32 0E 32 0E 32 0F 33 8F B3 CE F3 EE 73 00 00 00 00 00 00 00 00 00 00 00 00 80 80 C0 40 00 00 00 00 80 80 47 47 1F 18 3F 20 7F 40 7F 40 7F 40 BF A0 BF A0 BF B8 7F 7F 3F 3F 77 7C F7 9C F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 00 00 01 01 01 01 01 01 02 02 02 02 02 02 01 01 F3 9F F0 1F F0 3F E0 BF 70 7F 10 1F 50 5F 31 3F 3E 22 1F 1F 10 1F 10 1F 12 1F 19 1F 3F 3F 3E 3E 12 1E 12 1E 12 1E 12 1E 7E 7E FF 83 FF 81 FF FF 01 01 01 01 01 01 02 02 02 02 02 02 01 01 00 00 60 E0 80 80 80 80 80 80 80 80 80 80 80 80 80 80 07 04 07 04 07 04 07 04 07 04 07 04 07 04 07 04 0B 09 0B 0A 0F 0A 17 12 17 1C 14 17 17 14 2F 24 00 00 70 70 8F 8F 98 9F E0 FF F0 9F 78 57 7F 4C 3B 2F D0 DF F0 FF C0 FF C0 FF FF FF 00 00 00 00 FF FF FF FF FF FF FF F8 F8 F0 F2 E1 F5 E3 F2 E6 FF FF FF 81 C3 81 DF 85 DF 85 FF BD FF 81 FF FF FF FF FF FF FF FF FF 1F 1F 0F 4F 87 AF C7 4F 67 FF FF FF FF FF FF FF 00 00 00 00 FF FF FF 00 00 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 F2 E6 F5 E3 F2 E1 F8 F0 FF F8 FF FF FF FF FF FF 00 00 FF FF 00 FF 00 00 FF 00 FF FF FF FF FF FF 4F 67 AF C7 4F 87 1F 0F FF 1F FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 00 EF E7 CF 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C E7 CF 00 EF 00 00 FF 00 FF FF FF FF FF FF 07 07 18 1F 21 3E 47 7F 5F 7F 39 30 7B 62 FB B2 E0 E0 18 F8 84 7C E2 FE FA FE 9C 0C DE 46 DF 4D FF A0 FF C2 7F 54 7F 5C 3F 2E 3F 23 1F 18 07 07 FF 05 FF 43 FE 2A FE 3A FC 74 FC C4 F8 18 E0 E0 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 E0 E0 F8 18 7C 04 FE F2 FE FA 0E 0E 45 45 0D 0D B4 B4 64 64 3C 3C 2E 2E 27 27 10 10 0C 0C 03 03 2D 2D 26 26 3C 3C 74 74 E4 E4 08 08 30 30 C0 C0 2F 24 2F 24 2F 24 2F 24 67 7C BC A7 FF E4 1B 1B 00 00 00 00 01 01 01 01 03 03 03 03 03 02 07 04 04 07 07 04 07 04 04 04 06 06 05 05 05 05 06 06 07 04 07 04 04 07 04 04 04 04 07 07 07 07 06 06 06 06 06 06 04 04 07 07 05 05 03 03 05 05 0E 0E 0F 1F 01 10 01 10 01 10 01 08 01 07 04 09 00 0F 08 01 F8 F1 4E C1 02 C7 8C BD 84 AD 62 CF 7E FE EC 90 EF 9F FA F7 DA E7 BD BD B5 AD D2 EF 7F 7F F8 F8 18 E8 38 88 B8 08 B0 10 E0 E0 D0 30 F0 F0 18 18 30 30 60 60 C0 C0 C0 C0 FF FF 83 83 60 62 0A 00 08 00 08 07 08 00 08 01 F8 F1 F8 F1 08 01 6C 10 2C 10 2C D1 2C 11 AC 90 EF 9F EF 9F EC 90 18 18 0C 0C 06 C6 03 C3 03 03 FF FF C1 C1 06 46 00 04 00 0C 02 10 02 10 02 10 02 10 02 10 02 10 0C 4C 0C 4C 09 49 0B 4B 0A 4A 10 50 12 52 10 50 7E 33 7E 33 BE 93 FE D3 7E 53 3E 0B 7E 4B 3E 0B A0 20 90 30 98 48 98 48 98 48 98 48 98 48 98 48 00 00 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 02 02 02 02 00 01 02 02 02 02 02 02 02 03 02 03 02 02 02 02 02 03 02 02 06 06 0E 0A 0E 0A 0B 0A 0B 0A 0F 0A 0A 0A 06 06 0A 0A 1A 12 1F 1F 00 00 00 00 1F 1F 3F 20 7F 47 7C 4C 7C 4C 7C 4C 00 00 00 00 E0 E0 F0 30 F8 18 F8 98 F8 98 F8 98 7F 4F 7F 40 7F 4F 7C 4C 7C 4C 7C 7C 00 00 00 00 F8 98 F8 18 F8 98 F8 98 F8 98 F8 F8 00 00 00 00 00 00 7C 7C 4E 4E 4E 4E 4E 4E 4E 4E 7C 7C 00 00 00 00 7E 7E 60 60 7C 7C 60 60 60 60 7E 7E 00 00 00 00 46 46 46 46 46 46 46 46 4E 4E 3C 3C 00 00 00 00 3C 3C 66 66 60 60 60 60 66 66 3C 3C 00 00 00 00 46 46 6E 6E 7E 7E 56 56 46 46 46 46 00 00 00 00 3C 3C 4E 4E 4E 4E 7E 7E 4E 4E 4E 4E 00 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 FF 01 01 FF FF FF 00 00 00 00 00 00 00 00 F0 F0 F0 B0 F0 B0 F0 F0 00 00 00 00 07 07 18 1F 20 3F 30 3F 18 17 3F 2C 7B 4F 70 5F 90 9F 90 9F 70 7F 11 1F 3E 3E 3E 3E 00 00 7C 7C 66 66 66 66 7C 7C 68 68 66 66 00 00 00 00 3C 3C 66 66 66 66 66 66 66 66 3C 3C 00 00 00 00 60 60 60 60 60 60 60 60 60 60 7E 7E 00 00 00 00 3C 3C 66 66 60 60 6E 6E 66 66 3E 3E 00 00 00 EE 00 00 FF FF FF FF FF FF FF FF FF FF FF FF 00 01 00 02 00 02 00 04 00 08 00 08 00 10 00 10 80 80 C0 40 C0 40 E0 20 30 50 30 50 38 48 18 28 00 00 00 00 00 00 00 00 00 03 00 03 00 02 00 02 00 00 00 00 00 00 00 00 08 F8 08 18 08 A8 08 48 00 80 00 80 00 80 00 80 00 00 00 00 00 00 00 00 00 20 00 20 00 20 1F 20 00 40 00 40 00 40 00 40 1C 24 0C 34 0C 34 04 FC 0E 32 0E 32 0E 32 0E 32 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 1F 00 18 00 15 00 12 00 00 00 00 00 00 00 00 40 C0 40 C0 40 40 40 40 00 02 00 03 00 02 00 02 00 02 00 03 00 02 00 02 08 AF 08 1A 08 AD 08 4F 08 A8 08 18 08 A8 08 48 00 00 00 00 00 00 00 00 00 00 00 00 00 01 00 02 00 40 15 40 15 40 15 40 15 C0 15 C1 17 43 16 46 24 0C 34 0C 34 04 FC 0E 32 0E 32 0E 32 0E 32 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 2A 20 01 00 1D 01 09 00 07 01 0B 00 03 20 04 00 20 20 06 00 0A 80 17 00 06 01 06 00 04 01 05 00 1E 80 0B 00 06 80 1C 00 0A 10 08 11 04 01 02 00 04 01 06 00 00 10 06 00 04 10 05 00 1A 80 24 00 15 01 07 00 20 10 04 00 05 10 03 00 0D 10 06 00 03 10 05 00 25 80 15 00 1B 10 04 00 13 80 03 00 1C 80 19 00 1A 01 06 00 0A 20 01 00 09 20 02 00 14 10 03 00 0E 80 16 00 0A 10 0A 11 06 10 16 00 13 80 25 00 1C 01 06 00 03 20 02 00 0E 20 03 00 04 20 02 00 03 20 05 00 0D 80 21 00 13 01 07 00 05 01 06 00 04 01 05 00 06 20 03 00 05 20 02 00 1C 20 03 00 0E 80 12 00 0C 10 04 00 02 01 08 00 10 01 08 00 1E 80 19 00 10 10 03 00 04 10 05 00 24 80 1C 00 05 01 05 00 11 20 03 00 12 80 20 00 0A 10 01 11 06 01 00 00 04 10 04 00 04 10 03 00 02 10 19 00 04 10 07 00 0A 00 00 00 00 00 00 00 4D 20 08 21 06 20 0B 00 07 20 06 00 64 10 00 11 06 10 05 00 2F 80 16 00 17 20 05 00 06 20 06 00 10 80 18 00 34 01 05 00 01 10 0E 11 06 10 20 00 0A 80 0A 00 2B 20 06 00 06 20 05 00 05 20 06 00 0A 80 0C 00 0A 01 07 00 02 10 0B 00 05 10 04 00 0D 80 1C 00 75 01 06 00 0E 80 1F 00 1A 01 06 00 00 10 07 00 05 10 06 00 04 10 08 00 03 10 08 00 0C 80 0F 00 0A 01 07 00 00 10 3D 00 05 80 1F 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 10 18 00 04 08 00 04 08 08 00 04 14 10 08 10 10 14 18 14 00 0C 04 18 00 14 14 08 04 04 0C 00 18 04 00 08 0C 0C 18 00 0C 08 00 18 10 14 14 18 08 AA 65 C6 65 FC 66 28 66 34 67 AF 66 F1 65 54 66 B2 65 CE 65 14 67 CE 65 CE 65 C3 66 F7 65 60 66 D4 67 DC 67 9D 67 A5 67 E4 67 E4 67 E4 67 AD 67 3F 6F 4A 6F 55 6F 60 6F 6B 6F 76 6F 81 6F 8C 6F 97 6F A2 6F AD 6F B8 6F C3 6F CE 6F D9 6F E4 6F EF 6F C9 F5 C5 D5 E5 FA 7F DF FE 01 28 46 FE 02 28 7B FA 7E DF A7 20 7B F0 E4 A7 28 0D AF EA E0 DF EA E8 DF EA F0 DF EA F8 DF CD D2 64 CD DD 69 CD FD 69 CD 3C 68 CD 21 6A CD 44 6C CD 65 6A AF EA E0 DF EA E8 DF EA F0 DF EA F8 DF EA 7F DF E1 D1 C1 F1 C9 CD C7 69 AF EA E1 DF EA F1 DF EA F9 DF 21 BF DF CB BE 21 9F DF CB BE 21 AF DF CB BE 21 CF DF CB BE 21 E9 6E CD 98 69 3E 30 EA 7E DF 21 7B 65 CD 5D 69 18 B7 21 7F 65 18 F6 AF EA 7E DF 18 85 21 7E DF 35 7E FE 28 28 EC FE 20 28 E0 FE 18 28 E4 FE 10 20 97 34 18 94 B2 E3 83 C7 B2 E3 C1 C7 FA F1 DF FE 01 C9 FA E1 DF FE 05 C9 FA E1 DF FE 07 C9 FA E1 DF FE 08 C9 00 B5 D0 40 C7 00 B5 20 40 C7 00 B6 A1 80 C7 3E 05 21 9B 65 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 34 7E FE 02 28 13 21 A0 65 C3 56 69 3E 03 21 A5 65 C3 36 69 CD 8B 69 A7 C0 AF EA E1 DF E0 10 3E 08 E0 12 3E 80 E0 14 21 9F DF CB BE C9 00 80 E1 C1 87 00 80 E1 AC 87 21 E7 65 C3 36 69 21 E4 DF 34 7E FE 04 28 17 FE 0B 28 19 FE 0F 28 0F FE 18 CA 0E 66 C9 3E 01 21 F0 DF 77 C3 D3 65 21 EC 65 C3 56 69 21 E7 65 C3 56 69 48 BC 42 66 87 CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 CD 89 65 C8 3E 02 21 23 66 C3 36 69 00 B0 F1 B6 C7 00 B0 F1 C4 C7 00 B0 F1 CE C7 00 B0 F1 DB C7 CD 8F 65 C8 3E 07 21 40 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 34 7E FE 01 28 12 FE 02 28 13 FE 03 28 14 FE 04 28 15 FE 05 CA D3 65 C9 21 45 66 18 0D 21 4A 66 18 08 21 4F 66 18 03 21 40 66 C3 56 69 3E 80 E3 00 C4 93 83 83 73 63 53 43 33 23 13 00 00 23 43 63 83 A3 C3 D3 E3 FF CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 3E 06 21 95 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 4E 34 06 00 21 9A 66 09 7E A7 CA D3 65 5F 21 A5 66 09 7E 57 06 86 0E 12 7B E2 0C 7A E2 0C 78 E2 C9 3B 80 B2 87 87 A2 93 62 43 23 00 80 40 80 40 80 CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 CD 89 65 C8 3E 03 21 EC 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 4E 34 06 00 21 F1 66 09 7E A7 CA D3 65 5F 21 F7 66 09 7E 57 06 87 18 AD CD 8F 65 C8 3E 28 21 40 67 C3 36 69 B7 80 90 FF 83 00 D1 45 80 00 F1 54 80 00 D5 65 80 00 70 66 80 65 65 65 64 57 56 55 54 54 54 54 54 47 46 46 45 45 45 44 44 44 34 34 34 34 34 34 34 34 34 34 34 34 34 34 34 70 60 70 70 70 80 90 A0 D0 F0 E0 D0 C0 B0 A0 90 80 70 60 50 40 30 30 20 20 20 20 20 20 20 20 20 20 20 10 10 3E 30 21 4D 67 C3 36 69 3E 30 21 51 67 C3 36 69 CD 8B 69 A7 C0 21 FC DF 7E 4F FE 24 CA E9 67 34 06 00 C5 21 55 67 09 7E E0 22 C1 21 79 67 09 7E E0 21 3E 80 E0 23 C9 3E 20 21 49 67 C3 36 69 3E 12 21 45 67 C3 36 69 CD 8B 69 A7 C0 AF EA F9 DF 3E 08 E0 21 3E 80 E0 23 21 CF DF CB BE C9 80 3A 20 60 C6 21 D9 6E CD 0D 69 F0 04 E6 1F 47 3E D0 80 EA F5 DF 21 FB 67 C3 64 69 F0 04 E6 0F 47 21 F4 DF 34 7E 21 F5 DF FE 0E 30 0A 34 34 7E E6 F0 B0 0E 1D E2 C9 FE 1E CA E2 68 35 35 35 18 EE FA F0 DF FE 01 CA 6B 68 FE 02 CA 00 68 FA F1 DF FE 01 CA B6 68 FE 02 CA 17 68 C9 80 80 20 9D 87 80 F8 20 98 87 80 FB 20 96 87 80 F6 20 95 87 21 A9 6E CD 0D 69 21 5A 68 7E EA F6 DF 3E 01 EA F5 DF 21 57 68 C3 64 69 3E 00 EA F5 DF 21 5F 68 7E EA F6 DF 21 5C 68 18 EC 3E 01 EA F5 DF 21 64 68 7E EA F6 DF 21 61 68 18 DB 3E 02 EA F5 DF 21 69 68 7E EA F6 DF 21 66 68 18 CA 21 F4 DF 34 2A FE 09 28 C4 FE 13 28 D1 FE 17 28 DE FE 20 28 17 2A FE 00 C8 FE 01 28 05 FE 02 28 05 C9 34 34 18 02 35 35 7E E0 1D C9 AF EA F1 DF E0 1A 21 BF DF CB BE 21 9F DF CB BE 21 AF DF CB BE 21 CF DF CB BE FA E9 DF FE 05 28 05 21 E9 6E 18 2A 21 C9 6E 18 25 E5 EA F1 DF 21 BF DF CB FE AF EA F4 DF EA F5 DF EA F6 DF E0 1A 21 9F DF CB FE 21 AF DF CB FE 21 CF DF CB FE E1 CD 98 69 C9 F5 1D FA 71 DF 12 1C F1 1C 12 1D AF 12 1C 1C 12 1C 12 7B FE E5 28 09 FE F5 28 13 FE FD 28 16 C9 C5 0E 10 06 05 18 13 C5 0E 16 06 04 18 0C C5 0E 1A 06 05 18 05 C5 0E 20 06 04 2A E2 0C 05 20 FA C1 C9 1C EA 71 DF 1C 3D CB 27 4F 06 00 09 4E 23 46 69 60 7C C9 D5 6B 62 34 2A BE 20 03 2D AF 77 D1 C9 C5 0E 30 2A E2 0C 79 FE 40 20 F8 C1 C9 AF EA E1 DF EA E9 DF EA F1 DF EA F9 DF EA 9F DF EA AF DF EA BF DF EA CF DF 3E FF E0 25 3E 03 EA 78 DF 3E 08 E0 12 E0 17 E0 21 3E 80 E0 14 E0 19 E0 23 AF E0 10 E0 1A C9 11 E0 DF 1A A7 28 0C 21 9F DF CB FE 21 80 64 CD 78 69 E9 1C 1A A7 28 07 21 90 64 CD 7C 69 E9 C9 11 F8 DF 1A A7 28 0C 21 CF DF CB FE 21 A0 64 CD 78 69 E9 1C 1A A7 28 07 21 A8 64 CD 7C 69 E9 C9 CD A5 69 C9 21 E8 DF 2A A7 C8 FE FF 28 F2 77 47 21 B0 64 E6 1F CD 7C 69 CD 13 6B CD 3C 6A C9 FA E9 DF A7 C8 21 BE 6A 3D 28 06 23 23 23 23 18 F7 2A EA 78 DF 2A EA 76 DF 2A EA 79 DF 2A EA 7A DF AF EA 75 DF EA 77 DF C9 FA E9 DF A7 28 3D 21 75 DF FA 78 DF FE 01 28 37 FE 03 28 2F 34 2A BE 20 33 2D 36 00 2C 2C 34 FA 79 DF CB 46 CA 8F 6A FA 7A DF 47 FA F1 DF A7 28 04 CB D0 CB F0 FA F9 DF A7 28 04 CB D8 CB F8 78 E0 25 C9 3E FF 18 F9 FA 79 DF 18 DE FA F9 DF A7 20 F1 FA F1 DF A7 20 EB C9 01 24 EF 56 01 00 E5 00 01 20 FD 00 01 20 DE F7 03 18 7F F7 03 18 F7 7F 03 48 DF 5B 01 18 DB E7 01 00 FD F7 03 20 7F F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 EF F7 01 20 EF F7 2A 4F 7E 47 0A 12 1C 03 0A 12 C9 2A 12 1C 2A 12 C9 CD C7 69 AF EA 75 DF EA 77 DF 11 80 DF 06 00 2A 12 1C CD 0D 6B 11 90 DF CD 0D 6B 11 A0 DF CD 0D 6B 11 B0 DF CD 0D 6B 11 C0 DF CD 0D 6B 21 90 DF 11 94 DF CD 02 6B 21 A0 DF 11 A4 DF CD 02 6B 21 B0 DF 11 B4 DF CD 02 6B 21 C0 DF 11 C4 DF CD 02 6B 01 10 04 21 92 DF 36 01 79 85 6F 05 20 F8 AF EA 9E DF EA AE DF EA BE DF C9 E5 AF E0 1A 6B 62 CD 98 69 E1 18 2A CD B9 6B CD CE 6B 5F CD B9 6B CD CE 6B 57 CD B9 6B CD CE 6B 4F 2C 2C 73 2C 72 2C 71 2D 2D 2D 2D E5 21 70 DF 7E E1 FE 03 28 CA CD B9 6B C3 5E 6C D5 2A 5F 3A 57 13 7B 22 7A 32 D1 C9 D5 2A 5F 3A 57 13 13 18 F1 2A 4F 3A 47 0A 47 C9 E1 18 2C FA 70 DF FE 03 20 10 FA B8 DF CB 7F 28 09 7E FE 06 20 04 3E 40 E0 1C E5 7D C6 09 6F 7E A7 20 DD 7D C6 04 6F CB 7E 20 D5 E1 CD 67 6D 2D 2D C3 39 6D 2D 2D 2D 2D CD C5 6B 7D C6 04 5F 54 CD 02 6B FE 00 28 1F FE FF 28 04 2C C3 5C 6C 2D E5 CD C5 6B CD CE 6B 5F CD B9 6B CD CE 6B 57 E1 7B 22 7A 32 18 D5 21 E9 DF 36 00 CD A5 69 C9 21 E9 DF 7E A7 C8 3E 01 EA 70 DF 21 90 DF 2C 2A A7 CA 04 6C 35 C2 D8 6B 2C 2C CD CE 6B FE 00 CA 09 6C FE 9D CA 89 6B E6 F0 FE A0 20 1A 78 E6 0F 4F 06 00 E5 11 81 DF 1A 6F 13 1A 67 09 7E E1 2D 22 CD B9 6B CD CE 6B 78 4F 06 00 CD B9 6B FA 70 DF FE 04 CA BC 6C E5 7D C6 05 6F 5D 54 2C 2C 79 FE 01 28 0F 36 00 21 02 6E 09 2A 12 1C 7E 12 E1 C3 D3 6C 36 01 E1 18 17 E5 11 C6 DF 21 94 6E 09 2A 12 1C 7B FE CB 20 F8 0E 20 21 C4 DF 18 2E E5 FA 70 DF FE 01 28 21 FE 02 28 19 0E 1A FA BF DF CB 7F 20 05 AF E2 3E 80 E2 0C 2C 2C 2C 2C 2A 5F 16 00 18 15 0E 16 18 05 0E 10 3E 00 0C 2C 2C 2C 3A A7 20 4F 2A 5F 2C 2A 57 E5 2C 2C 2A A7 28 02 1E 01 2C 2C 36 00 2C 7E E1 CB 7F 20 13 7A E2 0C 7B E2 0C 2A E2 0C 7E F6 80 E2 7D F6 05 6F CB 86 E1 2D 3A 32 2D 11 70 DF 1A FE 04 28 09 3C 12 11 10 00 19 C3 52 6C 21 9E DF 34 21 AE DF 34 21 BE DF 34 C9 06 00 E5 E1 2C 18 AC 78 CB 3F 6F 26 00 19 5E C9 E5 7D C6 06 6F 7E E6 0F 28 18 EA 71 DF FA 70 DF 0E 13 FE 01 28 0E 0E 18 FE 02 28 08 0E 1D FE 03 28 02 E1 C9 2C 2A 5F 7E 57 D5 7D C6 04 6F 46 FA 71 DF FE 01 18 09 FE 03 18 00 21 FF FF 18 1C 11 CB 6D CD 5E 6D CB 40 20 02 CB 33 7B E6 0F CB 5F 28 06 26 FF F6 F0 18 02 26 00 6F D1 19 7D E2 0C 7C E2 18 BE 00 00 00 00 00 00 10 00 0F 00 00 11 00 0F F0 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 00 0F 2C 00 9C 00 06 01 6B 01 C9 01 23 02 77 02 C6 02 12 03 56 03 9B 03 DA 03 16 04 4E 04 83 04 B5 04 E5 04 11 05 3B 05 63 05 89 05 AC 05 CE 05 ED 05 0A 06 27 06 42 06 5B 06 72 06 89 06 9E 06 B2 06 C4 06 D6 06 E7 06 F7 06 06 07 14 07 21 07 2D 07 39 07 44 07 4F 07 59 07 62 07 6B 07 73 07 7B 07 83 07 8A 07 90 07 97 07 9D 07 A2 07 A7 07 AC 07 B1 07 B6 07 BA 07 BE 07 C1 07 C4 07 C8 07 CB 07 CE 07 D1 07 D4 07 D6 07 D9 07 DB 07 DD 07 DF 07 00 00 00 00 00 C0 A1 00 3A 00 C0 B1 00 29 01 C0 61 00 3A 00 C0 12 34 45 67 9A BC DE FE 98 7A B7 BE A8 76 54 31 01 23 44 55 67 88 9A BB A9 88 76 55 44 33 22 11 01 23 45 67 89 AB CD EF FE DC BA 98 76 54 32 10 A1 82 23 34 45 56 67 78 89 9A AB BC CD 64 32 10 11 23 56 78 99 98 76 67 9A DF FE C9 85 42 11 31 02 04 08 10 20 40 0C 18 30 05 00 01 03 05 0A 14 28 50 0F 1E 3C 03 06 0C 18 30 60 12 24 48 08 10 00 07 0E 1C 38 70 15 2A 54 04 08 10 20 40 80 18 30 60 04 09 12 24 48 90 1B 36 6C 0C 18 04 0A 14 28 50 A0 1E 3C 78 00 0E 6F F9 7C FF 7C 11 7D 21 7D 00 05 6F 48 7E 44 7E 4A 7E 4C 7E 00 0E 6F 3B 76 33 76 41 76 63 76 00 F9 6E 00 76 FC 75 02 76 00 00 00 0E 6F 4C 71 42 71 56 71 62 71 00 0E 6F C6 72 B8 72 D4 72 02 73 00 0E 6F 08 70 FA 6F 00 00 00 00 00 05 6F 9D 7E 91 7E A9 7E B5 7E 00 0E 6F 28 7C 24 7C 2A 7C 2C 7C 00 0E 6F 00 00 00 7A 00 00 00 00 00 0E 6F 00 00 26 7A 2A 7A 00 00 00 0E 6F 73 7A 6F 7A 75 7A 00 00 00 0E 6F DF 7A E3 7A E5 7A E7 7A 00 0E 6F 65 7B 6B 7B 6F 7B 73 7B 00 0E 6F 6C 78 76 78 7E 78 86 78 00 2B 6F 43 75 4B 75 51 75 00 00 00 0E 6F 8D 75 95 75 9B 75 00 00 16 70 34 70 16 70 4D 70 93 70 FF FF FA 6F 62 70 74 70 62 70 85 70 F4 70 FF FF 08 70 9D 74 00 41 A2 44 4C 56 4C 42 4C 44 4C 3E 4C 3C 4C 44 4C 56 4C 42 4C 44 4C 3E 4C 3C 4C 00 44 4C 44 3E 4E 48 42 48 42 3A 4C 44 3E 4C 48 44 42 3E 3C 34 3C 42 4C 48 00 44 4C 44 3E 4E 48 42 48 42 3A 52 48 4C 52 4C 44 3A 42 A8 44 00 9D 64 00 41 A3 26 3E 3C 26 2C 34 3E 36 34 3E 2C 34 00 26 3E 30 22 3A 2C 1E 36 30 A2 34 36 34 30 2C 2A 00 A3 26 3E 30 22 3A 2A 2C 34 34 2C 22 14 00 A2 52 4E 4C 48 44 42 44 48 4C 44 48 4E 4C 4E A3 52 42 A2 44 48 A3 4C 48 4C 56 50 A2 56 5A A3 5C 5A A2 56 52 50 4C 50 4A A8 4C A7 52 A1 56 58 A3 56 A2 52 4E 52 4C 4E 48 A7 56 A1 5A 5C A3 5A A2 56 54 56 50 54 4C 5A 54 4C 54 5A 60 66 54 64 54 60 54 A3 5C A2 60 5C 5A 5C A1 56 5A A4 56 A2 01 00 A2 34 3A 44 3A 30 3A 34 3A 2C 3A 2A 3A 2C 3A 44 3A 30 3A 34 3A 2C 3A 2A 3A 2C 34 2C 26 3E 38 32 38 2A 38 32 38 A3 34 42 2A A2 34 3A 42 3A 30 3A 2E 34 26 34 2E 34 A8 30 A2 32 38 2A 38 32 38 A8 34 A3 34 2A 24 1C 20 24 2C 30 34 A8 26 00 68 71 68 71 AE 71 FF FF 42 71 CB 71 CB 71 1D 72 FF FF 4C 71 3A 72 3A 72 7F 72 7F 72 FF FF 56 71 A3 72 FF FF 62 71 9D 84 00 81 A3 52 A2 48 4A A3 4E A2 4A 48 A3 44 A2 44 4A A3 52 A2 4E 4A A7 48 A2 4A A3 4E 52 A3 4A 44 44 01 A2 01 A3 4E A2 54 A3 5C A2 58 54 A7 52 A2 4A A3 52 A2 4E 4A A3 48 A2 48 4A A3 4E 52 A3 4A 44 44 01 00 9D 50 00 81 A4 3A 32 36 30 A4 32 2C A8 2A A3 01 A4 3A 32 36 30 A3 32 3A A4 44 42 01 00 9D 43 00 81 A3 48 A2 42 44 48 A1 52 4E A2 44 42 A7 3A A2 44 4A 01 A2 48 44 A1 42 42 A2 3A 42 44 A3 48 4A A3 44 3A 3A 01 A2 1E A3 3C A2 44 4A A1 4A 4A A2 48 44 A7 40 A2 3A 40 A1 44 40 A2 3C 3A 42 3A 42 44 48 42 4A 42 A1 44 4A 3A 01 A3 3A 3A 01 00 9D 30 00 81 A4 32 2C 30 2A 2C 22 A4 22 A3 30 01 A4 32 2C 30 2A A3 2C 32 A4 3A 36 01 00 9D C9 6E 20 A2 22 3A 22 3A 22 3A 22 3A 2C 44 2C 44 2C 44 2C 44 2A 42 2A 42 22 3A 22 3A 2C 44 2C 44 2C 44 30 32 36 1E 01 1E 01 1E 2C 24 1A 32 01 32 1A 28 28 01 30 48 01 48 01 3A 01 42 2C 3A 2C 3A A3 2C 01 00 9D C9 6E 20 A2 44 52 44 52 44 52 44 52 42 52 42 52 42 52 42 52 44 52 44 52 44 52 44 52 42 52 42 52 A4 01 00 A2 01 06 01 06 01 A1 06 06 A2 01 06 01 06 01 06 01 06 06 06 00 0B 73 3F 73 67 73 67 73 C9 73 FF FF B8 72 08 73 3C 73 8E 73 8E 73 4B 74 FF FF C6 72 1F 73 53 73 B5 73 B5 73 B5 73 B5 73 B5 73 B5 73 C0 74 DE 74 DE 74 DE 74 EE 74 FE 74 FE 74 0E 75 0E 75 1E 75 1E 75 0E 75 2E 75 FF FF D4 72 33 73 FF FF 02 73 A5 01 00 9D 62 00 80 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 A2 06 A1 06 06 A2 06 06 00 A5 01 00 9D 32 00 80 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D 82 00 80 A2 3A 48 52 50 52 A1 48 48 A2 4A 44 48 A1 40 40 A2 44 3E 40 A1 3A 3A A2 3E 38 3A 30 32 38 3A 30 32 3E 00 9D 53 00 40 A2 30 40 40 44 40 A1 3E 40 A2 44 3E 40 A1 38 3A A2 3E 38 3A A1 2E 30 A2 38 30 30 28 2C 2C 30 28 2C 38 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 A8 3A A2 3E 38 A8 3A A3 3E A2 40 A1 40 40 A2 44 3E 40 A1 40 40 A2 44 3E A8 40 A3 44 A2 48 A1 48 48 A2 4A 44 48 A1 48 48 A2 4A 44 A8 48 A3 4C A2 4E A1 4E 4E A2 4E 4E 52 4E 4E 4C 4E A1 4E 4E A2 4E 4E 52 4E 4E 4C 4E A1 4E 4E A2 4E 4E 4C A1 4C 4C A2 4C 4C 4A A1 4A 4A A2 4A 44 3E 40 44 36 44 A1 40 40 A2 36 A3 40 A1 36 3A A2 36 30 44 A1 40 40 A2 36 A3 40 A1 36 3A A2 36 2E A5 36 A8 01 A3 38 00 A8 30 A2 30 30 A8 30 A3 36 A5 01 A8 01 A3 3E A2 40 A1 40 40 A2 44 3E 40 A1 40 40 A2 44 3E A8 36 A3 3A A2 3E A1 40 44 A2 3E 44 48 48 48 3A 3E A1 40 44 A2 3E 44 46 46 46 3A 3E A1 40 44 A2 3E 44 3A A1 3E 40 A2 3A 40 3A A1 3E 40 A2 3E 3E 2C 3A 3E 26 30 A1 30 30 A2 30 A3 30 A1 30 34 A2 30 28 2E A1 2E 2E A2 2E A3 2E A1 2E 32 A2 2E 28 A5 26 A8 01 A3 2C 00 A2 3A A1 3A 3A A2 32 2C 3A A1 3A 3A A2 38 30 3A A1 3A 3A A2 32 2C 3A A1 3A 3A A2 2C 1E 00 A2 28 A1 40 28 A2 1E 36 28 A1 40 28 A2 1E 36 00 A2 28 A1 40 28 A2 1E 36 28 A1 40 28 A2 2C 44 00 A2 1E A1 36 1E A2 1E 36 28 A1 40 28 A2 28 40 00 A2 1E A1 36 1E A2 1E 36 1E A1 36 1E A2 1E 36 00 A2 22 A1 3A 22 A2 22 3A 22 A1 3A 22 A2 22 3A 00 A2 1E A1 36 1E A2 1E 36 1E A1 36 1E A2 A4 3E 00 36 3E 44 A4 44 57 75 62 75 FF FF 45 75 5E 75 FF FF 4B 75 7C 75 FF FF 51 75 9D 20 00 81 AA 01 00 9D 70 00 81 A2 42 32 38 42 46 34 3C 46 4A 38 42 4A 4C 3C 42 4C 46 34 3C 46 40 2E 34 40 00 9D E9 6E 21 A8 42 A3 2A A8 42 A3 2A A8 42 A3 2A 00 A1 75 AC 75 FF FF 8F 75 A8 75 FF FF 95 75 EE 75 FF FF 9B 75 9D 20 00 81 AA 01 00 9D 70 00 81 A2 4C 42 50 42 54 42 50 42 56 42 54 42 50 42 54 42 4C 42 50 42 54 42 50 42 56 42 54 42 50 42 54 42 5A 46 56 46 54 46 50 46 4E 46 50 46 54 46 50 46 50 3E 4C 3E 4C 3E 4A 3E 4A 3E 46 3E 4A 3E 50 3E 00 9D E9 6E 21 A5 4C 4A 46 42 38 3E 42 42 00 04 76 00 00 14 76 23 76 9D B2 00 80 A2 60 5C 60 5C 60 62 60 5C A4 60 00 9D 92 00 80 A2 52 4E 52 4E 52 54 52 4E A4 52 9D E9 6E 20 A2 62 60 62 60 62 66 62 60 A3 62 01 6F 76 69 77 69 77 00 00 BF 76 AA 77 3C 78 0C 77 EB 77 EB 77 F5 77 EB 77 EB 77 FE 77 F5 77 EB 77 EB 77 FE 77 F5 77 07 78 11 78 FE 77 F5 77 EB 77 5B 77 5B 77 1A 78 1A 78 1A 78 1A 78 9D C3 00 80 A2 3C 3E 3C 3E 38 50 A3 01 A2 3C 3E 3C 3E 38 50 A3 01 A2 01 48 01 46 01 42 01 46 A1 42 46 A2 42 42 38 A3 3C 01 A2 3E 42 3E 42 3C 54 A3 01 A2 3E 42 3E 42 3C 54 A3 01 A2 01 56 01 54 01 54 01 50 A2 01 A1 50 54 A2 50 4E A3 50 01 00 9D 74 00 80 A2 36 38 36 38 2E 3E A3 01 A2 36 38 36 38 2E 3E A3 01 A2 01 36 01 36 01 32 01 36 36 32 32 30 A3 36 01 A2 38 3C 38 3C 36 4E A3 01 A2 38 3C 38 3C 36 4E A3 01 A2 01 50 01 4E 01 46 01 46 A2 01 A1 48 4E A2 48 46 A3 40 01 00 9D E9 6E 20 A2 48 46 48 46 3E 20 A3 01 A2 48 46 48 46 3E 20 A3 01 A2 2E 3C 2E 24 24 24 24 3C 2A 3E 2A 3E A6 2E A3 01 A1 01 A2 48 46 48 46 2E 2E A3 01 A2 48 46 48 46 2E 2E A3 01 A2 2A 3C 2A 3C 2E 3E 2E 3E 2E 42 2E 42 A6 38 A3 01 A1 01 00 A8 01 A2 06 0B A8 01 A2 06 0B A5 01 01 00 9D C5 00 80 A1 46 4A A4 46 A2 01 A3 50 A8 4A A3 01 A1 42 46 A4 42 A2 01 A3 4E A1 4E 50 A4 46 A7 01 A1 40 46 A4 40 A2 01 A3 46 A1 46 4A A4 42 A7 01 A1 36 38 A4 36 A2 01 A3 3C A7 42 A4 40 A2 01 00 9D 84 00 41 A1 40 42 A4 40 A2 01 A3 40 A8 42 A3 01 A1 3C 40 A4 3C A2 01 A3 3C A1 3C 40 A4 40 A7 01 A1 36 32 A4 2E A2 01 A3 40 A1 36 38 A4 32 A7 01 A1 2E 32 A4 2E A2 01 A3 2A A7 30 A4 2E A2 01 00 A2 38 38 01 38 38 38 01 38 00 2E 2E 01 2E 2E 2E 01 2E 00 2A 2A 01 2A 2A 2A 01 2A 00 A2 38 38 01 38 36 36 01 36 00 32 32 01 32 2E 2E 01 2E 00 A2 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 01 0B 01 0B 00 9D 66 00 81 A7 58 5A A3 58 A7 5E A4 5A A2 01 A7 50 54 A3 58 A7 5A A4 58 A2 01 A7 50 A3 4E A7 4E 58 54 A3 4A A7 5A 5E A3 5A A7 54 A4 50 A2 01 00 8E 78 11 79 8E 78 96 79 00 00 AD 78 38 79 AD 78 BA 79 D5 78 5E 79 D5 78 DD 79 FE 78 84 79 FE 78 84 79 9D D1 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 44 A1 4C 52 00 9D B2 00 80 A2 52 A1 52 52 A2 52 A1 52 52 A2 44 A1 44 44 A2 44 01 4C A1 4C 4C A2 4C A1 4C 4C A2 3A A1 3A 3A A2 3A 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E A1 52 52 A2 56 01 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 44 A1 48 48 A2 4C 01 00 A2 06 A7 01 A2 0B 0B 0B 01 A2 06 A7 01 A2 0B 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 44 A1 44 52 A2 48 44 A1 48 52 56 5A 00 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 36 A1 36 36 A2 36 01 00 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 44 A1 44 44 A2 44 A1 44 44 A2 42 A1 42 42 A2 42 01 00 A2 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 48 A1 48 52 A2 44 52 A3 5C 00 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 01 3A A3 4C 00 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 44 A1 44 44 A2 44 A1 44 44 A2 01 4C A3 44 00 04 7A 00 00 9D C2 00 40 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 A1 44 42 A2 44 A4 01 00 2C 7A 00 00 4B 7A 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E 52 56 01 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 52 4C 44 01 A5 01 77 7A 00 00 96 7A B4 7A 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D C2 00 40 A2 4E A1 4E 52 A2 56 4E A3 48 48 A2 4C A1 4C 4A A2 4C 44 34 4C A3 4C A5 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E 52 A1 56 56 A2 56 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 52 4C A1 44 44 A2 01 A5 01 00 E9 7A 00 00 08 7B 25 7B 4F 7B 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D B2 00 80 A2 4E A1 4E 52 A2 56 4E A3 48 48 A2 4C A1 4C 4A A2 4C 44 34 4C A3 4C A5 01 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C 4E 56 5C 56 4E 44 3E 44 A2 5C A1 5C 5C A2 5C A1 5C 5C 52 4C 44 4C 5C 01 A2 01 A5 01 A2 0B 0B 0B 0B A2 0B 0B 0B 01 A2 0B 0B 0B 0B A2 0B 0B 0B 01 A5 01 77 7B CE 7B 00 00 96 7B F2 7B A8 7B 02 7C BB 7B 12 7C 9D D1 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 44 A1 4C 52 00 A2 52 A7 01 A2 44 44 44 01 4C A7 01 A2 3A 3A 3A 01 00 A2 5C A7 01 A2 4E 52 56 01 A2 5C A7 01 A2 44 48 4C 01 00 A2 06 A7 01 A2 0B 0B 0B 01 A2 06 A7 01 A2 0B 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 48 A1 48 52 A2 5C 52 A3 5C 00 01 3A 01 3A 01 3A 01 3A 01 3A 01 3A 01 3A A3 34 01 48 01 48 01 48 01 48 01 44 01 44 01 4C A3 44 A2 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B A2 01 0B 0B 01 2E 7C 00 00 63 7C 97 7C CB 7C 9D B3 00 80 A6 52 A1 50 A6 52 A1 50 A6 52 A1 48 A3 01 A6 4C A1 4A A6 4C A1 4A A6 4C A1 42 A3 01 A6 3E A1 42 A6 44 A1 48 A6 4C A1 50 A6 52 A1 56 A6 52 A1 6A 00 9D 93 00 C0 A6 42 A1 40 A6 42 A1 40 A6 42 A1 42 A3 01 A6 3A A1 38 A6 3A A1 38 A6 3A A1 3A A3 01 A6 38 A1 38 A6 3A A1 3E A6 42 A1 44 A6 48 A1 4C A6 42 A1 42 9D E9 6E A0 A6 48 A1 46 A6 48 A1 46 A6 48 A1 52 A3 01 A6 44 A1 42 A6 44 A1 42 A6 44 A1 4C A3 01 A6 48 A1 3A A6 3E A1 42 A6 44 A1 48 A6 4C A1 50 A6 52 A1 3A A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 2E 7D FF FF 01 7D 29 7D 35 7D 5B 7D 82 7D 5B 7D A4 7D C6 7D FF FF 03 7D 3B 7D 6C 7D 93 7D 6C 7D B5 7D 07 7E FF FF 13 7D 3E 7D 41 7D FF FF 23 7D 9D 60 00 81 00 9D 20 00 81 AA 01 00 A3 01 50 54 58 00 A5 01 00 A5 01 00 A3 01 06 01 06 01 A2 06 06 A3 01 06 A3 01 06 01 06 01 A2 06 06 01 01 06 06 00 A7 5A A2 5E A7 5A A2 58 A7 58 A2 54 A7 58 A2 54 00 9D C9 6E 20 A2 5A 62 68 70 5A 62 68 70 5A 64 66 6C 5A 64 66 6C 00 A7 54 A2 50 A7 54 A2 50 A7 50 A2 4C A7 4A A2 50 00 58 5E 64 6C 58 5E 64 6C 50 54 58 5E 50 58 5E 64 00 A7 54 A2 50 A7 54 A2 50 A7 50 A2 4C A7 4A A2 46 00 58 5E 64 6C 58 5E 64 6C 50 54 58 5E 50 58 5E 64 00 A7 4A A2 4C A7 4A A2 46 A7 46 A2 44 A7 46 A2 4A A7 4C A2 50 A7 4C A2 4A A7 4A A2 46 A7 4A A2 4C A7 50 A2 4E A7 50 A2 52 A7 58 A2 54 A7 5A A2 54 A7 52 A2 50 A7 4C A2 4A A2 42 38 3C 4A A3 42 01 00 4A 52 58 5E 4A 58 5E 62 54 62 68 6C 54 62 68 6C 46 4C 54 5E 46 4C 54 5A 50 58 5E 64 50 5E 64 6C 4A 50 58 5E 4A 58 5E 62 4E 54 5A 62 4E 54 5A 66 50 58 5E 64 50 5E 64 68 A8 5A A3 01 00 4E 7E 00 00 5E 7E 6D 7E 7D 7E 9D B1 00 80 A7 01 A1 5E 5E A6 68 A1 5E A4 68 00 9D 91 00 80 A7 01 A1 54 54 A6 5E A1 58 A4 5E 9D E9 6E 20 A7 01 A1 4E 4E A6 58 A1 50 A3 58 01 A7 01 A1 06 06 A6 0B A1 06 A0 06 06 06 06 06 06 06 06 A3 01 BB 7E 28 7F BB 7E 73 7F FF FF 91 7E E5 7E 4F 7F E5 7E 96 7F FF FF 9D 7E FB 7E 61 7F FB 7E AE 7F FF FF A9 7E 11 7F FF FF B5 7E 9D 82 00 80 A2 54 A1 54 54 54 4A 46 4A A2 54 A1 54 54 54 58 5C 58 A2 54 A1 54 54 58 54 52 54 A1 58 5C 58 5C A2 58 A1 56 58 00 9D 62 00 80 A2 01 44 01 40 01 44 01 46 01 44 01 44 01 40 01 40 00 9D E9 6E 20 A2 54 54 4A 52 54 54 4A 58 54 54 52 54 4E 54 4A 52 00 A2 06 0B 06 0B 06 0B 06 0B 06 0B 06 0B 06 A1 0B 0B 06 A2 0B A1 06 00 A2 5E A1 5E 5E 5E 54 50 54 A2 5E A1 5E 5E 5E 62 66 62 A2 5E A1 5E 5C A2 58 A1 58 54 A1 52 54 52 54 A2 52 A1 4E 52 00 A2 01 46 01 4A 01 46 01 4A 01 46 01 46 01 46 01 46 00 A2 46 54 54 54 46 54 54 54 46 54 52 58 44 52 4A 58 00 A2 62 A1 62 62 62 5E 5A 5E A2 62 A1 62 62 62 5E 5A 5E A2 62 A1 4A 4E A2 52 A1 4A 5C A3 58 A1 54 A6 6C 00 A2 01 4A 01 4A 01 4A 01 4A 01 A1 46 46 A2 46 A1 46 46 A3 46 A2 44 01 00 A2 42 5A 50 5A 42 5A 50 5A 4A A1 52 52 A2 52 A1 52 52 A3 52 A2 54 01 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 C3 D3 64 C3 A5 69 00 00 00 00 00 00 00 00 00 00";
-	uint16_t offset = 0x0000;
-	while (!ss.eof())
+	// Demo program when no ROM was given
+	if (!gb->cartrdige_loader.loaded())
 	{
-		std::string b;
-		ss >> b;
-		gb->m_memory[offset++] = (uint8_t)std::stoul(b, nullptr, 16);
+		std::stringstream ss;
+		//ss << "F0 44 FE 90 38 FA AF E0 40 21 00 90 11 50 01 01 00 08 1A 22 13 0B 78 B1 20 F8 21 00 99 11 37 00 1A 22 13 A7 20 FA 3E E4 E0 47 AF E0 42 E0 43 E0 26 3E 81 E0 40 18 FE 48 65 6C 6C 6F 20 47 69 74 68 75 62 20 21 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 F3 C3 00 00 CE ED 66 66 CC 0D 00 0B 03 73 00 83 00 0C 00 0D 00 08 11 1F 88 89 00 0E DC CC 6E E6 DD DD D9 99 BB BB 67 63 6E 0E EC CC DD DC 99 9F BB B9 33 3E 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 E7 FD AD 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 08 00 0C 00 08 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 80 80 80 80 80 80 80 80 80 80 00 00 80 80 00 00 00 00 6C 6C 6C 6C 48 48 00 00 00 00 00 00 00 00 48 48 FC FC 48 48 48 48 48 48 FC FC 48 48 00 00 10 10 7C 7C 90 90 78 78 14 14 F8 F8 10 10 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 90 90 50 50 60 60 94 94 98 98 6C 6C 00 00 00 00 38 38 38 38 08 08 10 10 00 00 00 00 00 00 18 18 20 20 20 20 20 20 20 20 20 20 18 18 00 00 18 18 04 04 04 04 04 04 04 04 04 04 18 18 00 00 00 00 10 10 54 54 38 38 54 54 10 10 00 00 00 00 00 00 10 10 10 10 7C 7C 10 10 10 10 00 00 00 00 00 00 00 00 00 00 00 00 30 30 30 30 60 60 00 00 00 00 00 00 00 00 7C 7C 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 60 60 00 00 00 00 04 04 08 08 10 10 20 20 40 40 80 80 00 00 30 30 58 58 CC CC CC CC CC CC 68 68 30 30 00 00 30 30 70 70 F0 F0 30 30 30 30 30 30 FC FC 00 00 78 78 CC CC 18 18 30 30 60 60 C0 C0 FC FC 00 00 78 78 8C 8C 0C 0C 38 38 0C 0C 8C 8C 78 78 00 00 38 38 58 58 98 98 FC FC 18 18 18 18 18 18 00 00 FC FC C0 C0 C0 C0 78 78 0C 0C CC CC 78 78 00 00 78 78 CC CC C0 C0 F8 F8 CC CC CC CC 78 78 00 00 FC FC 0C 0C 0C 0C 18 18 18 18 30 30 30 30 00 00 78 78 CC CC CC CC 78 78 CC CC CC CC 78 78 00 00 78 78 CC CC CC CC 7C 7C 0C 0C CC CC 78 78 00 00 00 00 C0 C0 C0 C0 00 00 C0 C0 C0 C0 00 00 00 00 00 00 C0 C0 C0 C0 00 00 C0 C0 40 40 80 80 00 00 04 04 18 18 60 60 80 80 60 60 18 18 04 04 00 00 00 00 00 00 FC FC 00 00 FC FC 00 00 00 00 00 00 80 80 60 60 18 18 04 04 18 18 60 60 80 80 00 00 78 78 CC CC 18 18 30 30 20 20 00 00 20 20 00 00 00 00 20 20 70 70 F8 F8 F8 F8 F8 F8 00 00 00 00 30 30 48 48 84 84 84 84 FC FC 84 84 84 84 00 00 F8 F8 84 84 84 84 F8 F8 84 84 84 84 F8 F8 00 00 3C 3C 40 40 80 80 80 80 80 80 40 40 3C 3C 00 00 F0 F0 88 88 84 84 84 84 84 84 88 88 F0 F0 00 00 FC FC 80 80 80 80 FC FC 80 80 80 80 FC FC 00 00 FC FC 80 80 80 80 FC FC 80 80 80 80 80 80 00 00 7C 7C 80 80 80 80 BC BC 84 84 84 84 78 78 00 00 84 84 84 84 84 84 FC FC 84 84 84 84 84 84 00 00 7C 7C 10 10 10 10 10 10 10 10 10 10 7C 7C 00 00 04 04 04 04 04 04 04 04 04 04 04 04 F8 F8 00 00 84 84 88 88 90 90 A0 A0 E0 E0 90 90 8C 8C 00 00 80 80 80 80 80 80 80 80 80 80 80 80 FC FC 00 00 84 84 CC CC B4 B4 84 84 84 84 84 84 84 84 00 00 84 84 C4 C4 A4 A4 94 94 8C 8C 84 84 84 84 00 00 78 78 84 84 84 84 84 84 84 84 84 84 78 78 00 00 F8 F8 84 84 84 84 F8 F8 80 80 80 80 80 80 00 00 78 78 84 84 84 84 84 84 A4 A4 98 98 6C 6C 00 00 F8 F8 84 84 84 84 F8 F8 90 90 88 88 84 84 00 00 7C 7C 80 80 80 80 78 78 04 04 84 84 78 78 00 00 7C 7C 10 10 10 10 10 10 10 10 10 10 10 10 00 00 84 84 84 84 84 84 84 84 84 84 84 84 78 78 00 00 84 84 84 84 84 84 84 84 84 84 48 48 30 30 00 00 84 84 84 84 84 84 84 84 B4 B4 CC CC 84 84 00 00 84 84 84 84 48 48 30 30 48 48 84 84 84 84 00 00 44 44 44 44 44 44 28 28 10 10 10 10 10 10 00 00 FC FC 04 04 08 08 10 10 20 20 40 40 FC FC 00 00 38 38 20 20 20 20 20 20 20 20 20 20 38 38 00 00 00 00 80 80 40 40 20 20 10 10 08 08 04 04 00 00 1C 1C 04 04 04 04 04 04 04 04 04 04 1C 1C 00 00 10 10 28 28 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FF FF C0 C0 60 60 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 78 78 04 04 7C 7C 84 84 78 78 00 00 80 80 80 80 80 80 F8 F8 84 84 84 84 78 78 00 00 00 00 00 00 7C 7C 80 80 80 80 80 80 7C 7C 00 00 04 04 04 04 04 04 7C 7C 84 84 84 84 78 78 00 00 00 00 00 00 78 78 84 84 F8 F8 80 80 7C 7C 00 00 00 00 3C 3C 40 40 FC FC 40 40 40 40 40 40 00 00 00 00 00 00 78 78 84 84 7C 7C 04 04 F8 F8 00 00 80 80 80 80 F8 F8 84 84 84 84 84 84 84 84 00 00 00 00 10 10 00 00 10 10 10 10 10 10 10 10 00 00 00 00 10 10 00 00 10 10 10 10 10 10 E0 E0 00 00 80 80 80 80 84 84 98 98 E0 E0 98 98 84 84 00 00 10 10 10 10 10 10 10 10 10 10 10 10 10 10 00 00 00 00 00 00 68 68 94 94 94 94 94 94 94 94 00 00 00 00 00 00 78 78 84 84 84 84 84 84 84 84 00 00 00 00 00 00 78 78 84 84 84 84 84 84 78 78 00 00 00 00 00 00 78 78 84 84 84 84 F8 F8 80 80 00 00 00 00 00 00 78 78 84 84 84 84 7C 7C 04 04 00 00 00 00 00 00 BC BC C0 C0 80 80 80 80 80 80 00 00 00 00 00 00 7C 7C 80 80 78 78 04 04 F8 F8 00 00 00 00 40 40 F8 F8 40 40 40 40 40 40 3C 3C 00 00 00 00 00 00 84 84 84 84 84 84 84 84 78 78 00 00 00 00 00 00 84 84 84 84 48 48 48 48 30 30 00 00 00 00 00 00 84 84 84 84 84 84 A4 A4 58 58 00 00 00 00 00 00 8C 8C 50 50 20 20 50 50 8C 8C 00 00 00 00 00 00 84 84 84 84 7C 7C 04 04 F8 F8 00 00 00 00 00 00 FC FC 08 08 30 30 40 40 FC FC 00 00 18 18 20 20 20 20 40 40 20 20 20 20 18 18 00 00 10 10 10 10 10 10 10 10 10 10 10 10 10 10 00 00 30 30 08 08 08 08 04 04 08 08 08 08 30 30 00 00 00 00 00 00 48 48 A8 A8 90 90 00 00 00 00 00 00";
+		ss << "C3 0C 02 00 00 00 00 00 C3 0C 02 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 87 E1 5F 16 00 19 5E 23 56 D5 E1 E9 FF FF FF FF FF FF FF FF FF FF FF FF C3 7E 01 FF FF FF FF FF C3 BE 26 FF FF FF FF FF C3 BE 26 FF FF FF FF FF C3 5B 00 F5 E5 D5 C5 CD 6B 00 3E 01 E0 CC C1 D1 E1 F1 D9 F0 CD EF 78 00 9F 00 A4 00 BA 00 EA 27 F0 E1 FE 07 28 08 FE 06 C8 3E 06 E0 E1 C9 F0 01 FE 55 20 08 3E 29 E0 CB 3E 01 18 08 FE 29 C0 3E 55 E0 CB AF E0 02 C9 F0 01 E0 D0 C9 F0 01 E0 D0 F0 CB FE 29 C8 F0 CF E0 01 3E FF E0 CF 3E 80 E0 02 C9 F0 01 E0 D0 F0 CB FE 29 C8 F0 CF E0 01 FB CD 98 0A 3E 80 E0 02 C9 F0 CD FE 02 C0 AF E0 0F FB C9 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 C3 50 01 CE ED 66 66 CC 0D 00 0B 03 73 00 83 00 0C 00 0D 00 08 11 1F 88 89 00 0E DC CC 6E E6 DD DD D9 99 BB BB 67 63 6E 0E EC CC DD DC 99 9F BB B9 33 3E 54 45 54 52 49 53 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 0A 16 BF C3 0C 02 CD E3 29 F0 41 E6 03 20 FA 46 F0 41 E6 03 20 FA 7E A0 C9 7B 86 27 22 7A 8E 27 22 3E 00 8E 27 77 3E 01 E0 E0 D0 3E 99 32 32 77 C9 F5 C5 D5 E5 F0 CE A7 28 12 F0 CB FE 29 20 0C AF E0 CE F0 CF E0 01 21 02 FF 36 81 CD E0 21 CD CC 23 CD B7 23 CD 9E 23 CD 8C 23 CD 7D 23 CD 6E 23 CD 5F 23 CD 50 23 CD 41 23 CD 32 23 CD 23 23 CD F8 22 CD E9 22 CD DA 22 CD CB 22 CD BC 22 CD AD 22 CD 9E 22 CD D7 1E CD B6 FF CD CA 18 FA CE C0 A7 28 1A F0 98 FE 03 20 14 21 6D 98 CD 3B 24 3E 01 E0 E0 21 6D 9C CD 3B 24 AF EA CE C0 21 E2 FF 34 AF E0 43 E0 42 3C E0 85 E1 D1 C1 F1 D9 AF 21 FF DF 0E 10 06 00 32 05 20 FC 0D 20 F9 3E 01 F3 E0 0F E0 FF AF E0 42 E0 43 E0 A4 E0 41 E0 01 E0 02 3E 80 E0 40 F0 44 FE 94 20 FA 3E 03 E0 40 3E E4 E0 47 E0 48 3E C4 E0 49 21 26 FF 3E 80 32 3E FF 32 36 77 3E 01 EA 00 20 31 FF CF AF 21 FF DF 06 00 32 05 20 FC 21 FF CF 0E 10 06 00 32 05 20 FC 0D 20 F9 21 FF 9F 0E 20 AF 06 00 32 05 20 FC 0D 20 F9 21 FF FE 06 00 32 05 20 FC 21 FE FF 06 80 32 05 20 FC 0E B6 06 0C 21 7F 2A 2A E2 0C 05 20 FA CD 95 27 CD F3 7F 3E 09 E0 FF 3E 37 E0 C0 3E 1C E0 C1 3E 24 E0 E1 3E 80 E0 40 FB AF E0 0F E0 4A E0 4B E0 06 CD A6 29 CD F8 02 CD F0 7F F0 80 E6 0F FE 0F CA 1B 02 21 A6 FF 06 02 7E A7 28 01 35 2C 05 20 F7 F0 C5 A7 28 04 3E 09 E0 FF F0 85 A7 28 FB AF E0 85 C3 C4 02 F0 E1 EF CE 1B E2 1C 44 12 7B 12 06 1D 26 1D AE 03 79 04 44 14 8C 14 07 1A C0 1D 16 1F 1F 1F 25 15 B0 14 7B 15 BF 15 29 16 7A 16 EB 16 13 19 77 06 2C 07 25 08 E4 08 31 0B EB 0C D2 0A 32 0D 23 0E 12 11 99 0D 8A 0E CE 1D 41 1E 69 03 93 03 67 11 E6 11 FC 11 1C 12 C7 05 F7 05 B3 12 05 13 24 13 51 13 67 13 7E 13 B5 13 E5 13 1B 13 A0 03 EA 27 CD 20 28 CD D7 27 11 07 4A CD EB 27 CD 8A 17 21 00 C3 11 50 64 1A 22 13 7C FE C4 20 F8 3E D3 E0 40 3E FA E0 A6 3E 25 E0 E1 C9 F0 A6 A7 C0 3E FA E0 A6 3E 35 E0 E1 C9 F0 81 A7 20 04 F0 A6 A7 C0 3E 06 E0 E1 C9 CD 20 28 AF E0 E9 E0 98 E0 9C E0 9B E0 FB E0 9F E0 E3 E0 C7 CD 93 22 CD 51 26 CD D7 27 21 00 C8 3E 2F 22 7C FE CC 20 F8 21 01 C8 CD A9 26 21 0C C8 CD A9 26 21 41 CA 06 0C 3E 8E 22 05 20 FC 11 6F 4B CD EB 27 CD 8A 17 21 00 C0 36 80 2C 36 10 2C 36 58 3E 03 EA E8 DF 3E D3 E0 40 3E 07 E0 E1 3E 7D E0 A6 3E 04 E0 C6 F0 E4 A7 C0 3E 13 E0 C6 C9 3E 37 E0 C0 3E 09 E0 C2 AF E0 C5 E0 B0 E0 ED E0 EA 3E 62 E0 EB 3E B0 E0 EC F0 E4 FE 02 3E 02 20 1A 3E 77 E0 C0 3E 09 E0 C3 3E 02 E0 C4 3E 63 E0 EB 3E B0 E0 EC 3E 11 E0 B0 3E 01 E0 E4 3E 0A E0 E1 CD 20 28 CD AD 27 11 D7 4C CD EB 27 CD 8A 17 3E D3 E0 40 C9 3E FF E0 E9 C9 F0 A6 A7 20 0A 21 C6 FF 35 28 9B 3E 7D E0 A6 CD 98 0A 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 0A F0 CB A7 20 3A AF E0 CC 18 67 F0 81 47 F0 C5 CB 50 20 48 CB 60 20 53 CB 68 20 54 CB 58 C8 A7 3E 08 28 2C 78 FE 08 C0 F0 CB FE 29 28 12 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 CB A7 28 32 3E 2A E0 E1 AF E0 A6 E0 C2 E0 C3 E0 C4 E0 E4 C9 F5 F0 80 CB 7F 28 02 E0 F4 F1 18 E6 EE 01 E0 C5 A7 3E 10 28 02 3E 60 EA 01 C0 C9 A7 C0 AF 18 EC A7 C8 AF 18 E9 F0 E4 A7 C8 CD 98 0A AF E0 01 3E 80 E0 02 F0 81 CB 5F 28 0D 3E 33 E0 01 3E 81 E0 02 3E 06 E0 E1 C9 21 B0 FF F0 E4 FE 02 06 10 28 02 06 1D 7E B8 C0 3E 06 E0 E1 C9 F0 E4 A7 C8 F0 E9 FE FF C8 F0 EA A7 28 05 3D E0 EA 18 1C F0 EB 67 F0 EC 6F 2A 47 F0 ED A8 A0 E0 81 78 E0 ED 2A E0 EA 7C E0 EB 7D E0 EC 18 03 AF E0 81 F0 80 E0 EE F0 ED E0 80 C9 AF E0 ED 18 EF C9 F0 E4 A7 C8 F0 E9 FE FF C0 F0 80 47 F0 ED B8 28 19 F0 EB 67 F0 EC 6F F0 ED 22 F0 EA 22 7C E0 EB 7D E0 EC 78 E0 ED AF E0 EA C9 F0 EA 3C E0 EA C9 F0 E4 A7 C8 F0 E9 A7 C0 F0 EE E0 80 C9 21 02 FF CB FE 18 0A 3E 03 E0 CD F0 CB FE 29 20 EF CD 4F 14 3E 80 EA 10 C2 CD 71 26 E0 CE AF E0 01 E0 CF E0 DC E0 D2 E0 D3 E0 D4 E0 D5 E0 E3 CD F3 7F 3E 2B E0 E1 C9 F0 CB FE 29 28 16 F0 F0 A7 28 1E AF E0 F0 11 01 C2 CD 92 14 CD 17 15 CD 71 26 18 0D F0 81 CB 47 20 07 CB 5F 20 03 CD B0 14 F0 CB FE 29 28 1E F0 CC A7 C8 AF E0 CC 3E 39 E0 CF F0 D0 FE 50 28 2D 47 F0 C1 B8 C8 78 E0 C1 3E 01 E0 F0 C9 F0 81 CB 5F 20 22 CB 47 20 1E F0 CC A7 C8 AF E0 CC F0 CF FE 50 28 09 F0 C1 E0 CF 3E 01 E0 CE C9 CD 8A 17 3E 16 E0 E1 C9 3E 50 18 ED 21 02 FF CB FE 18 1F 3E 03 E0 CD F0 CB FE 29 20 EF CD A1 0A CD A1 0A CD A1 0A 06 00 21 00 C3 CD A1 0A 22 05 20 F9 CD 20 28 CD AD 27 11 14 52 CD EB 27 CD 8A 17 3E 2F CD DD 1F 3E 03 E0 CE AF E0 01 E0 CF E0 DC E0 D2 E0 D3 E0 D4 E0 D5 E0 E3 E0 CC 21 00 C4 06 0A 3E 28 22 05 20 FC F0 D6 A7 C2 6D 07 CD 17 15 3E D3 E0 40 21 80 C0 11 05 07 06 20 CD 25 07 21 00 C2 11 ED 26 0E 02 CD 76 17 CD 0E 08 CD 71 26 AF E0 D7 E0 D8 E0 D9 E0 DA E0 DB 3E 17 E0 E1 C9 40 28 AE 00 40 30 AE 20 48 28 AF 00 48 30 AF 20 78 28 C0 00 78 30 C0 20 80 28 C1 00 80 30 C1 20 1A 22 13 05 20 FA C9 F0 CB FE 29 28 23 F0 CC A7 28 13 F0 D0 FE 60 28 2D FE 06 30 02 E0 AC F0 AD E0 CF AF E0 CC 11 10 C2 CD 66 17 21 AD FF 18 68 F0 81 CB 5F 28 04 3E 60 18 4D F0 CC A7 28 50 F0 CF FE 60 20 38 CD 8A 17 F0 D6 A7 20 18 3E 18 E0 E1 F0 CB FE 29 C0 AF E0 A0 3E 06 11 E0 FF 21 A2 C9 CD 68 1B C9 F0 CB FE 29 C2 28 08 AF E0 A0 3E 06 11 E0 FF 21 A2 C9 CD 68 1B C3 28 08 F0 D0 FE 06 30 02 E0 AD F0 AC E0 CF AF E0 CC 3C E0 CE 11 00 C2 CD 66 17 21 AC FF 7E CB 60 20 14 CB 68 20 22 CB 70 20 24 CB 78 28 13 FE 03 30 0F C6 03 18 05 FE 05 28 07 3C 77 3E 01 EA E0 DF CD 0E 08 CD 71 26 C9 A7 28 F6 3D 18 ED FE 03 38 EF D6 03 18 E5 40 60 40 70 40 80 50 60 50 70 50 80 78 60 78 70 78 80 88 60 88 70 88 80 F0 AC 11 01 C2 21 F6 07 CD 55 17 F0 AD 11 11 C2 21 02 08 CD 55 17 C9 CD 20 28 AF EA 10 C2 E0 98 E0 9C E0 9B E0 FB E0 9F E0 CC E0 01 E0 CE E0 D0 E0 CF E0 D1 CD 51 26 CD 93 22 CD F2 1F AF E0 E3 CD 8A 17 11 7C 53 D5 3E 01 E0 A9 E0 C5 CD EB 27 D1 21 00 9C CD EE 27 11 39 28 21 63 9C 0E 0A CD 7D 1F 21 00 C2 11 BF 26 CD B6 26 21 10 C2 11 C7 26 CD B6 26 21 51 99 3E 30 E0 9E 36 00 2D 36 03 CD E8 1A AF E0 A0 F0 CB FE 29 11 D4 08 F0 AC 28 05 11 C4 08 F0 AD 21 B0 98 77 26 9C 77 21 80 C0 06 10 CD 25 07 3E 77 E0 C0 3E D3 E0 40 3E 19 E0 E1 3E 01 E0 CD C9 18 84 C0 00 18 8C C0 20 20 84 C1 00 20 8C C1 20 18 84 AE 00 18 8C AE 20 20 84 AF 00 20 8C AF 20 3E 08 E0 FF AF E0 0F F0 CB FE 29 C2 F6 09 CD 98 0A CD 98 0A AF E0 CC 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 55 20 E4 11 16 00 0E 0A 21 02 C9 06 0A AF E0 CC CD 98 0A 2A E0 01 3E 81 E0 02 F0 CC A7 28 FB 05 20 EB 19 0D 20 E5 F0 AC FE 05 28 3D 21 22 CA 11 40 00 19 3C FE 05";//20 FA 11 22 CA 0E 0A 06 0A 1A 22 1C 05 20 FA D5 11 D6 FF 19 D1 E5 21 D6 FF 19 E5 D1 E1 0D 20 E7 11 D6 FF 06 0A 7C FE C8 28 09 3E 2F 22 05 20 FC 19 18 F0 CD 98 0A CD 98 0A AF E0 CC 3E 29 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 55 20 E4 21 00 C3 06 00 AF E0 CC 2A CD 98 0A E0 01 3E 81 E0 02 F0 CC A7 28 FB 04 20 EB CD 98 0A CD 98 0A AF E0 CC 3E 30 E0 01 3E 81 E0 02 F0 CC A7 28 FB F0 01 FE 56 20 E4 CD 8C 0A 3E 09 E0 FF 3E 1C E0 E1 3E 02 E0 E3 3E 03 E0 CD F0 CB FE 29 28 05 21 02 FF CB FE 21 00 C3 2A EA 03 C2 2A EA 13 C2 7C E0 AF 7D E0 B0 C9 F0 AD 3C 47 21 42 CA 11 C0 FF 05 28 03 19 18 FA CD 98 0A AF E0 CC 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 29 20 E7 11 16 00 0E 0A 06 0A AF E0 CC E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 22 05 20 EC 19 0D 20 E6 CD 98 0A AF E0 CC 3E 55 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 29 20 E7 06 00 21 00 C3 AF E0 CC E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 22 04 20 EC CD 98 0A AF E0 CC 3E 56 E0 01 3E 80 E0 02 F0 CC A7 28 FB F0 01 FE 30 20 E7 C3 C6 09 21 42 CA 3E 80 06 0A 22 05 20 FC C9 C5 06 FA 40 05 20 FC C1 C9 E5 C5 F0 FC E6 FC 4F 26 03 F0 04 47 AF 05 28 0A 3C 3C 3C 3C FE 1C 28 F4 18 F3 57 F0 AE 5F 25 28 07 B2 B1 E6 FC B9 28 E1 7A E0 AE 7B E0 FC C1 E1 C9 3E 01 E0 FF F0 E3 A7 20 27 06 44 0E 20 CD 3F 11 3E 02 E0 CD FA DE C0 A7 28 05 3E 80 EA 10 C2 CD 83 26 CD 96 26 CD 17 15 AF E0 D6 3E 1A E0 E1 C9 FE 05 C0 21 30 C0 06 12 36 F0 23 36 10 23 36 B6 23 36 80 23 05 20 F1 FA FF C3 06 0A 21 00 C4 3D 28 06 2C 05 20 F9 18 F2 36 2F 3E 03 E0 CE C9 3E 01 E0 FF 21 9C C0 AF 22 36 50 2C 36 27 2C 36 00 CD 0D 1C CD 88 1C CD BB 24 CD 9C 20 CD 3E 21 CD A1 25 CD 4D 22 CD 9B 0B F0 D5 A7 28 14 3E 77 E0 CF E0 B1 3E AA E0 D1 3E 1B E0 E1 3E 05 E0 A7 18 10 F0 E1 FE 01 20 1B 3E AA E0 CF E0 B1 3E 77 E0 D1 AF E0 DC E0 D2 E0 D3 E0 D4 F0 CB FE 29 20 02 E0 CE CD F0 0B CD 8C 0C C9 11 20 00 21 02 C8 3E 2F 0E 12 06 0A E5 BE 20 0A 23 05 20 F9 E1 19 0D 20 F1 E5 E1 79 E0 B1 FE 0C FA E9 DF 30 07 FE 08 C0 CD 17 15 C9 FE 08 C8 FA F0 DF FE 02 C8 3E 08 EA E8 DF C9 F0 CB FE 29 28 52 3E 01 EA 7F DF E0 AB F0 CF E0 F1 AF E0 F2 E0 CF CD CB 1C C9 F0 CC A7 C8 21 30 C0 11 04 00 AF E0 CC F0 D0 FE AA 28 61 FE 77 28 49 FE 94 28 CB 47 A7 28 51 CB 7F 20 6F FE 13 30 17 3E 12 90 4F 0C 3E 98 77 19 D6 08 05 20 F9 3E F0 0D 28 04 77 19 18 F9 F0 DC A7 28 07 F6 80 E0 B1 AF E0 DC 3E FF E0 D0 F0 CB FE 29 F0 B1 20 07 E0 CF 3E 01 E0 CE C9 E0 CF C9 F0 D1 FE AA 28 26 3E 77 E0 D1 3E 01 E0 E1 18 CE 0E 13 18 C1 F0 D1 FE 77 28 12 3E AA E0 D1 3E 1B E0 E1 3E 05 E0 A7 0E 01 06 12 18 A0 3E 01 E0 EF 18 AC E6 7F FE 05 30 A6 E0 D2 18 AE F0 D3 A7 28 07 CB 7F C8 E6 07 18 0A F0 D2 A7 C8 E0 D3 AF E0 D2 C9 4F C5 21 22 C8 11 E0 FF 19 0D 20 FC 11 22 C8 0E 11 06 0A 1A 22 1C 05 20 FA D5 11 16 00 19 D1 E5 21 16 00 19 E5 D1 E1 0D 20 E7 C1 11 00 C4 06 0A 1A 22 13 05 20 FA D5 11 16 00 19 D1 0D 20 EC 3E 02 E0 E3 E0 D4 AF E0 D3 C9 F0 A6 A7 C0 3E 01 E0 FF 3E 03 E0 CD F0 D1 FE 77 20 0C F0 D0 FE AA 20 10 3E 01 E0 EF 18 0A FE AA 20 06 F0 D0 FE 77 28 F0 06 34 0E 43 CD 3F 11 AF E0 E3 F0 D1 FE AA 3E 1E 20 02 3E 1D E0 E1 3E 28 E0 A6 3E 1D E0 C6 C9 F0 A6 A7 C0 F0 EF A7 20 05 F0 D7 3C E0 D7 CD 6F 0F 11 F9 26 F0 CB FE 29 28 03 11 0B 27 21 00 C2 0E 03 CD 76 17 3E 19 E0 A6 F0 EF A7 28 05 21 20 C2 36 80 3E 03 CD 73 26 3E 20 E0 E1 3E 09 EA E8 DF F0 D7 FE 05 C0 3E 11 EA E8 DF C9 F0 D7 FE 05 20 07 F0 C6 A7 28 08 18 22 F0 81 CB 5F 28 1C 3E 60 E0 CF E0 CE 18 1D 3E 01 E0 FF F0 CC 28 0C F0 CB FE 29 28 D7 F0 D0 FE 60 28 09 CD BD 0D 3E 03 CD 73 26 C9 3E 1F E0 E1 E0 CC C9 F0 A6 A7 20 23 21 C6 FF 35 3E 19 E0 A6 CD 60 0F 21 01 C2 7E EE 30 22 FE 60 CC 17 0F 2C F5 7E EE 01 77 2E 13 32 F1 2D 77 F0 D7 FE 05 20 28 F0 C6 21 21 C2 FE 06 28 1B FE 08 30 1B 7E FE 72 30 06 FE 69 C8 34 34 C9 36 69 2C 2C 36 57 3E 06 EA E0 DF C9 2D 36 80 C9 F0 A7 A7 C0 3E 0F E0 A7 21 23 C2 7E EE 01 77 C9 F0 A6 A7 C0 F0 EF A7 20 05 F0 D8 3C E0 D8 CD 6F 0F 11 1D 27 F0 CB FE 29 28 03 11 29 27 21 00 C2 0E 02 CD 76 17 3E 19 E0 A6 F0 EF A7 28 05 21 10 C2 36 80 3E 02 CD 73 26 3E 21 E0 E1 3E 09 EA E8 DF F0 D8 FE 05 C0 3E 11 EA E8 DF C9 F0 D8 FE 05 20 07 F0 C6 A7 28 08 18 22 F0 81 CB 5F 28 1C 3E 60 E0 CF E0 CE 18 1D 3E 01 E0 FF F0 CC 28 0C F0 CB FE 29 28 D7 F0 D0 FE 60 28 09 CD AE 0E 3E 02 CD 73 26 C9 3E 1F E0 E1 E0 CC C9 F0 A6 A7 20 1C 21 C6 FF 35 3E 19 E0 A6 CD 60 0F 21 11 C2 7E EE 08 22 FE 68 CC 17 0F 2C 7E EE 01 77 F0 D8 FE 05 20 32 F0 C6 21 01 C2 FE 05 28 25 FE 06 28 11 FE 08 30 21 7E FE 72 30 18 FE 61 C8 34 34 34 34 C9 2D 36 00 2C 36 61 2C 2C 36 56 3E 06 EA E0 DF C9 2D 36 80 C9 F0 A7 A7 C0 3E 0F E0 A7 21 03 C2 7E EE 01 77 C9 F5 E5 F0 D7 FE 05 28 1A F0 D8 FE 05 28 14 F0 CB FE 29 20 0E 21 60 C0 06 24 11 3C 0F 1A 22 13 05 20 FA E1 F1 C9 42 30 0D 00 42 38 B2 00 42 40 0E 00 42 48 1C 00 42 58 0E 00 42 60 1D 00 42 68 B5 00 42 70 BB 00 42 78 1D 00 21 60 C0 11 04 00 06 09 AF 77 19 05 20 FB C9 CD 20 28 21 AC 55 01 00 10 CD E4 27 CD 95 27 21 00 98 11 E4 54 06 04 CD F0 27 21 80 99 06 06 CD F0 27 F0 CB FE 29 20 22 21 41 98 36 BD 2C 36 B2 2C 36 2E 2C 36 BE 2C 36 2E 21 01 9A 36 B4 2C 36 B5 2C 36 BB 2C 36 2E 2C 36 BC F0 EF A7 20 03 CD 85 10 F0 D7 A7 28 49 FE 05 20 16 21 A5 98 06 0B F0 CB FE 29 11 F3 10 28 03 11 FE 10 CD D8 10 3E 04 4F F0 CB FE 29 3E 93 20 02 3E 8F E0 A0 21 E7 99 CD 6A 10 F0 D9 A7 28 17 3E AC E0 A0 21 F0 99 0E 01 CD 6A 10 21 A6 98 11 09 11 06 09 CD D8 10 F0 D8 A7 28 3E FE 05 20 16 21 A5 98 06 0B F0 CB FE 29 11 FE 10 28 03 11 F3 10 CD D8 10 3E 04 4F F0 CB FE 29 3E 8F 20 02 3E 93 E0 A0 21 27 98 CD 6A 10 F0 DA A7 28 0C 3E AC E0 A0 21 30 98 0E 01 CD 6A 10 F0 DB A7 28 0B 21 A7 98 11 ED 10 06 06 CD D8 10 3E D3 E0 40 CD 8A 17 C9 F0 A0 E5 11 20 00 06 02 E5 22 3C 77 3C E1 19 05 20 F6 E1 11 03 00 19 0D 20 E6 C9 21 D7 FF 11 D8 FF F0 D9 A7 20 3A F0 DA A7 20 3C F0 DB A7 20 21 7E FE 04 28 11 1A FE 04 C0 3E 05 12 18 0A 1A FE 03 C0 3E 03 18 05 36 05 AF E0 DB AF E0 D9 E0 DA C9 7E FE 04 20 06 E0 D9 AF E0 DB C9 E0 DA 18 F8 7E FE 05 28 E1 18 DB 1A FE 05 28 CD 18 D4 C5 E5 1A 22 13 05 20 FA E1 11 20 00 19 C1 3E B6 22 05 20 FC C9 B0 B1 B2 B3 B1 3E B4 B5 BB 2E BC 2F 2D 2E 3D 0E 3E BD B2 2E BE 2E 2F 2D 2E 3D 0E 3E B5 B0 41 B5 3D 1D B5 BE B1 3E 01 E0 FF F0 A6 A7 C0 CD 8A 17 AF E0 EF 06 27 0E 79 CD 3F 11 CD F3 7F F0 D7 FE 05 28 0A F0 D8 FE 05 28 04 3E 01 E0 D6 3E 16 E0 E1 C9 F0 CC A7 28 14 AF E0 CC F0 CB FE 29 F0 D0 20 11 B8 28 08 3E 02 E0 CF E0 CE E1 C9 79 E0 CF E0 CE C9 B9 C8 78 E0 CF E1 C9 CD B2 11 21 E6 9C 11 1B 14 06 07 CD 37 14 21 E7 9C 11 22 14 06 07 CD 37 14 21 08 9D 36 72 2C 36 C4 21 28 9D 36 B7 2C 36 B8 11 71 27 21 00 C2 0E 03 CD 76 17 3E 03 CD 73 26 3E DB E0 40 3E BB E0 A6 3E 27 E0 E1 3E 10 EA E8 DF C9 CD 20 28 21 AC 55 01 00 10 CD E4 27 21 FF 9F CD 98 27 21 C0 9D 11 C4 51 06 04 CD F0 27 21 EC 9C 11 29 14 06 07 CD 37 14 21 ED 9C 11 30 14 06 07 CD 37 14 C9 F0 A6 A7 C0 21 10 C2 36 00 2E 20 36 00 3E FF E0 A6 3E 28 E0 E1 C9 F0 A6 A7 28 04 CD FA 13 C9 3E 29 E0 E1 21 13 C2 36 35 2E 23 36 35 3E FF E0 A6 3E 2F CD D7 1F C9 F0 A6 A7 28 04 CD FA 13 C9 3E 02 E0 E1 21 08 9D 06 2F CD FF 19 21 09 9D CD FF 19 21 28 9D CD FF 19 21 29 9D CD FF 19 C9 F0 A6 A7 20 2E 3E 0A E0 A6 21 01 C2 35 7E FE 58 20 21 21 10 C2 36 00 2C C6 20 22 36 4C 2C 36 40 2E 20 36 80 3E 03 CD 73 26 3E 03 E0 E1 3E 04 EA F8 DF C9 CD FA 13 C9 F0 A6 A7 20 1D 3E 0A E0 A6 21 11 C2 35 2E 01 35 7E FE D0 20 0D 3E 9C E0 C9 3E 82 E0 CA 3E 2C E0 E1 C9 F0 A7 A7 20 0B 3E 06 E0 A7 21 13 C2 7E EE 01 77 3E 03 CD 73 26 C9 F0 A6 A7 C0 3E 06 E0 A6 F0 CA D6 82 5F 16 00 21 F5 12 19 E5 D1 F0 C9 67 F0 CA 6F 1A CD FE 19 E5 11 20 00 19 06 B6 CD FF 19 E1 23 3E 02 EA E0 DF 7C E0 C9 7D E0 CA FE 92 C0 3E FF E0 A6 3E 2D E0 E1 C9 B3 BC 3D BE BB B5 1D B2 BD B5 1D 2E BC 3D 0E 3E F0 A6 A7 C0 CD 20 28 CD AD 27 CD 93 22 3E 93 E0 40 3E 05 E0 E1 C9 F0 A6 A7 C0 3E 2E E0 E1 C9 CD B2 11 11 83 27 21 00 C2 0E 03 CD 76 17 F0 F3 EA 03 C2 3E 03 CD 73 26 AF E0 F3 3E DB E0 40 3E BB E0 A6 3E 2F E0 E1 3E 10 EA E8 DF C9 F0 A6 A7 C0 21 10 C2 36 00 2E 20 36 00 3E A0 E0 A6 3E 30 E0 E1 C9 F0 A6 A7 28 04 CD FA 13 C9 3E 31 E0 E1 3E 80 E0 A6 3E 2F CD D7 1F C9 F0 A6 A7 20 2E 3E 0A E0 A6 21 01 C2 35 7E FE 6A 20 21 21 10 C2 36 00 2C C6 10 22 36 54 2C 36 5C 2E 20 36 80 3E 03 CD 73 26 3E 32 E0 E1 3E 04 EA F8 DF C9 CD FA 13 C9 F0 A6 A7 20 15 3E 0A E0 A6 21 11 C2 35 2E 01 35 7E FE E0 20 05 3E 33 E0 E1 C9 F0 A7 A7 20 0B 3E 06 E0 A7 21 13 C2 7E EE 01 77 3E 03 CD 73 26 C9 CD 20 28 CD AD 27 CD F3 7F CD 93 22 3E 93 E0 40 3E 10 E0 E1 C9 F0 A7 A7 C0 3E 0A E0 A7 3E 03 EA F8 DF 06 02 21 10 C2 7E EE 80 77 2E 20 05 20 F7 3E 03 CD 73 26 C9 C2 CA CA CA CA CA CA C3 CB 58 48 48 48 48 C8 73 73 73 73 73 73 C9 74 74 74 74 74 74 1A 77 13 D5 11 20 00 19 D1 05 20 F4 C9 3E 01 E0 FF AF E0 01 E0 02 E0 0F CD 20 28 CD AD 27 11 D7 4C CD EB 27 CD 8A 17 21 00 C2 11 CF 26 0E 02 CD 76 17 11 01 C2 CD 8D 14 F0 C0 1E 12 12 13 FE 37 3E 1C 28 02 3E 1D 12 CD 71 26 CD 17 15 3E D3 E0 40 3E 0E E0 E1 C9 3E 01 EA E0 DF F0 C1 F5 D6 1C 87 4F 06 00 21 A8 14 09 2A 12 13 7E 12 13 F1 12 C9 70 37 70 77 80 37 80 77 11 00 C2 CD 66 17 21 C1 FF 7E CB 58 C2 63 15 CB 40 C2 63 15 CB 48 20 41 1C CB 60 20 26 CB 68 20 2D CB 70 20 16 CB 78 CA 5F 15 FE 1E 30 09 C6 02 77 CD 8D 14 CD 17 15 CD 71 26 C9 FE 1E 38 F8 D6 02 18 ED FE 1D 28 F0 FE 1F 28 EC 3C 18 E2 FE 1C 28 E5 FE 1E 28 E1 3D 18 D7 F5 F0 C5 A7 28 03 F1 18 B6 F1 3E 0E 18 5B F0 C1 D6 17 FE 08 20 02 3E FF EA E8 DF C9 11 10 C2 CD 66 17 21 C0 FF 7E CB 58 20 30 CB 40 20 40 1C 1C CB 60 20 0E CB 68 28 1E FE 37 28 1A 3E 37 06 1C 18 08 FE 77 28 10 3E 77 06 1D 77 F5 3E 01 EA E0 DF F1 12 13 78 12 CD 71 26 C9 3E 02 EA E0 DF F0 C0 FE 37 3E 10 28 02 3E 12 E0 E1 AF 18 E7 3E 0F 18 F7 CD 20 28 11 3F 4E CD EB 27 CD FC 18 CD 8A 17 21 00 C2 11 DB 26 0E 01 CD 76 17 11 01 C2 F0 C2 21 15 16 CD 4E 17 CD 71 26 CD 95 17 CD CA 18 3E D3 E0 40 3E 11 E0 E1 F0 C7 A7 20 04 CD 17 15 C9 3E 15 E0 E1 C9 11 00 C2 CD 66 17 21 C2 FF 3E 0A CB 58 20 EE CB 40 20 EA 3E 08 CB 48 20 E4 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 05 30 16 C6 05 18 05 FE 09 28 0E 3C 77 11 01 C2 21 15 16 CD 4E 17 CD 95 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 05 38 F2 D6 05 18 E1 40 30 40 40 40 50 40 60 40 70 50 30 50 40 50 50 50 60 50 70 CD 20 28 11 A7 4F CD EB 27 CD 8A 17 21 00 C2 11 E1 26 0E 02 CD 76 17 11 01 C2 F0 C3 21 D2 16 CD 4E 17 11 11 C2 F0 C4 21 41 17 CD 4E 17 CD 71 26 CD AF 17 CD CA 18 3E D3 E0 40 3E 13 E0 E1 F0 C7 A7 20 04 CD 17 15 C9 3E 15 E0 E1 C9 E0 E1 AF 12 C9 11 00 C2 CD 66 17 21 C3 FF 3E 0A CB 58 20 EC 3E 14 CB 40 20 E6 3E 08 CB 48 20 E0 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 05 30 16 C6 05 18 05 FE 09 28 0E 3C 77 11 01 C2 21 D2 16 CD 4E 17 CD AF 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 05 38 F2 D6 05 18 E1 40 18 40 28 40 38 40 48 40 58 50 18 50 28 50 38 50 48 50 58 E0 E1 AF 12 C9 11 10 C2 CD 66 17 21 C4 FF 3E 0A CB 58 20 EC CB 40 20 E8 3E 13 CB 48 20 E2 7E CB 60 20 14 CB 68 20 26 CB 70 20 28 CB 78 28 1A FE 03 30 16 C6 03 18 05 FE 05 28 0E 3C 77 11 11 C2 21 41 17 CD 4E 17 CD AF 17 CD 71 26 C9 A7 28 F9 3D 18 E9 FE 03 38 F2 D6 03 18 E1 40 70 40 80 40 90 50 70 50 80 50 90 00 F5 3E 01 EA E0 DF F1 F5 87 4F 06 00 09 2A 12 13 7E 12 13 F1 C6 20 12 C9 F0 81 47 F0 A6 A7 C0 3E 10 E0 A6 1A EE 80 12 C9 E5 06 06 1A 22 13 05 20 FA E1 3E 10 85 6F 0D 20 EF 36 80 C9 AF 21 00 C0 06 A0 22 05 20 FC C9 CD FC 18 F0 C2 21 54 D6 11 1B 00 A7 28 04 3D 19 18 F9 23 23 E5 D1 CD 00 18 C9 CD FC 18 F0 C3 21 00 D0 11 A2 00 A7 28 04 3D 19 18 F9 F0 C4 11 1B 00 A7 28 04 3D 19 18 F9 23 23 E5 D1 CD 00 18 C9 06 03 7E E6 F0 20 0B 1C 3A E6 0F 20 0F 1C 05 20 F1 C9 7E E6 F0 CB 37 12 1C 3A E6 0F 12 1C 05 20 F1 C9 06 03 3A 12 1B 05 20 FA C9 7A E0 FB 7B E0 FC 0E 03 21 A2 C0 D5 06 03 1A 96 38 10 20 05 2D 1B 05 20 F5 D1 13 13 13 0D 20 E8 18 5E D1 F0 FB 57 F0 FC 5F D5 C5 21 06 00 19 E5 D1 2B 2B 2B 0D 28 05 CD F7 17 18 F8 21 A2 C0 06 03 3A 12 1D 05 20 FA C1 D1 79 E0 C8 21 12 00 19 E5 11 06 00 19 E5 D1 E1 0D 28 07 06 06 CD F9 17 18 F6 3E 60 06 05 12 1B 05 20 FB 3E 0A 12 7A E0 C9 7B E0 CA AF E0 9C E0 C6 3E 01 EA E8 DF E0 C7 11 AC C9 F0 FB 67 F0 FC 6F 06 03 E5 D5 C5 CD D5 17 C1 D1 21 20 00 19 E5 D1 E1 D5 11 03 00 19 D1 05 20 E8 2B 2B 06 03 11 A4 C9 D5 0E 06 2A A7 28 05 12 13 0D 20 F7 D1 E5 21 20 00 19 E5 D1 E1 05 20 E8 CD 51 26 3E 01 E0 E8 C9 F0 E8 A7 C8 21 A4 99 11 A4 C9 0E 06 E5 06 06 1A 22 1C 05 20 FA 1C 2C 1C 2C 0D 28 11 CB 41 20 ED E1 11 20 00 19 E5 D1 3E 30 82 57 18 DF E1 AF E0 E8 C9 21 A4 C9 11 20 00 3E 60 0E 03 06 0E E5 22 05 20 FC E1 19 0D 20 F4 C9 F0 C8 21 E4 99 11 E0 FF 3D 28 03 19 18 FA F0 C6 5F 16 00 19 F0 C9 57 F0 CA 5F F0 A6 A7 20 12 3E 07 E0 A6 F0 9C EE 01 E0 9C 1A 28 02 3E 2F CD FE 19 F0 81 47 F0 80 4F 3E 17 CB 70 20 37 CB 71 20 2B CB 78 20 58 CB 79 20 4C CB 40 20 6C CB 48 C2 EE 19 CB 58 C8 1A CD FE 19 CD 17 15 AF E0 C7 F0 C0 FE 37 3E 11 28 02 3E 13 E0 E1 C9 F0 AA 3D E0 AA C0 3E 09 E0 AA 06 26 F0 F4 A7 28 02 06 27 1A B8 20 0A 3E 2E 3C 12 3E 01 EA E0 DF C9 FE 2F 20 F4 3E 0A 18 F1 F0 AA 3D E0 AA C0 3E 09 E0 AA 06 26 F0 F4 A7 28 02 06 27 1A FE 0A 20 05 3E 30 3D 18 D4 FE 2F 20 F9 78 18 CD 1A CD FE 19 3E 02 EA E0 DF F0 C6 3C FE 06 28 8C E0 C6 13 1A FE 60 20 03 3E 0A 12 7A E0 C9 7B E0 CA C9 F0 C6 A7 C8 1A CD FE 19 F0 C6 3D E0 C6 1B 18 E9 47 F0 41 E6 03 20 FA 70 C9 CD 20 28 AF EA 10 C2 E0 98 E0 9C E0 9B E0 FB E0 9F 3E 2F CD D7 1F CD F2 1F CD 51 26 AF E0 E3 CD 8A 17 F0 C0 11 F7 3F 21 C3 FF FE 77 3E 50 28 08 3E F1 21 C2 FF 11 8F 3E D5 E0 E6 7E E0 A9 CD EB 27 D1 21 00 9C CD EE 27 11 39 28 21 63 9C 0E 0A CD 7D 1F 26 98 F0 E6 6F F0 A9 77 26 9C 77 F0 F4 A7 28 07 23 36 27 26 98 36 27 21 00 C2 11 BF 26 CD B6 26 21 10 C2 11 C7 26 CD B6 26 21 51 99 F0 C0 FE 77 3E 25 28 01 AF E0 9E E6 0F 32 28 02 36 02 CD E8 1A FA DE C0 A7 28 05 3E 80 EA 10 C2 CD 07 20 CD 07 20 CD 07 20 CD 83 26 AF E0 A0 F0 C0 FE 77 20 25 3E 34 E0 99 F0 C4 21 B0 98 77 26 9C 77 A7 28 15 47 F0 E4 A7 28 05 CD 1B 1B 18 0A 78 11 C0 FF 21 02 9A CD 68 1B 3E D3 E0 40 AF E0 E1 C9 F0 A9 5F F0 F4 A7 28 0A 3E 0A 83 FE 15 38 02 3E 14 5F 21 06 1B 16 00 19 7E E0 99 E0 9A C9 34 30 2C 28 24 20 1B 15 10 0A 09 08 07 06 05 05 04 04 03 03 02 21 C2 99 11 40 1B 0E 04 06 0A E5 1A 77 E5 7C C6 30 67 1A 77 E1 2C 13 05 20 F1 E1 D5 11 20 00 19 D1 0D 20 E4 C9 85 2F 82 86 83 2F 2F 80 82 85 2F 82 84 82 83 2F 83 2F 87 2F 2F 85 2F 83 2F 86 82 80 81 2F 83 2F 86 83 2F 85 2F 85 2F 2F 47 05 28 03 19 18 FA F0 04 47 3E 80 05 28 08 FE 80 20 F7 3E 2F 18 F5 FE 2F 28 08 F0 04 E6 07 F6 80 18 02 E0 A0 F5 7D E6 0F FE 0B 20 0B F0 A0 FE 2F 28 05 F1 3E 2F 18 01 F1 77 E5 F5 F0 C5 A7 20 04 11 00 30 19 F1 77 E1 23 7D E6 0F FE 0C 20 B7 AF E0 A0 7C E6 0F FE 0A 28 06 11 16 00 19 18 A7 7D FE 2C 20 F5 C9 CD 0D 1C F0 AB A7 C0 CD 0C 05 CD 42 05 CD 83 05 CD BB 24 CD 9C 20 CD 3E 21 CD A1 25 CD 4D 22 CD 91 1F CD B3 05 C9 CB 57 C8 FA DE C0 EE 01 EA DE C0 28 09 3E 80 EA 10 C2 CD 96 26 C9 AF 18 F6 F0 80 E6 0F FE 0F CA 1B 02 F0 E4 A7 C0 F0 81 CB 5F 28 D4 F0 C5 A7 20 45 21 40 FF F0 AB EE 01 E0 AB 28 2A CB DE 3E 01 EA 7F DF 21 4E 99 11 4E 9D 06 04 F0 41 E6 03 20 FA 2A 12 13 05 20 F4 3E 80 EA 10 C2 EA 00 C2 CD 83 26 CD 96 26 C9 CB 9E 3E 02 EA 7F DF FA DE C0 A7 28 E6 AF 18 E6 F0 CB FE 29 C0 F0 AB EE 01 E0 AB 28 33 3E 01 EA 7F DF F0 D0 E0 F2 F0 CF E0 F1 CD CB 1C C9 F0 AB A7 C8 F0 CC 28 39 AF E0 CC F0 CB FE 29 20 08 3E 94 E0 CF E0 CE E1 C9 AF E0 CF F0 D0 FE 94 28 1F F0 F2 E0 D0 F0 F1 E0 CF 3E 02 EA 7F DF AF E0 AB 21 EE 98 06 8E 0E 05 CD FF 19 2C 0D 20 F9 C9 E1 C9 21 EE 98 0E 05 11 DD 1C 1A CD FE 19 13 2C 0D 20 F7 C9 19 0A 1E 1C 0E 3E 80 EA 00 C2 EA 10 C2 CD 83 26 CD 96 26 AF E0 98 E0 9C CD 93 22 3E 87 CD D7 1F 3E 46 E0 A6 3E 0D E0 E1 C9 F0 81 CB 47 20 03 CB 5F C8 AF E0 E3 F0 C5 A7 3E 16 20 0A F0 C0 FE 37 3E 10 28 02 3E 12 E0 E1 C9 F0 A6 A7 C0 21 02 C8 11 89 28 CD 04 28 F0 C3 A7 28 2E 11 40 00 21 27 C8 CD 84 1D 11 00 01 21 87 C8 CD 84 1D 11 00 03 21 E7 C8 CD 84 1D 11 00 12 21 47 C9 CD 84 1D 21 A0 C0 06 03 AF 22 05 20 FC 3E 80 E0 A6 3E 80 EA 00 C2 EA 10 C2 CD 83 26 CD 96 26 CD F3 7F 3E 25 E0 9E 3E 0B E0 E1 C9 E5 21 A0 C0 06 03 AF 22 05 20 FC F0 C3 47 04 21 A0 C0 CD 66 01 05 20 F7 E1 06 03 11 A2 C0 1A E6 F0 20 0A 1A E6 0F 20 0B 1D 05 20 F2 C9 1A E6 F0 CB 37 22 1A E6 0F 22 1D 05 20 F2 C9 F0 A6 A7 C0 3E 01 EA C6 C0 3E 05 E0 A6 C9 F0 A6 A7 C0 21 02 C8 11 0F 51 CD 04 28 CD 8A 17 21 00 C2 11 35 27 0E 0A CD 76 17 3E 10 21 66 C2 77 2E 76 77 21 0E C2 11 31 1E 06 0A 1A 22 22 13 D5 11 0E 00 19 D1 05 20 F3 F0 C4 FE 05 20 02 3E 09 3C 47 21 00 C2 11 10 00 AF 77 19 05 20 FB F0 C4 C6 0A EA E8 DF 3E 25 E0 9E 3E 1B E0 A6 3E 23 E0 E1 C9 1C 0F 1E 32 20 18 26 1D 28 2B 3E 0A CD 73 26 C9 F0 A6 FE 14 28 F4 A7 C0 21 0E C2 11 10 00 06 0A E5 35 20 15 2C 3A 77 7D E6 F0 F6 03 6F 7E EE 01 77 FE 50 28 23 FE 51 28 25 E1 19 05 20 E2 3E 0A CD 73 26 FA E9 DF A7 C0 CD 8A 17 F0 C4 FE 05 3E 26 28 02 3E 05 E0 E1 C9 2D 2D 36 67 18 DB 2D 2D 36 5D 18 D5 AF EA C6 C0 11 C0 C0 1A 6F 13 1A 67 B5 CA 3A 26 2B 7C 12 1B 7D 12 11 01 00 21 C2 C0 D5 CD 66 01 11 C4 C0 21 A5 99 CD 36 2A AF E0 A6 D1 21 A0 C0 CD 66 01 11 A2 C0 21 25 9A CD 3A 2A 3E 02 EA E0 DF C9 FA C6 C0 A7 C8 FA C5 C0 FE 04 28 B2 11 40 00 01 23 98 21 AC C0 A7 28 23 11 00 01 01 83 98 21 B1 C0 FE 01 28 16 11 00 03 01 E3 98 21 B6 C0 FE 02 28 09 11 00 12 01 43 99 21 BB C0 CD D9 25 C9 F0 81 A7 C8 3E 02 E0 E1 C9 F0 A6 A7 C0 3E 04 EA E8 DF F0 C5 A7 28 0A 3E 3F E0 A6 3E 1B E0 CC 18 37 3E 2F CD D7 1F 21 43 C8 11 3E 29 0E 07 CD 7D 1F 21 83 C9 11 76 29 0E 06 CD 7D 1F F0 C0 FE 37 20 14 21 A2 C0 7E 06 58 FE 20 30 0F 04 FE 15 30 0A 04 FE 10 30 05 3E 04 E0 E1 C9 78 E0 F3 3E 90 E0 A6 3E 34 E0 E1 C9 06 08 E5 1A 22 13 05 20 FA E1 D5 11 20 00 19 D1 0D 20 ED C9 F0 C0 FE 37 C0 F0 E1 A7 C0 F0 E3 FE 05 C0 21 AC C0 01 05 00 7E 11 40 00 A7 20 17 09 7E 11 00 01 A7 20 0F 09 7E 11 00 03 A7 20 07 09 11 00 12 7E A7 C8 36 00 F0 A9 47 04 C5 D5 21 A0 C0 CD 66 01 D1 C1 05 20 F3 C9 F5 3E 02 E0 E3 F1 21 02 C8 0E 12 11 20 00 E5 06 0A 22 05 20 FC E1 19 0D 20 F4 C9 21 C2 CB 11 16 00 0E 02 3E 2F 06 0A 22 05 20 FC 19 0D 20 F6 C9 21 00 C2 36 00 2C 36 18 2C 36 3F 2C FA 13 C2 77 E6 FC 4F F0 E4 A7 20 05 F0 C5 A7 28 1D 26 C3 F0 B0 6F 5E 23 7C FE C4 20 03 21 00 C3 7D E0 B0 F0 D3 A7 28 2A F6 80 E0 D3 18 24 26 03 F0 04 47 AF 05 28 0A 3C 3C 3C 3C FE 1C 28 F4 18 F3 57 F0 AE 5F 25 28 07 B2 B1 E6 FC B9 28 E1 7A E0 AE 7B EA 13 C2 CD 96 26 F0 9A E0 99 C9 FA C7 C0 A7 28 0C F0 81 E6 B0 FE 80 20 25 AF EA C7 C0 F0 A7 A7 20 29 F0 98 A7 20 24 F0 E3 A7 20 1F 3E 03 E0 A7 21 E5 FF 34 18 26 F0 80 E6 B0 FE 80 28 CD 21 E5 FF 36 00 F0 99 A7 28 07 3D E0 99 CD 83 26 C9 F0 98 FE 03 C8 F0 E3 A7 C0 F0 9A E0 99 21 01 C2 7E E0 A0 C6 08 77 CD 83 26 CD 73 25 A7 C8 F0 A0 21 01 C2 77 CD 83 26 3E 01 E0 98 EA C7 C0 F0 E5 A7 28 1B 4F F0 C0 FE 37 28 37 11 C0 C0 1A 6F 13 1A 67 06 00 0D 09 7C 12 7D 1B 12 AF E0 E5 FA 01 C2 FE 18 C0 FA 02 C2 FE 3F C0 21 FB FF 7E FE 01 20 0D CD F3 7F 3E 01 E0 E1 3E 02 EA F0 DF C9 34 C9 AF 0D 28 04 3C 27 18 F9 5F 16 00 21 A0 C0 CD 66 01 3E 01 EA CE C0 18 C2 F0 98 FE 02 C0 3E 02 EA F8 DF AF E0 A0 11 A3 C0 21 42 C8 06 10 0E 0A E5 2A FE 2F CA D8 21 0D 20 F7 E1 7C 12 13 7D 12 13 F0 A0 3C E0 A0 D5 11 20 00 19 D1 05 20 DF 3E 03 E0 98 3D E0 A6 F0 A0 A7 C8 47 21 9E FF F0 C0 FE 77 28 12 78 86 27 22 3E 00 8E 27 77 30 16 36 99 2B 36 99 18 0F 7E B7 90 28 3B 38 39 27 77 E6 F0 FE 90 28 31 78 0E 06 21 AC C0 06 00 FE 01 28 19 21 B1 C0 06 01 FE 02 28 10 21 B6 C0 06 02 FE 03 28 07 21 BB C0 06 04 0E 07 34 78 E0 DC 79 EA E0 DF C9 E1 18 90 AF E0 9E 18 CA F0 98 FE 03 C0 F0 A6 A7 C0 11 A3 C0 F0 9C CB 47 20 3C 1A A7 28 52 D6 30 67 13 1A 6F F0 9C FE 06 3E 8C 20 02 3E 2F 0E 0A 22 0D 20 FC 13 1A A7 20 E5 F0 9C 3C E0 9C FE 07 28 05 3E 0A E0 A6 C9 AF E0 9C 3E 0D E0 A6 3E 01 E0 E3 AF E0 98 C9 1A 67 D6 30 4F 13 1A 6F 06 0A 7E E5 61 77 E1 23 05 20 F7 13 1A A7 20 E8 18 C9 CD 07 20 18 DD F0 A6 A7 C0 F0 E3 FE 01 C0 11 A3 C0 1A 67 13 1A 6F D5 E5 01 E0 FF 09 D1 E5 06 0A 2A 12 13 05 20 FA E1 E5 D1 01 E0 FF 09 7C FE C7 20 EB D1 13 1A A7 20 DA 21 02 C8 3E 2F 06 0A 22 05 20 FC CD 93 22 3E 02 E0 E3 C9 21 A3 C0 AF 06 09 22 05 20 FC C9 F0 E3 FE 02 C0 21 22 9A 11 22 CA CD AC 24 C9 F0 E3 FE 03 C0 21 02 9A 11 02 CA CD AC 24 C9 F0 E3 FE 04 C0 21 E2 99 11 E2 C9 CD AC 24 C9 F0 E3 FE 05 C0 21 C2 99 11 C2 C9 CD AC 24 C9 F0 E3 FE 06 C0 21 A2 99 11 A2 C9 CD AC 24 C9 F0 E3 FE 07 C0 21 82 99 11 82 C9 CD AC 24 C9 F0 E3 FE 08 C0 21 62 99 11 62 C9 CD AC 24 F0 C5 A7 F0 E1 20 08 A7 C0 3E 01 EA F8 DF C9 FE 1A C0 F0 D4 A7 28 F2 3E 05 EA E0 DF C9 F0 E3 FE 09 C0 21 42 99 11 42 C9 CD AC 24 C9 F0 E3 FE 0A C0 21 22 99 11 22 C9 CD AC 24 C9 F0 E3 FE 0B C0 21 02 99 11 02 C9 CD AC 24 C9 F0 E3 FE 0C C0 21 E2 98 11 E2 C8 CD AC 24 C9 F0 E3 FE 0D C0 21 C2 98 11 C2 C8 CD AC 24 C9 F0 E3 FE 0E C0 21 A2 98 11 A2 C8 CD AC 24 C9 F0 E3 FE 0F C0 21 82 98 11 82 C8 CD AC 24 C9 F0 E3 FE 10 C0 21 62 98 11 62 C8 CD AC 24 CD 4B 24 C9 F0 E3 FE 11 C0 21 42 98 11 42 C8 CD AC 24 21 6D 9C CD 3B 24 3E 01 E0 E0 C9 F0 E3 FE 12 C0 21 22 98 11 22 C8 CD AC 24 21 6D 98 CD 3B 24 C9 F0 E3 FE 13 C0 EA C7 C0 21 02 98 11 02 C8 CD AC 24 AF E0 E3 F0 C5 A7 F0 E1 20 48 A7 C0 21 4E 99 11 9F FF 0E 02 F0 C0 FE 37 28 08 21 50 99 11 9E FF 0E 01 CD 3C 2A F0 C0 FE 37 28 23 F0 9E A7 20 1E 3E 64 E0 A6 3E 02 EA E8 DF F0 C5 A7 28 03 E0 D5 C9 F0 C3 FE 09 3E 05 20 02 3E 22 E0 E1 C9 CD 07 20 C9 FE 1A C0 F0 D4 A7 28 B2 AF E0 D4 C9 F0 E1 A7 C0 F0 C0 FE 37 C0 11 A2 C0 CD 36 2A C9 F0 E1 A7 C0 F0 C0 FE 37 C0 21 A9 FF 7E FE 14 C8 CD 9D 24 F0 9F 57 E6 F0 C0 7A E6 0F CB 37 57 F0 9E E6 F0 CB 37 B2 B8 D8 C8 34 CD 9D 24 E6 0F 4F 21 F1 98 71 26 9C 71 78 E6 F0 28 0D CB 37 4F 7D FE F0 28 05 21 F0 98 18 EA 3E 08 EA E0 DF CD E8 1A C9 7E 47 A7 C8 AF B7 3C 27 05 28 02 18 F8 47 C9 06 0A 1A 77 2C 1C 05 20 F9 F0 E3 3C E0 E3 C9 21 00 C2 7E FE 80 C8 2E 03 7E E0 A0 F0 81 47 CB 48 20 12 CB 40 28 37 7E E6 03 28 03 35 18 14 7E F6 03 77 18 0E 7E E6 03 FE 03 28 03 34 18 04 7E E6 FC 77 3E 03 EA E0 DF CD 83 26 CD 73 25 A7 28 0D AF EA E0 DF 21 03 C2 F0 A0 77 CD 83 26 21 02 C2 F0 81 47 F0 80 4F 7E E0 A0 CB 60 3E 17 20 0C CB 61 28 2D F0 AA 3D E0 AA C0 3E 09 E0 AA 7E C6 08 77 CD 83 26 3E 04 EA E0 DF CD 73 25 A7 C8 21 02 C2 AF EA E0 DF F0 A0 77 CD 83 26 3E 01 E0 AA C9 CB 68 3E 17 20 0C CB 69 28 F3 F0 AA 3D E0 AA C0 3E 09 E0 AA 7E D6 08 77 3E 04 EA E0 DF CD 83 26 CD 73 25 A7 C8 18 C7 21 10 C0 06 04 2A E0 B2 2A A7 28 17 E0 B3 E5 C5 CD E3 29 7C C6 30 67 7E FE 2F 20 0B C1 E1 2C 2C 05 20 E2 AF E0 9B C9 C1 E1 3E 01 E0 9B C9 F0 98 FE 01 C0 21 10 C0 06 04 2A E0 B2 2A A7 28 1D E0 B3 E5 C5 CD E3 29 E5 D1 C1 E1 F0 41 E6 03 20 FA 7E 12 7A C6 30 57 2A 12 2C 05 20 DC 3E 02 E0 98 21 00 C2 36 80 C9 FA C6 C0 FE 02 28 46 D5 7E B7 28 54 3D 22 7E 3C 27 77 E6 0F 02 0D 2A CB 37 E6 0F 28 01 02 C5 F0 C3 47 04 E5 CD 66 01 E1 05 20 F8 C1 23 23 E5 21 23 00 09 D1 CD 3A 2A D1 F0 C3 47 04 21 A0 C0 E5 CD 66 01 E1 05 20 F8 3E 02 EA C6 C0 C9 11 A2 C0 21 25 9A CD 3A 2A 3E 02 EA E0 DF AF EA C6 C0 C9 D1 3E 21 E0 A6 AF EA C6 C0 FA C5 C0 3C EA C5 C0 FE 05 C0 3E 04 E0 E1 C9 21 AC C0 06 1B AF 22 05 20 FC 21 A0 C0 06 03 22 05 20 FC C9 7E E6 F0 CB 37 12 7E E6 0F 1C 12 C9 3E 02 E0 8F AF E0 8E 3E C0 E0 8D 21 00 C2 CD 89 2A C9 3E 01 E0 8F 3E 10 E0 8E 3E C0 E0 8D 21 00 C2 CD 89 2A C9 3E 01 E0 8F 3E 20 E0 8E 3E C0 E0 8D 21 10 C2 CD 89 2A C9 06 20 3E 8E 11 20 00 77 19 05 20 FB C9 1A FE FF C8 22 13 18 F8 D9 00 18 3F 00 80 00 00 FF 00 80 8F 00 80 00 00 FF 00 70 37 1C 00 00 00 38 37 1C 00 00 00 40 34 20 00 00 00 40 1C 20 00 00 00 40 74 20 00 00 00 40 68 21 00 00 00 78 68 21 00 00 00 60 60 2A 80 00 00 60 72 2A 80 20 00 68 38 3E 80 00 00 60 60 36 80 00 00 60 72 36 80 20 00 68 38 32 80 00 00 60 60 2E 80 00 00 68 38 3C 80 00 00 60 60 3A 80 00 00 68 38 30 80 00 80 3F 40 44 00 00 80 3F 20 4A 00 00 80 3F 30 46 00 00 80 77 20 48 00 00 80 87 48 4C 00 00 80 87 58 4E 00 00 80 67 4D 50 00 00 80 67 5D 52 00 00 80 8F 88 54 00 00 80 8F 98 55 00 00 00 5F 57 2C 00 00 80 80 50 34 00 00 80 80 60 34 00 20 00 6F 57 58 00 00 80 80 55 34 00 00 80 80 5B 34 00 20 21 FF 9B 01 00 04 3E 2F 32 0B 78 B1 20 F8 C9 2A 12 13 0B 78 B1 20 F8 C9 CD C3 27 01 A0 00 CD A4 27 21 3F 32 11 00 83 01 00 0D CD A4 27 C9 21 5F 41 01 38 01 11 00 80 2A 12 13 12 13 0B 78 B1 20 F6 C9 CD C3 27 01 A0 0D CD A4 27 C9 01 00 10 11 00 80 CD A4 27 C9 21 00 98 06 12 E5 0E 14 1A 22 13 0D 20 FA E1 D5 11 20 00 19 D1 05 20 ED C9 06 0A E5 1A FE FF 28 0E 22 13 05 20 F6 E1 D5 11 20 00 19 D1 18 EA E1 3E 02 E0 E3 C9 F0 FF E0 A1 CB 87 E0 FF F0 44 FE 91 20 FA F0 40 E6 7F E0 40 F0 A1 E0 FF C9 2F 2F 11 12 1D 2F 2F 2F 2F 2F 29 29 29 2F 2F 2F 2F 1C 1D 0A 1B 1D 2F 2F 2F 29 29 29 29 29 2F 2F 2F 2F 2F 1D 18 2F 2F 2F 2F 2F 2F 29 29 2F 2F 2F 0C 18 17 1D 12 17 1E 0E 29 29 29 29 29 29 29 29 2F 2F 10 0A 16 0E 2F 2F 2F 2F 29 29 29 29 2F 2F 1C 12 17 10 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 04 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 0D 18 1E 0B 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 01 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 1D 1B 12 19 15 0E 2F 2F 2F 2F 2F 00 2F 26 2F 03 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 1D 0E 1D 1B 12 1C 2F 2F 2F 2F 2F 00 2F 26 2F 01 02 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 0D 1B 18 19 1C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 29 29 29 29 29 29 29 29 29 29 1D 11 12 1C 2F 1C 1D 0A 10 0E 2F 2F 2F 2F 2F 2F 2F 2F 00 2F FF 61 62 62 62 62 62 62 63 64 2F 2F 2F 2F 2F 2F 65 64 2F 10 0A 16 0E 2F 65 64 2F AD AD AD AD 2F 65 64 2F 18 1F 0E 1B 2F 65 64 2F AD AD AD AD 2F 65 66 69 69 69 69 69 69 6A 19 15 0E 0A 1C 0E 2F 2F 29 29 29 29 29 29 2F 2F 2F 1D 1B 22 2F 2F 2F 2F 2F 29 29 29 2F 2F 2F 2F 2F 2F 0A 10 0A 12 17 27 2F 2F 29 29 29 29 29 2F 3E 20 E0 00 F0 00 F0 00 F0 00 F0 00 2F E6 0F CB 37 47 3E 10 E0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 F0 00 2F E6 0F B0 4F F0 80 A9 A1 E0 81 79 E0 80 3E 30 E0 00 C9 F0 B2 D6 10 CB 3F CB 3F CB 3F 11 00 00 5F 21 00 98 06 20 19 05 20 FC F0 B3 D6 08 CB 3F CB 3F CB 3F 11 00 00 5F 19 7C E0 B5 7D E0 B4 C9 F0 B5 57 F0 B4 5F 06 04 CB 1A CB 1B 05 20 F9 7B D6 84 E6 FE 07 07 C6 08 E0 B2 F0 B4 E6 1F 17 17 17 C6 08 E0 B3 C9 F0 E0 A7 C8 0E 03 AF E0 E0 1A 47 CB 37 E6 0F 20 28 F0 E0 A7 3E 00 20 02 3E 2F 22 78 E6 0F 20 21 F0 E0 A7 3E 00 20 09 3E 01 B9 3E 00 28 02 3E 2F 22 1D 0D 20 D4 AF E0 E0 C9 F5 3E 01 E0 E0 F1 18 D9 F5 3E 01 E0 E0 F1 18 E7 3E C0 E0 46 3E 28 3D 20 FD C9 7C E0 96 7D E0 97 7E A7 28 1D FE 80 28 17 F0 96 67 F0 97 6F 11 10 00 19 F0 8F 3D E0 8F C8 18 E0 AF E0 95 18 E9 E0 95 06 07 11 86 FF 2A 12 13 05 20 FA F0 89 21 64 2B 07 5F 16 00 19 5E 23 56 1A 6F 13 1A 67 13 1A E0 90 13 1A E0 91 5E 23 56 23 F0 8C E0 94 7E FE FF 28 C7 FE FD 20 0E F0 8C EE 20 E0 94 23 7E 18 08 13 13 18 E4 FE FE 28 F8 E0 89 F0 87 47 1A 4F F0 8B CB 77 20 06 F0 90 80 89 18 0A 78 F5 F0 90 47 F1 90 99 DE 08 E0 93 F0 88 47 13 1A 13 4F F0 8B CB 6F 20 06 F0 91 80 89 18 0A 78 F5 F0 91 47 F1 90 99 DE 08 E0 92 E5 F0 8D 67 F0 8E 6F F0 95 A7 28 04 3E FF 18 02 F0 93 22 F0 92 22 F0 89 22 F0 94 47 F0 8B B0 47 F0 8A B0 22 7C E0 8D 7D E0 8E E1 C3 D8 2A 20 2C 24 2C 28 2C 2C 2C 30 2C 34 2C 38 2C 3C 2C 40 2C 44 2C 48 2C 4C 2C 50 2C 54 2C 58 2C 5C 2C 60 2C 64 2C 68 2C 6C 2C 70 2C 74 2C 78 2C 7C 2C 80 2C 84 2C 88 2C 8C 2C 90 2C 94 2C 98 2C 9C 2C A0 2C A4 2C A8 2C AC 2C B0 2C B4 2C B8 2C BC 2C C0 2C C4 2C C8 2C CC 2C C7 30 CC 2C D0 2C D4 2C D8 2C DC 2C E0 2C E4 2C EA 30 EE 30 E8 2C EC 2C F2 30 F6 30 F0 2C F4 2C F8 2C FC 2C 00 2D 04 2D FA 30 FE 30 04 2D 08 2D 08 2D 0C 2D 10 2D 14 2D 18 2D 1C 2D 20 2D 24 2D 28 2D 2C 2D 30 2D 34 2D 38 2D 3C 2D 40 2D 44 2D 48 2D 4C 2D 50 2D 54 2D 0A 31 0E 31 12 31 12 31 02 31 06 31 58 2D EF F0 68 2D EF F0 7A 2D EF F0 89 2D EF F0 9A 2D EF F0 AC 2D EF F0 BD 2D EF F0 CB 2D EF F0 DC 2D EF F0 EB 2D EF F0 FC 2D EF F0 0B 2E EF F0 1C 2E EF F0 2E 2E EF F0 40 2E EF F0 52 2E EF F0 64 2E EF F0 76 2E EF F0 86 2E EF F0 98 2E EF F0 A8 2E EF F0 B9 2E EF F0 CA 2E EF F0 DB 2E EF F0 0B 2F EF F0 1C 2F EF F0 EC 2E EF F0 FA 2E EF F0 2D 2F 00 E8 36 2F 00 E8 3F 2F 00 E8 48 2F 00 E8 51 2F 00 00 55 2F 00 00 59 2F 00 00 5D 2F 00 00 61 2F 00 00 65 2F 00 00 69 2F 00 00 6D 2F 00 00 71 2F 00 00 75 2F 00 00 79 2F F0 F8 84 2F F0 F8 8F 2F F0 F0 A3 2F F0 F0 B8 2F F8 F8 C1 2F F8 F8 CA 2F F8 F8 D1 2F F8 F8 D8 2F F0 F8 E3 2F F0 F8 EE 2F F0 F0 03 30 F0 F0 19 30 F8 F8 22 30 F8 F8 2B 30 F8 F8 32 30 F8 F8 39 30 F8 F8 40 30 F8 F8 47 30 F8 F8 4E 30 F8 F8 55 30 F8 F8 5C 30 F8 F8 67 30 F8 F8 6E 30 F8 F8 75 30 F8 F8 7C 30 F8 F8 83 30 F8 F8 8C 30 F8 F8 95 30 F8 F8 9E 30 F8 F8 A7 30 F8 F8 B0 30 F8 F8 B9 30 F8 F8 C0 30 F8 F8 46 31 F0 F0 5D 31 F8 F8 A9 31 FE FE FE FE FE FE FE FE 84 84 84 FE 84 FF A9 31 FE FE FE FE FE 84 FE FE FE 84 FE FE FE 84 84 FF A9 31 FE FE FE FE FE FE 84 FE 84 84 84 FE FF A9 31 FE FE FE FE 84 84 FE FE FE 84 FE FE FE 84 FF A9 31 FE FE FE FE FE FE FE FE 81 81 81 FE FE FE 81 FF A9 31 FE FE FE FE FE 81 81 FE FE 81 FE FE FE 81 FF A9 31 FE FE FE FE 81 FE FE FE 81 81 81 FF A9 31 FE FE FE FE FE 81 FE FE FE 81 FE FE 81 81 FF A9 31 FE FE FE FE FE FE FE FE 8A 8B 8B 8F FF A9 31 FE 80 FE FE FE 88 FE FE FE 88 FE FE FE 89 FF A9 31 FE FE FE FE FE FE FE FE 8A 8B 8B 8F FF A9 31 FE 80 FE FE FE 88 FE FE FE 88 FE FE FE 89 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE FE 83 83 FE FE 83 83 FF A9 31 FE FE FE FE FE FE FE FE 82 82 FE FE FE 82 82 FF A9 31 FE FE FE FE FE 82 FE FE 82 82 FE FE 82 FF A9 31 FE FE FE FE FE FE FE FE 82 82 FE FE FE 82 82 FF A9 31 FE FE FE FE FE 82 FE FE 82 82 FE FE 82 FF A9 31 FE FE FE FE FE FE FE FE FE 86 86 FE 86 86 FF A9 31 FE FE FE FE 86 FE FE FE 86 86 FE FE FE 86 FF A9 31 FE FE FE FE FE FE FE FE FE 86 86 FE 86 86 FF A9 31 FE FE FE FE 86 FE FE FE 86 86 FE FE FE 86 FF A9 31 FE FE FE FE FE 85 FE FE 85 85 85 FF A9 31 FE FE FE FE FE 85 FE FE 85 85 FE FE FE 85 FF A9 31 FE FE FE FE FE FE FE FE 85 85 85 FE FE 85 FF A9 31 FE FE FE FE FE 85 FE FE FE 85 85 FE FE 85 FF C9 31 0A 25 1D 22 19 0E FF C9 31 0B 25 1D 22 19 0E FF C9 31 0C 25 1D 22 19 0E FF C9 31 2F 18 0F 0F 2F 2F FF C9 31 00 FF C9 31 01 FF C9 31 02 FF C9 31 03 FF C9 31 04 FF C9 31 05 FF C9 31 06 FF C9 31 07 FF C9 31 08 FF C9 31 09 FF D9 31 2F 01 2F 11 20 21 30 31 FF D9 31 2F 03 12 13 22 23 32 33 FF A9 31 2F 05 FD 05 2F 2F 15 04 17 24 25 26 27 34 35 36 2F FF A9 31 08 37 FD 37 FD 08 18 19 14 1B 28 29 2A 2B 60 70 36 2F FF D9 31 B9 FD B9 BA FD BA FF D9 31 82 FD 82 83 FD 83 FF D9 31 09 0A 3A 3B FF D9 31 0B 40 7C 6F FF D9 31 2F 0F 2F 1F 5F 2C 2F 3F FF D9 31 6C 3C 4B 4C 5B 5C 6B 2F FF A9 31 2F 4D FD 4D 2F 2F 5D 5E 4E 5F 6D 6E 2F 2F 7D FD 7D 2F FF A9 31 08 77 FD 77 FD 08 18 78 43 53 7A 7B 50 2F 2F 02 FD 7D 2F FF D9 31 B9 FD B9 BA FD BA FF D9 31 82 FD 82 83 FD 83 FF D9 31 09 0A 3A 3B FF D9 31 0B 40 7C 6F FF D9 31 DC DD E0 E1 FF D9 31 DE DF E0 E1 FF D9 31 DE E2 E0 E4 FF D9 31 DC EE E0 E3 FF D9 31 E5 E6 E7 E8 FF D9 31 FD E6 FD E5 FD E8 FD E7 FF D9 31 E9 EA EB EC FF D9 31 ED EA EB EC FF D9 31 F2 F4 F3 BF FF D9 31 F4 F2 BF F3 FF D9 31 C2 FD C2 C3 FD C3 FF D9 31 C4 FD C4 C5 FD C5 FF D9 31 DC FD DC EF FD EF FF D9 31 F0 FD F0 F1 FD F1 FF D9 31 DC FD F0 F1 FD EF FF D9 31 F0 FD DC EF FD F1 FF D9 31 BD BE BB BC FF D9 31 B9 BA DA DB FF CB 30 E0 F0 F5 31 C0 C1 C5 C6 CC CD 75 76 A4 A5 A6 A7 54 55 56 57 44 45 46 47 A0 A1 A2 A3 9C 9D 9E 9F FF 16 31 F8 E8 1C 31 F0 E8 25 31 00 00 2B 31 00 00 31 31 00 00 3A 31 00 00 9D 31 00 00 A3 31 00 00 64 31 D8 F8 7C 31 E8 F8 8E 31 F0 F8 2D 32 63 64 65 FF 2D 32 63 64 65 66 67 68 FF 2D 32 41 41 41 FF 2D 32 42 42 42 FF 2D 32 52 52 52 62 62 62 FF 2D 32 51 51 51 61 61 61 71 71 71 FF A9 31 2F 2F 2F 2F 2F 2F 2F 2F 63 64 FD 64 FD 63 66 67 FD 67 FD 66 FF D9 31 2F 2F 63 64 FF D9 31 00 FD 00 10 FD 10 4F FD 4F 80 FD 80 80 FD 80 81 FD 81 97 FD 97 FF D9 31 98 FD 98 99 FD 99 80 FD 80 9A FD 9A 9B FD 9B FF D9 31 A8 FD A8 A9 FD A9 AA FD AA AB FD AB FF D9 31 41 2F 2F FF D9 31 52 2F 62 FF 00 00 00 08 00 10 00 18 08 00 08 08 08 10 08 18 10 00 10 08 10 10 10 18 18 00 18 08 18 10 18 18 00 00 00 08 00 10 00 18 00 20 00 28 00 30 00 38 00 00 00 08 08 00 08 08 10 00 10 08 18 00 18 08 20 00 20 08 28 00 28 08 30 00 30 08 00 08 00 10 08 08 08 10 10 00 10 08 10 10 10 18 18 00 18 08 18 10 18 18 20 00 20 08 20 10 20 18 28 00 28 08 28 10 28 18 30 00 30 08 30 10 30 18 38 00 38 08 38 10 38 18 00 00 00 08 00 10 08 00 08 08 08 10 10 00 10 08 10 10 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7C 7C 78 79 78 7B FF FF FF FF FF FF FF FF FF FF 00 00 00 FF 00 00 FF FF FF FF FF FF FF FF FF FF 3F 3F 1F 9F 1F DF 78 7B 78 79 7C 7C 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 00 FF 00 00 FF FF FF FF FF FF FF FF FF FF 1F DF 1F 9F 3F 3F FF FF FF FF FF FF FF FF FF FF 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 78 7A 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F FF FF FF FF FF FF FF F8 F8 F0 F2 E1 F5 E3 F2 E6 FF FF FF FF FF FF FF 00 00 00 00 FF FF FF 00 00 FF FF FF FF FF FF FF 1F 1F 0F 4F 87 AF C7 4F 67 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 F2 E6 F5 E3 F2 E1 F8 F0 FF F8 FF FF FF FF FF FF 00 00 FF FF 00 FF 00 00 FF 00 FF FF FF FF FF FF 4F 67 AF C7 4F 87 1F 0F FF 1F FF FF FF FF FF FF 78 7B 78 79 7C 7C 7F 7F 7F 7F 7C 7C 78 79 78 7B 1F DF 1F 9F 3F 3F FF FF FF FF 3F 3F 1F 9F 1F DF 00 00 00 FF 00 00 FF FF FF FF 00 00 00 FF 00 00 00 00 00 7F 00 00 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 78 7A 78 7A 78 7A 78 7A 78 7A 00 02 00 7A 00 7A 1F 5F 1F 5F 1F 5F 1F 5F 1F 5F 00 40 00 5F 00 5F 00 00 00 FF 00 00 00 FF 00 FF 00 00 00 FF 00 00 00 00 00 00 3F 3F 3F 3F 30 30 30 30 33 32 33 30 00 00 00 00 FF FF FF FF 00 00 00 00 FF 02 FF 20 00 00 00 00 FC FC FC FC 0C 0C 0C 0C CC 0C CC 0C 33 30 33 30 33 30 33 30 33 30 33 30 33 32 33 30 CC 0C CC 4C CC 0C CC 0C CC 0C CC 8C CC 0C CC 0C 33 30 33 30 30 30 30 30 3F 3F 3F 3F 00 00 00 00 FF 04 FF 40 00 00 00 00 FF FF FF FF 00 00 00 00 CC 0C CC 4C 0C 0C 0C 0C FC FC FC FC 00 00 00 00 00 00 FF FF FF 00 FF 02 FF 20 FF 00 FF 04 FF 00 FF 00 FF 02 FF 40 FF 00 FF 08 FF 01 FF 43 FF 07 FF 04 FF 40 FF 02 FF 00 FF 00 FF FF FF FF 00 00 FF 00 FF 40 FF 02 FF 00 FF 10 FF 80 FF C2 FF E0 FE 06 FE 46 FE 06 FE 06 FE 16 FE 86 FE 06 FE 06 7F 64 7F 60 7F 62 7F 60 7F 60 7F 68 7F 62 7F 60 FF 02 FF 40 FF 00 FF 00 FF 08 FF 80 FF 1F F0 10 FF 02 FF 20 FF 00 FF 00 FF 04 FF 00 FF FF 00 00 FF 07 FF 13 FF 01 FF 00 FF 40 FF 00 FF FF 08 08 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 00 00 FF E0 FF C8 FF 80 FF 00 FF 02 FF 00 FF FF 08 08 FF 00 FF 02 FF 40 FF 00 FF 02 FF 00 FF F8 0F 08 F0 10 F0 10 F0 10 F0 50 F0 10 F0 10 F0 10 F0 10 0F 08 0F 0A 0F 08 0F 08 0F 08 0F 08 0F 09 0F 08 00 00 00 7F 00 00 7F 7F 7F 7F 7C 7C 78 79 78 7B 00 00 00 FF 00 00 FF FF FF FF 3F 3F 1F 9F 1F DF 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 00 7F 00 00 00 00 00 00 00 00 AA AA 00 00 00 00 00 00 00 00 00 00 00 00 0F 0F 1F 1F 38 38 33 30 36 30 34 30 00 00 00 00 FF FF FF FF 00 00 FF 00 00 00 00 00 00 00 00 00 F0 F0 F8 F8 1C 1C CC 0C 6C 0C 2C 0C 34 30 34 30 34 30 34 30 34 30 34 30 34 30 34 30 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 2C 0C 34 30 36 30 33 30 38 38 1F 1F 0F 0F 00 00 00 00 00 7B 00 79 00 7C 00 7F 00 7F 00 00 00 7F 00 00 00 DF 00 9F 00 3F 00 FF 00 FF 00 00 00 FF 00 00 00 00 00 00 FF 00 00 00 FF FF FF FF 00 00 00 00 2C 0C 6C 0C CC 0C 1C 1C F8 F8 F0 F0 00 00 00 00 08 08 FF FF FF 02 FF 00 FF 20 FF 00 FF 02 FF 00 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 08 08 FF 07 FF 13 FF 01 FF 00 FF 40 FF 00 FF FF 00 00 FF E0 FF C8 FF 80 FF 00 FF 02 FF 00 FF FF 00 00 08 08 08 08 08 08 08 08 08 08 08 08 08 08 08 08 FF 00 FF 02 FF 00 FF 20 FF 02 FF 00 FF FF 08 08 F0 10 FF 1F F0 1F F0 1F F0 1F F0 1F FF 5F F0 10 00 00 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 00 00 08 08 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 08 08 0F 08 FF F8 0F F8 0F F8 0F F8 0F F8 FF FA 0F 08 FF 07 FF 43 FF 01 FF 00 FF 00 FF 80 FF 1F F0 10 FF E0 FF C2 FF 80 FF 00 FF 22 FF 00 FF F8 0F 08 00 00 00 00 00 00 3C 00 3C 00 00 00 00 00 00 00 00 00 3C 00 4E 00 4E 00 7E 00 4E 00 4E 00 00 00 00 00 7C 00 66 00 7C 00 66 00 66 00 7C 00 00 00 00 00 3C 00 66 00 60 00 60 00 66 00 3C 00 00 00 DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF 00 00 7E 00 18 00 18 00 18 00 18 00 18 00 00 00 00 00 66 00 66 00 3C 00 18 00 18 00 18 00 00 00 FF FF F7 89 DD A3 FF 81 B7 C9 FD 83 D7 A9 FF 81 FF FF FF 81 FF BD E7 A5 E7 A5 FF BD FF 81 FF FF FF FF FF 81 FF 81 FF 99 FF 99 FF 81 FF 81 FF FF FF FF 81 81 BD BD BD BD BD BD BD BD 81 81 FF FF FF FF 81 FF 81 FF 81 FF 81 FF 81 FF 81 FF FF FF FF FF FF 81 C3 81 DF 85 DF 85 FF BD FF 81 FF FF FF FF 81 FF BD FF A5 E7 A5 E7 BD FF 81 FF FF FF FF FF 81 81 BD 83 BD 83 BD 83 BD 83 81 FF FF FF ED 93 BF C1 F5 8B DF A1 FD 83 AF D1 FB 85 DF A1 FD 83 EF 91 BB C5 EF 91 BD C3 F7 89 DF A1 FF FF FF FF DB A4 FF 80 B5 CA FF 80 DD A2 F7 88 FF FF FF FF 57 A8 FD 02 DF 20 7B 84 EE 11 BB 44 FF FF FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 77 89 DF 21 FB 05 AF 51 FD 03 D7 29 FF FF 00 00 3C 00 66 00 66 00 66 00 66 00 3C 00 00 00 00 00 18 00 38 00 18 00 18 00 18 00 3C 00 00 00 00 00 3C 00 4E 00 0E 00 3C 00 70 00 7E 00 00 00 00 00 7C 00 0E 00 3C 00 0E 00 0E 00 7C 00 00 00 00 00 3C 00 6C 00 4C 00 4E 00 7E 00 0C 00 00 00 00 00 7C 00 60 00 7C 00 0E 00 4E 00 3C 00 00 00 00 00 3C 00 60 00 7C 00 66 00 66 00 3C 00 00 00 00 00 7E 00 06 00 0C 00 18 00 38 00 38 00 00 00 00 00 3C 00 4E 00 3C 00 4E 00 4E 00 3C 00 00 00 00 00 3C 00 4E 00 4E 00 3E 00 0E 00 3C 00 00 00 00 00 7C 00 66 00 66 00 7C 00 60 00 60 00 00 00 00 00 7E 00 60 00 7C 00 60 00 60 00 7E 00 00 00 00 00 7E 00 60 00 60 00 7C 00 60 00 60 00 00 00 00 00 3C 00 66 00 66 00 66 00 66 00 3C 00 00 00 00 00 3C 00 66 00 60 00 6E 00 66 00 3E 00 00 00 00 00 46 00 6E 00 7E 00 56 00 46 00 46 00 00 00 00 00 46 00 46 00 46 00 46 00 4E 00 3C 00 00 00 00 00 3C 00 60 00 3C 00 0E 00 4E 00 3C 00 00 00 00 00 3C 00 18 00 18 00 18 00 18 00 3C 00 00 00 00 00 60 00 60 00 60 00 60 00 60 00 7E 00 00 00 00 00 46 00 46 00 46 00 46 00 2C 00 18 00 00 00 00 00 7C 00 66 00 66 00 7C 00 68 00 66 00 00 00 00 00 46 00 66 00 76 00 5E 00 4E 00 46 00 00 00 00 00 7C 00 4E 00 4E 00 4E 00 4E 00 7C 00 00 00 FF FF FF 00 FF 00 FF 00 FF 10 FF 80 FF 02 FF 00 00 00 FF FF FF FF FF 00 FF 02 FF 20 FF FF 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 FF FF 00 FF 00 FF 00 FF 00 FF FF FF 80 80 80 80 FF FF FF 00 FF 02 FF 20 FF 00 FF 00 FF 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 3F 2E 7F 63 BF F8 37 FF 01 01 01 01 01 01 01 01 01 01 01 01 01 01 83 83 01 01 01 01 01 01 01 01 01 01 01 01 01 01 FF FF FF FF 01 01 01 01 01 01 01 01 01 01 01 01 83 83 FF FF D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 FF FF D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 D9 87 00 38 00 38 00 38 00 38 00 38 00 38 00 38 00 38 7C 00 7C 00 7C 00 7C 00 7C 00 7C 00 7F 00 FF 00 00 00 00 00 08 00 08 00 08 00 08 00 1C 00 1C 00 00 00 00 0E 01 1D 1E 06 2A 2A 27 27 10 13 0C 0D 00 00 C0 C0 20 20 10 D0 D0 10 F0 30 C8 E8 08 E8 04 07 03 03 0C 0C 10 10 35 20 2A 20 3F 3F 0C 0C 28 E8 D8 C0 40 40 20 20 50 10 B0 10 F0 F0 C0 C0 00 E0 01 71 32 42 34 35 55 54 4F 4E 21 27 18 1B 00 00 80 80 40 40 20 A0 A0 20 E0 60 90 F0 08 C8 B8 B8 84 84 84 84 FC FC 92 92 92 92 6C 6C EE EE 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 B4 B4 64 64 3C 3C 2E 2E 27 27 10 10 6C 7C CF B3 03 03 03 03 03 02 07 06 09 09 16 17 12 11 0E 0F 08 09 08 08 0F 0F 08 08 09 09 0A 0A 06 06 0E 0E 03 03 03 03 03 02 1F 1E 21 21 4A 55 4A 75 0A 35 0A 15 08 08 0F 0F 08 08 09 09 0A 0A 06 06 0E 0E 00 00 66 00 6C 00 78 00 78 00 6C 00 66 00 00 00 00 00 46 00 2C 00 18 00 38 00 64 00 42 00 00 00 FD FD FD FD FD FD FD FD FD FD FD FD FD FD FD FD F8 00 E0 00 C0 00 80 00 80 00 00 00 00 00 00 00 7F 00 1F 00 0F 00 07 00 07 00 03 00 03 00 03 00 00 00 80 00 80 00 C0 00 E0 00 F8 00 FF 00 FF 00 03 00 07 00 07 00 0F 00 1F 00 7F 00 FF 00 FF 00 FF FF FF FF 00 FF FF FF 00 FF FF 00 00 FF FF 00 FF 00 FF 00 FF 01 FE 02 FE 02 FC 04 FC 04 FC 04 FF 02 FF 01 FF 01 01 01 FF 01 01 01 FF 01 01 01 02 02 02 02 03 03 04 05 08 09 11 12 21 26 43 4C 00 00 01 01 02 02 04 04 08 09 10 13 20 27 20 2F 87 98 06 39 0E 71 1E E1 3C C3 3C C3 78 87 78 87 40 4F 40 4F 80 9F 80 9F 80 9F 80 9F 80 9F 80 9F F8 07 F0 0F F0 0F F0 0F F0 0F F0 0F F0 0F F8 07 40 5F 40 4F 20 2F 20 27 10 11 0F 0F 04 04 07 07 78 87 7C 83 3C C3 1E E1 0F F0 FF FF FF 00 FF FF FF 00 FF 00 FF 00 00 00 FF 00 00 00 FF 00 00 00 02 00 02 00 02 00 02 00 02 00 02 00 02 00 02 00 10 00 38 00 7C 00 FE 00 FE 00 FE 00 7C 00 00 00 02 03 01 01 02 02 04 04 0D 08 0A 08 0F 0F 03 03 28 E8 F0 D0 30 30 08 08 54 04 AC 04 FC FC 30 30 00 00 03 03 03 03 03 02 07 06 09 09 08 08 0B 0B 00 00 C0 C0 C4 C4 E8 68 90 F0 A8 F8 48 78 F8 B8 00 00 07 07 07 07 07 04 07 04 0B 0B 10 10 17 17 00 00 80 80 80 80 E0 E0 90 F0 A8 F8 48 78 B8 B8 08 08 0F 0F 08 08 0F 0F 09 09 09 09 06 06 0E 0E E4 E4 22 22 20 20 E0 E0 20 20 20 20 C0 C0 E0 E0 18 18 98 98 98 98 F8 F8 9C 98 3C 3C 3C 3C 7E 7E 7F 00 FE FE 7E 7E FE DA 7E 5A 7E 7E FC FC F8 F8 FE 0E FE FE 7E 7E FE DA 7E 5A 7E 7E FC FC F8 F8 80 80 83 83 83 83 C3 02 EF 2E 97 97 47 44 24 24 00 00 C0 C0 C0 C0 C0 40 E0 60 F8 F8 E4 24 34 34 17 14 17 14 17 14 1C 1F 17 17 0F 0F 1E 1E 00 00 F4 24 F8 28 E8 28 38 F8 E8 E8 90 90 70 70 78 78 03 03 03 03 03 02 0F 0E 11 11 37 37 71 52 7D 4E C0 C0 C0 C0 C0 40 C0 40 A0 A0 10 10 FF FF CF 33 7F 40 3F 3F 08 08 0F 0F 09 09 09 09 06 06 0E 0E FC FC 20 20 20 20 E0 E0 20 20 20 20 C0 C0 E0 E0 03 03 03 03 03 02 07 06 09 09 33 33 77 54 73 4C 18 18 D8 D8 D8 D8 F8 78 DC 58 BC BC 3C 3C 7E 7E 09 0E 07 07 08 0F 08 0F 09 0F 0A 0E 06 06 0E 0E 00 00 03 03 03 03 03 02 FF 7E C9 3F 78 7F 09 0F 04 04 07 07 B8 BF C0 FF FF FF 00 00 00 00 00 00 00 00 78 78 78 78 7B 48 60 5F B6 B0 84 84 B8 B8 84 84 84 84 84 84 FA FA 92 92 9E 9E 67 67 E0 E0 00 00 00 00 78 78 78 78 78 48 40 7E B4 B0 84 84 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 30 31 31 31 31 31 32 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 44 1C 0C 18 1B 0E 45 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 67 46 46 46 46 46 68 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2F 2F 2F 2F 2F 00 2F 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 43 34 34 34 34 34 34 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 30 31 31 31 31 31 32 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 0E 1F 0E 15 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 2F 2F 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 40 42 42 42 42 42 41 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 12 17 0E 1C 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 2F 2F 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 33 34 34 34 34 34 35 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 38 39 39 39 39 3A 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3B 2F 2F 2F 2F 3C 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 3B 2F 2F 2F 2F 3C 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3D 3E 3E 3E 3E 3F 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 30 31 31 31 31 31 32 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 15 0E 1F 0E 15 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 36 2F 2F 2F 2F 2F 37 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 40 42 42 42 42 42 41 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 11 12 10 11 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 36 2F 2F 2F 2F 2F 37 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 33 34 34 34 34 34 35 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 8E 8E 8E 8E 8E 8E 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 30 31 31 31 31 31 32 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 36 15 12 17 0E 1C 37 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 36 2F 2F 02 05 2F 37 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 33 34 34 34 34 34 35 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 38 39 39 39 39 3A 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3B 2F 2F 2F 2F 3C 2A 7B 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7B 2B 3B 2F 2F 2F 2F 3C 2A 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 2B 3B 2F 2F 2F 2F 3C 2A 7D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 7D 2B 3D 3E 3E 3E 3E 3F 00 3C 66 66 66 66 3C 00 00 18 38 18 18 18 3C 00 00 3C 4E 0E 3C 70 7E 00 00 7C 0E 3C 0E 0E 7C 00 00 3C 6C 4C 4E 7E 0C 00 00 7C 60 7C 0E 4E 3C 00 00 3C 60 7C 66 66 3C 00 00 7E 06 0C 18 38 38 00 00 3C 4E 3C 4E 4E 3C 00 00 3C 4E 4E 3E 0E 3C 00 00 3C 4E 4E 7E 4E 4E 00 00 7C 66 7C 66 66 7C 00 00 3C 66 60 60 66 3C 00 00 7C 4E 4E 4E 4E 7C 00 00 7E 60 7C 60 60 7E 00 00 7E 60 60 7C 60 60 00 00 3C 66 60 6E 66 3E 00 00 46 46 7E 46 46 46 00 00 3C 18 18 18 18 3C 00 00 1E 0C 0C 6C 6C 38 00 00 66 6C 78 78 6C 66 00 00 60 60 60 60 60 7E 00 00 46 6E 7E 56 46 46 00 00 46 66 76 5E 4E 46 00 00 3C 66 66 66 66 3C 00 00 7C 66 66 7C 60 60 00 00 3C 62 62 6A 64 3A 00 00 7C 66 66 7C 68 66 00 00 3C 60 3C 0E 4E 3C 00 00 7E 18 18 18 18 18 00 00 46 46 46 46 4E 3C 00 00 46 46 46 46 2C 18 00 00 46 46 56 7E 6E 46 00 00 46 2C 18 38 64 42 00 00 66 66 3C 18 18 18 00 00 7E 0E 1C 38 70 7E 00 00 00 00 00 00 60 60 00 00 00 00 3C 3C 00 00 00 00 00 22 14 08 14 22 00 00 00 36 36 5F 49 5F 41 7F 41 3E 22 1C 14 08 08 FF FF FF 81 C1 BF C1 BF C1 BF C1 BF 81 FF FF FF AA AA 00 00 00 00 00 00 00 00 00 00 00 00 00 00 FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F FF 00 FF 40 FF 02 FF 00 FF 10 FF 80 FF 02 FF 00 F0 10 FF 1F FF 00 FF 40 FF 00 FF 02 FF 40 FF 00 0F 08 FF F8 FF 00 FF 02 FF 00 FF 40 FF 02 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 18 18 38 38 18 18 18 18 18 18 3C 3C 00 00 00 00 3C 3C 4E 4E 4E 4E 3E 3E 0E 0E 3C 3C 00 00 00 00 3C 3C 4E 4E 3C 3C 4E 4E 4E 4E 3C 3C 00 00 38 38 44 44 BA BA A2 A2 BA BA 44 44 38 38 C6 C6 E6 E6 E6 E6 D6 D6 D6 D6 CE CE CE CE C6 C6 C0 C0 C0 C0 00 00 DB DB DD DD D9 D9 D9 D9 D9 D9 00 00 30 30 78 78 33 33 B6 B6 B7 B7 B6 B6 B3 B3 00 00 00 00 00 00 CD CD 6E 6E EC EC 0C 0C EC EC 01 01 01 01 01 01 8F 8F D9 D9 D9 D9 D9 D9 CF CF 80 80 80 80 80 80 9E 9E B3 B3 B3 B3 B3 B3 9E 9E FF 00 FF 00 FF 00 EF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 E7 00 E7 00 FF 00 FF 00 FF 00 00 FF FF FF 00 FF 00 FF FF 00 00 FF FF 00 FF 00 00 FF FF FF 01 FF 02 FE FE 02 04 FC FC 04 FC 04 00 FF FF FF 80 FF 40 7F FF 40 E0 3F FF 20 BF 60 FF 00 FF 00 FF 01 FE 02 FE 02 FC 04 FC 04 FC 04 FF 00 FF 00 FF 80 7F 40 FF 40 FF 20 FF 20 BF 60 FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 00 FF 02 FF 01 FF 01 FF 01 FF 01 FF 01 FF 01 FF 01 7F C0 FF 80 FF 80 FF 80 FF 80 FF 80 FF 80 FF 80 FE 02 FE 02 FF 03 FC 05 F8 09 F1 12 E1 26 C3 4C 7F C0 7F C0 FF C0 BF 60 9F 70 AF 58 27 DC 33 CE FF 00 FF 01 FE 02 FC 04 F8 09 F0 13 E0 27 E0 2F 87 98 06 39 0E 71 1E E1 3C C3 3C C3 78 87 78 87 35 CB 32 CD 3A C5 79 86 78 87 78 87 7C 83 7C 83 FF 00 FF 80 7F C0 3F E0 9F 70 4F B8 67 9C 37 CC C0 4F C0 4F 80 9F 80 9F 80 9F 80 9F 80 9F 80 9F F8 07 F0 0F F0 0F F0 0F F0 0F F0 0F F0 0F F8 07 7C 83 7E 81 7E 81 3E C1 3F C0 1F E0 1F E0 1F E0 33 CE 1B E6 09 F7 0D F3 0D F3 0D F3 0D F3 09 F7 C0 5F C0 4F E0 2F E0 27 F0 11 BF 4F 0C F4 07 FF 78 87 7C 83 3C C3 1E E1 0F F0 FF FF FF 00 FF FF 0F F0 0F F0 0E F1 0E F1 06 F9 FF FF C5 3F FF FF 1B E6 13 EE 37 CC 27 DC 4F B8 FC F3 FC A3 E0 FF FE 02 FE 02 BF 43 1C E5 B8 49 B1 52 A1 66 43 CC FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 EF 10 C7 38 FF 00 FB 04 FB 04 FB 04 FB 04 F1 0E F1 0E F1 0E 83 7C 01 FE 01 FE 01 FE 83 7C FF 00 83 7C 83 7C F1 0E E0 1F E0 1F E0 1F E0 1F E0 1F 80 7F 80 7F F7 08 EB 14 F7 08 F7 08 E3 1C E3 1C 63 9C 01 FE 00 00 60 60 70 70 78 78 78 78 70 70 60 60 00 00 00 00 30 30 70 70 30 30 30 30 30 30 78 78 00 00 E0 E0 F0 E0 FB E0 FC E0 FC E1 FC E1 FC E1 FC E1 00 00 00 00 FF 00 00 00 00 FF 00 00 00 00 00 00 07 07 0F 07 DF 07 3F 07 3F 87 3F 87 3F 87 3F 87 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 FC E1 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 3F 87 FC E1 FC E1 FC E1 FC E1 FC E0 FF E7 FF EF E0 FF 00 00 00 00 00 00 00 FF 00 00 FF FF FF FF 00 FF 3F 87 3F 87 3F 87 3F 87 3F 07 FF E7 FF F7 07 FF F8 00 E0 00 C0 00 80 00 80 00 00 00 00 00 00 00 7F 00 1F 00 0F 00 07 00 07 00 03 00 03 00 03 00 00 00 80 00 80 00 C0 00 E0 00 F8 00 FF 00 FF 00 03 00 07 00 07 00 0F 00 1F 00 7F 00 FF 00 FF 00 01 01 01 01 81 81 C1 C1 C1 C1 E1 E1 F1 F1 F9 F9 FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE FE 7E 7E 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 3F 3F 9F 9F 8F 8F CF CF E7 E7 F3 F3 F7 F7 E0 E0 E0 E0 E0 E0 E0 E0 E0 E0 C0 C0 C0 C0 80 80 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 F0 00 00 7C 7C 47 47 41 41 40 40 40 40 40 40 7F 40 00 00 01 01 01 01 81 81 C1 C1 41 41 61 61 E1 61 00 00 FE FE 06 06 06 06 06 06 06 06 06 06 FE 06 00 00 1B 1B 32 32 59 59 4C 4C 8C 8C 86 86 FF 83 00 00 FF FF 01 01 01 01 81 81 41 41 41 41 3F 21 00 00 BE BE 88 88 88 88 88 88 88 88 80 80 80 80 00 00 88 88 D8 D8 A8 A8 88 88 88 88 00 00 00 00 7F 40 7F 40 7F 40 7F 40 7F 40 7F 40 7F 40 47 7F E1 61 E1 61 E1 61 E1 61 E1 61 C1 C1 C1 C1 81 81 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 06 FE FF 83 FF 81 7F 40 7F 40 7F 40 3F 20 3F 20 10 1F 1F 11 9F 91 CF C9 C7 C5 E3 63 F3 33 F9 19 08 F8 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 80 5F 7F 78 78 60 60 50 70 50 70 48 78 44 7C 7E 7E 01 01 01 01 01 01 01 01 01 01 01 01 01 01 01 01 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE 06 FE FE FE 08 0F 44 47 64 67 72 73 51 71 59 79 4C 7C 7E 7E 0C FC 06 FE 03 FF 01 FF 01 FF 00 FF 80 FF 7F 7F 00 00 00 00 00 00 80 80 80 80 C0 C0 C0 C0 E0 E0 7E 7E 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 7F 00 00 03 03 02 02 02 02 02 02 02 02 02 02 03 02 00 00 FB FB 0A 0A 12 12 22 22 22 22 42 42 C3 42 00 00 FD FD 0D 0D 0C 0C 0C 0C 0C 0C 0C 0C FC 0C 00 00 FC FC 0C 0C 8C 8C 4C 4C 4C 4C 2C 2C 3C 2C 03 02 03 02 03 03 03 03 02 02 00 00 00 00 00 00 83 82 83 82 03 02 03 02 03 02 03 02 03 02 02 03 FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C 0C FC 1C 1C 1C 1C 0C 0C 0C 0C 04 04 00 00 00 00 00 00 02 03 02 03 02 03 02 03 02 03 02 03 02 03 03 03 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC 0C FC FC FC 03 03 03 03 03 03 03 03 03 03 03 03 03 03 03 03 FC FC FC FC FC FC FC FC FC FC FC FC FC FC FC FC FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 01 01 03 03 07 07 0F 0F 1F 1F 3F 3F 7F 7F 00 00 FF FF 83 83 83 83 83 83 83 83 83 83 FF 83 00 00 7F 7F 20 20 10 10 08 08 04 04 02 02 01 01 00 00 F3 F3 32 32 32 32 32 32 32 32 32 32 F3 32 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 83 FF 00 00 00 00 01 01 03 03 07 07 0F 0B 1F 13 23 3F F3 B2 73 72 33 33 13 13 02 02 00 00 00 00 00 00 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF 83 FF FF FF 43 7F 23 3F 13 1F 0B 0F 07 07 03 03 01 01 00 00 00 00 00 00 00 00 00 00 00 00 10 10 30 30 70 70 00 00 78 78 9C 9C 1C 1C 78 78 E0 E0 FC FC 00 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 1B 1B 1B 1B 09 09 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 60 60 60 60 20 20 00 00 1B 1B 1B 1B 09 09 00 00 00 00 60 60 60 60 00 00 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 9B 1D 16 2F 0A 17 0D 2F 33 01 09 08 07 2F 0E 15 18 1B 10 9C 2F 1D 0E 1D 1B 12 1C 2F 15 12 0C 0E 17 1C 0E 0D 2F 1D 18 2F 2F 2F 2F 2F 0B 1E 15 15 0E 1D 25 19 1B 18 18 0F 2F 2F 2F 2F 2F 2F 2F 2F 1C 18 0F 1D 20 0A 1B 0E 2F 0A 17 0D 2F 2F 2F 2F 2F 2F 2F 1C 1E 0B 25 15 12 0C 0E 17 1C 0E 0D 2F 1D 18 2F 2F 2F 2F 2F 2F 2F 2F 17 12 17 1D 0E 17 0D 18 24 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 33 01 09 08 09 2F 0B 1E 15 15 0E 1D 25 19 1B 18 18 0F 2F 2F 2F 2F 2F 2F 2F 1C 18 0F 1D 20 0A 1B 0E 24 2F 2F 2F 2F 2F 2F 2F 2F 33 30 31 32 31 2F 34 35 36 37 38 39 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 0A 15 15 2F 1B 12 10 11 1D 1C 2F 1B 0E 1C 0E 1B 1F 0E 0D 24 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 18 1B 12 10 12 17 0A 15 2F 0C 18 17 0C 0E 19 1D 9C 2F 2F 0D 0E 1C 12 10 17 2F 0A 17 0D 2F 19 1B 18 10 1B 0A 16 2F 0B 22 2F 0A 15 0E 21 0E 22 2F 19 0A 23 11 12 1D 17 18 1F 9D 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 8E 5A 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5B 5C 5D 80 81 82 83 90 91 92 81 82 83 90 6C 6D 6E 6F 70 71 72 5E 5D 84 85 86 87 93 94 95 85 86 87 93 73 74 75 76 77 78 2F 5E 5D 2F 88 89 2F 96 97 98 88 89 2F 96 79 7A 7B 7C 7D 7E 2F 5E 5D 2F 8A 8B 2F 8E 8F 6B 8A 8B 2F 8E 7F 66 67 68 69 6A 2F 5E 5F 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 60 61 8E 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3C 3D 3E 3C 3C 3C 8E 8E 8C 8C 62 63 8C 8C 3A 8C 8C 8C 8C 8C 3A 42 43 3B 8C 8C 8E 8E 3A 8C 64 65 8C 8C 8C 8C 3B 8C 8C 8C 8C 44 45 8C 8C 8C 8E 8E 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 8C 46 47 48 49 3F 40 8E 8E 8C 8C 8C 8C 3A 8C 8C 8C 8C 53 54 8C 4A 4B 4C 4D 42 43 8E 8E 8C 8C 8C 8C 8C 8C 8C 8C 54 55 56 57 4E 4F 50 51 52 45 8E 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 41 2F 2F 59 19 15 0A 22 0E 1B 2F 2F 2F 99 19 15 0A 22 0E 1B 2F 2F 2F 9A 9A 9A 9A 9A 9A 9A 2F 2F 2F 9A 9A 9A 9A 9A 9A 9A 2F 2F 2F 2F 2F 33 30 31 32 31 2F 34 35 36 37 38 39 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 10 0A 16 0E 2F 1D 22 19 0E 54 2C 2C 2C 2C 4B 4A 2C 55 56 6D 58 58 58 58 58 A9 58 58 58 6E 56 56 5A 2C 4B 4A 2C 5B 78 77 7E 7F 9A 9B 2F AA 79 77 7E 7F 9A 9B 5C 2C 4B 4A 2C 2D 4F 4F 4F 4F 4F 4F 4F AC 4F 4F 4F 4F 4F 4F 2E 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 53 16 1E 1C 12 0C 2F 1D 22 19 0E 54 2C 2C 2C 4B 4A 2C 55 56 6D 58 58 58 58 58 A9 58 58 58 58 6E 56 5A 2C 4B 4A 2C 5B 78 77 7E 7F 9A 9B 2F AA 79 77 7E 7F 9A 9B 5C 2C 4B 4A 2C 71 72 72 72 72 72 72 72 AB 72 72 72 72 72 72 74 2C 4B 4A 2C 5B 7A 77 7E 7F 9A 9B 2F AA 2F 9D 9C 9C 2F 2F 5C 2C 4B 4A 2C 2D 4F 4F 4F 4F 4F 4F 4F AC 4F 4F 4F 4F 4F 4F 2E 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2F 0A 25 1D 22 19 0E 2F 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 50 51 51 51 51 51 52 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 53 15 0E 1F 0E 15 54 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 55 56 57 58 6C 58 6C 58 59 56 5A 2C 2C 2C 2C 4B 4A 2C 2C 2C 5B 90 6F 91 6F 92 6F 93 6F 94 5C 2C 2C 2C 2C 4B 4A 2C 2C 2C 71 72 73 72 73 72 73 72 73 72 74 2C 2C 2C 2C 4B 4A 2C 2C 2C 5B 95 6F 96 6F 97 6F 98 6F 99 5C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2D 4F 6B 4F 6B 4F 6B 4F 6B 4F 2E 2C 2C 2C 2C 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 1D 18 19 25 1C 0C 18 1B 0E 54 2C 2C 2C 2C 4B 4A 55 56 70 6D 58 58 58 58 58 58 58 58 58 6E 56 56 56 5A 4B 4A 5B 01 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 02 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 03 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 2D 4F 6B 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 2E 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2F 0B 25 1D 22 19 0E 2F 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 50 51 51 51 51 51 52 2C 2C 50 51 51 51 51 52 2C 4B 4A 2C 2C 53 15 0E 1F 0E 15 54 2C 2C 53 11 12 10 11 54 2C 4B 4A 55 56 57 58 6C 58 6C 58 59 56 5A 75 58 6C 58 6C 6E 5A 4B 4A 5B 90 6F 91 6F 92 6F 93 6F 94 5C 5B 90 6F 91 6F 92 5C 4B 4A 71 72 73 72 73 72 73 72 73 72 74 71 72 73 72 73 72 74 4B 4A 5B 95 6F 96 6F 97 6F 98 6F 99 5C 5B 93 6F 94 6F 95 5C 4B 4A 2D 4F 6B 4F 6B 4F 6B 4F 6B 4F 2E 2D 4F 6B 4F 6B 4F 2E 4B 4A 2C 2C 2C 50 51 51 51 51 51 51 51 51 51 52 2C 2C 2C 2C 4B 4A 2C 2C 2C 53 1D 18 19 25 1C 0C 18 1B 0E 54 2C 2C 2C 2C 4B 4A 55 56 70 6D 58 58 58 58 58 58 58 58 58 6E 56 56 56 5A 4B 4A 5B 01 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 02 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 5B 03 6F 60 60 60 60 60 60 2F 2F 60 60 60 60 60 60 5C 4B 4A 2D 4F 6B 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 4F 2E 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E CD CD CD CD CD CD CD CD CD CD 8C C9 CA 8C 8C 8C 8C 8C 8C 8C 8C CB CC 8C 8C 8C 8C 8C 8C CE D7 D7 D7 D7 D7 D7 D7 D7 D7 CF 2F 2F 2F 2F 2F 2F 2F 2F 2F D0 2F 2F 2F 2F 2F 2F 2F 2F D1 D2 2F 2F 2F 2F 2F 2F 2F 2F D3 D4 7C 7C 7C 7C 7C 7C 2F 2F D5 D6 7D 7D 7D 7D 2F 2F 2F 2F D8 2F 7B 7B 7B 7B 2F 2F 2F 2F D8 2F 7C 7C 7C 7C 2F 2F 2F 2F D8 2F 2F 2F 2F 2F 2F 2F 2F 2F D8 2F 2F 2F 2F 2F 2F 2F 7C 7C 7C 7C 2F 2F 2F 2F 2F 2F 2F 2F 2F 7C 7D 7D 2F 2F 2F 2F 2F 2F 2F 7D 2F 2F 2F D9 2F 2F 2F 2F 2F 7B B7 B8 D9 B7 2F 7C 7C 7C 7C 7C 7D 7D 7D 7D 7D 7D 7D 7D 7D 7D FF 4A 4A 4A 4A 4A 4A 59 69 69 69 69 69 69 49 4A 4A 4A 4A 4A 4A 5A 5A 5A 5A 5A 5A 85 85 85 85 85 85 85 85 5A 5A 38 39 38 5A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 6A 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 07 47 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 48 49 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 2C 4B 4A 2C 2C 16 0A 1B 12 18 2F 1F 1C 24 15 1E 12 10 12 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 50 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 53 11 12 10 11 54 2C 2C 2C 4B 4A 2C 2C 55 56 56 5A 2C 2C 2C 75 58 6C 58 6C 6E 5A 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 5B 90 6F 91 6F 92 5C 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 71 72 73 72 73 72 74 2C 2C 4B 4A 2C 2C 2D 4F 4F 2E 2C 2C 2C 5B 93 6F 94 6F 95 5C 2C 2C 4B 4A 2C 2C 16 0A 1B 12 18 2C 2C 2D 4F 6B 4F 6B 4F 2E 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 50 51 51 51 51 52 2C 2C 2C 4B 4A 2C 2C 2C 2C 2C 2C 2C 2C 2C 53 11 12 10 11 54 2C 2C 2C 4B 4A 2C 2C 55 56 56 5A 2C 2C 2C 75 58 6C 58 6C 6E 5A 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 5B 90 6F 91 6F 92 5C 2C 2C 4B 4A 2C 2C 5B 2F 2F 5C 2C 2C 2C 71 72 73 72 73 72 74 2C 2C 4B 4A 2C 2C 2D 4F 4F 2E 2C 2C 2C 5B 93 6F 94 6F 95 5C 2C 2C 4B 4A 2C 2C 15 1E 12 10 12 2C 2C 2D 4F 6B 4F 6B 4F 2E 2C 2C 4B 4C 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4D 4E 8E B2 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B3 30 31 31 31 31 31 32 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 40 42 42 42 42 42 41 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 11 12 10 11 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 33 34 34 34 34 34 35 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 8E 8E 8E 8E 8E 8E 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 30 31 31 31 31 31 32 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 15 12 17 0E 1C 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 36 2F 2F 2F 2F 2F 37 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 33 34 34 34 34 34 35 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 38 39 39 39 39 3A 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B0 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B5 2B 3B 2F 2F 2F 2F 3C 8E B1 2F 2F 2F 2F 2F 2F 2F 2F 2F 2F B4 2B 3D 3E 3E 3E 3E 3F 07 07 07 07 07 07 84 87 87 8C 87 87 8C 87 87 8C 87 87 86 07 07 1E 1E 1E 1E 1E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 B4 B5 BB 2E BC 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BF BF BF BF BF 89 8A 8A 8E 8A 8A 8E 8A 8A 8E 8A 8A 8B 07 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 06 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 16 07 07 07 07 07 07 84 87 87 8C 87 87 8C 87 87 8C 87 87 86 07 07 1E 1E 1E 1E 1E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BD B2 2E BE 2E 79 2F 2F 8D 2F 2F 8D 2F 2F 8D 2F 2F 88 07 07 BF BF BF BF BF 89 8A 8A 8E 8A 8A 8E 8A 8A 8E 8A 8A 8B 07 01 01 01 01 01 01 02 02 03 03 01 01 01 01 02 02 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F F2 FE 12 1E 12 1E 12 1E 7E 7E FF 83 FF 81 FF FF 00 00 00 00 00 00 00 00 07 07 18 1F 21 3E 47 7F 04 FC 02 FE 02 FE 07 FD 07 FD 1F FF FF FF FF FA 00 00 00 00 00 00 00 00 00 00 00 00 07 07 18 1F FF FF 77 11 FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 03 03 05 04 03 03 00 00 18 18 2C 24 1A 1A 08 08 40 40 07 07 18 1F A0 BF 3B 3F 7C 44 7C 44 10 10 02 02 E0 E0 18 F8 05 FD 8C FC 78 48 6C 74 00 00 07 07 18 1F 20 3F 30 3F 1F 1D 3E 22 3E 22 80 80 80 80 80 80 80 80 00 00 C0 C0 E0 E0 E0 E0 00 00 7C 7C 66 66 66 66 7C 7C 60 60 60 60 00 00 00 00 3C 3C 60 60 3C 3C 0E 0E 4E 4E 3C 3C 00 00 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 04 04 07 04 04 04 04 0D 04 0D 04 04 04 04 03 02 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 00 00 00 00 00 00 03 03 04 04 08 08 09 09 04 04 5F 7F 39 30 7B 62 FB B2 FF A0 FF C2 7F 54 7F 5C 18 F8 04 FC 02 FE 02 FE 07 FD 07 FD FF FF FF FA 20 3F 40 7F 40 7F E0 BF E0 BF F8 FF 7F 7F 7F 5F FF 11 FF FF DD 44 FF 44 FF FF 77 11 FF 11 FF FF 00 00 00 00 00 00 00 00 00 00 00 00 80 80 C0 40 00 00 00 00 00 00 04 04 08 08 1C 14 14 14 08 08 18 1F 20 3F 40 7F 40 7F E0 BF E0 BF 7F 7F 7F 5F DD 44 FF 44 FF FF 77 11 FF 11 FF FF DD 44 FF 44 00 00 00 00 00 00 20 20 10 10 38 28 28 28 90 90 00 00 46 46 46 46 7E 7E 46 46 46 46 46 46 00 00 00 00 7E 7E 18 18 18 18 18 18 18 18 18 18 00 00 FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 EE B4 B4 64 64 3C 3C 2E 2E 27 27 70 70 FC 9C F7 9F 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 3F 2E 7F 63 FF 98 F7 1F F7 1C F7 D7 34 3F AC BF 03 03 01 01 01 01 00 00 00 00 06 06 05 05 07 07 FF AE FF 23 FF 18 F7 9F F7 9C 77 57 34 3F 6C 7F 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 3F 2F 7F 7C F7 9C F3 1F F0 1F F0 DF 30 3F A0 BF FF F4 FF 3E EF 38 CF F8 0F FB 0E FA 0C FC 04 FC E0 20 E0 20 E0 20 C0 40 80 80 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 01 01 02 02 02 02 3F 2F 3F 3C 77 5C F3 9F F0 1F F0 1F F0 FF 20 3F FF F4 FF 3E EF 38 CF F9 0E FA 0E FA 0C FC 04 FC C0 40 C0 40 C0 40 80 80 00 00 00 00 00 00 00 00 F7 1C F7 34 F7 BF 6C 7F 10 1F 50 5F 32 3F F1 FF 00 00 46 46 46 46 56 56 7E 7E 6E 6E 46 46 00 00 00 00 3C 3C 18 18 18 18 18 18 18 18 3C 3C 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 02 02 01 01 00 00 00 00 00 00 00 00 00 00 00 00 40 7F C0 FF 20 3F 22 3F 11 1F 72 7E BF BF FF FF 07 07 06 07 06 07 06 07 07 07 00 00 00 00 00 00 C0 FF 00 FF 00 FF 02 FF FF FF 00 00 00 00 00 00 02 02 01 01 00 00 00 00 00 00 00 00 00 00 00 00 40 7F C0 FF 20 3F 20 3F 11 1F 72 7E FF FF FF FF 02 FE 02 FE 04 FC 04 FC 88 F8 4E 7E FF FF FF FF 00 00 00 00 80 80 40 40 00 00 00 00 00 00 07 07 00 00 00 00 FF 00 FD 02 CD 32 09 F6 08 F7 00 FF 00 00 00 00 FF 00 FF 00 FF 00 FC 03 CC 33 08 F7 7C 44 3F 3F 10 1F 10 1F 12 1F 19 1F 3F 3F 3E 3E CE F2 8E DA 09 F9 09 F9 4E FE 98 F8 FC FC 7C 7C 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 00 00 46 46 66 66 76 76 5E 5E 4E 4E 46 46 00 00 00 00 18 18 18 18 18 18 18 18 00 00 18 18 00 00 12 1E 12 1E 12 1E 12 1E 7E 7E BF 83 FF 81 FF FF 00 00 E0 E0 18 F8 04 FC 0C FC F8 C8 2C 34 2E 32 00 00 46 46 46 46 46 46 46 46 2C 2C 18 18 00 00 00 00 36 36 5F 49 5F 41 7F 41 3E 22 1C 14 08 08 FE 02 FD 05 FD 05 FF 1F FF FC FF FE EF 38 EF 39 00 04 00 04 00 04 01 05 01 05 03 07 06 06 0C 0C CA C0 C8 C0 CA C0 88 80 88 87 08 00 0A 00 08 00 6F 13 2F 13 6F 13 2F 11 2D D1 2C 10 6C 10 2C 10 A0 20 A0 20 A0 20 A0 A0 A0 A0 E0 E0 60 60 30 30 08 A8 08 18 08 A8 08 48 08 A8 08 18 08 A8 08 48 00 FE 00 FF 7F FF 7F C1 7F C1 7F EB 7F C1 01 FF 00 00 00 00 00 00 FF 00 00 00 FF 00 00 00 FF 00 10 10 0B 0B 07 04 07 04 03 02 01 01 00 00 00 00 B4 B4 E4 E4 BC BC EE 6E E7 27 F0 10 FC 9C 77 5F 00 00 00 00 07 07 1F 18 3F 20 7F 40 7F 40 7F 40 00 00 00 00 00 00 80 80 C0 40 C0 40 C0 40 80 80 02 03 05 04 07 04 04 07 04 07 04 06 04 05 04 07 CE FA 0C FC 08 F8 08 F8 08 F8 08 F8 08 F8 88 F8 00 3C 00 7E 10 67 24 C3 24 C3 24 C3 24 C3 34 C3 00 3C 00 66 00 E7 2C C3 3C C3 3C C3 3C 42 18 66 00 00 00 00 00 00 20 20 90 90 B8 A8 A8 A8 10 10 0A 10 06 08 02 04 00 04 00 04 00 04 00 04 00 04 17 50 28 60 2A 60 28 60 2A 60 28 60 28 67 68 60 DE 2B 2E 17 6E 17 2E 17 6E 17 2E 17 2E D7 2E 17 98 48 B0 50 A0 60 A0 20 A0 20 A0 20 A0 20 A0 20 08 A8 08 18 08 A8 08 48 08 B8 08 3F 08 BF 09 7F 00 7F 00 FF 7E FF 7E C1 7E C1 7E EB 7E C1 00 FF 00 00 00 00 FF 00 FF 00 FF 00 FF 00 FF 00 FF 00 00 00 38 38 34 24 3C 24 3F 27 3C 27 3C 27 3F 2F 37 3C 17 14 17 1F 1C 1F F0 FF 00 FF 02 FF FF FF BF A0 BF A0 BF B8 7F 7F 2F 2F 7F 7F F7 9C F7 9C FD 05 FD 05 FD 1D FF FF F7 F4 FF FE EF 38 EF 38 01 01 01 01 01 01 02 02 02 02 02 02 01 01 00 00 02 02 02 02 01 01 00 00 00 00 00 00 00 00 00 00 34 C3 3C 43 3C 43 18 66 18 66 08 76 08 36 08 34 18 26 18 24 18 24 08 34 00 18 00 08 00 08 00 08 00 00 0F 0F 1F 10 3C 20 70 40 73 43 67 4C 3F 28 00 00 80 80 DC 5C 3E 22 32 E2 B1 C1 C3 4B 27 7C 00 00 00 00 00 00 00 00 E0 E0 D0 10 D0 D0 E0 20 5C 50 7C 50 39 30 7C 4C EE 82 C0 84 60 43 31 26 1F 3C BB 62 F1 41 61 41 C3 03 F7 04 EE 08 9C 60 90 10 08 08 18 18 3C 64 F2 C2 E3 60 39 20 F2 00 00 FF 00 FF FF FF FF 00 FF 00 FF 00 00 FF 00 FF FF FF FF 00 FF FF 00 FF 00 FF FF FF FF FF FF FF 38 38 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 0E 0E 11 11 11 11 12 12 F3 1F F0 3F F0 BF 60 7F 10 1F 50 5F 30 3F F1 FF CF FB 0C FC 08 F8 08 F8 08 F8 08 F8 08 F8 88 F8 4E 7A C9 D9 09 F9 0E FE 48 F8 98 F8 FC FC 7C 7C A0 BF 40 7F E0 FF 20 3F 11 1F 72 7E FF FF FF FF 00 3C 00 1C 00 1C 00 18 00 08 00 00 00 00 00 00 00 FF 00 AB 00 55 00 FF 00 00 00 00 00 00 00 00 00 15 00 18 00 15 00 12 00 15 00 18 00 15 00 12 40 40 40 C0 40 40 40 40 40 40 40 C0 40 40 40 40 0E 32 0E 32 0E 32 0E 32 0F 33 8F B3 CE F3 EE 73 00 00 00 00 00 00 00 00 00 00 00 00 80 80 C0 40 00 00 00 00 80 80 47 47 1F 18 3F 20 7F 40 7F 40 7F 40 BF A0 BF A0 BF B8 7F 7F 3F 3F 77 7C F7 9C F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 F2 E6 00 00 01 01 01 01 01 01 02 02 02 02 02 02 01 01 F3 9F F0 1F F0 3F E0 BF 70 7F 10 1F 50 5F 31 3F 3E 22 1F 1F 10 1F 10 1F 12 1F 19 1F 3F 3F 3E 3E 12 1E 12 1E 12 1E 12 1E 7E 7E FF 83 FF 81 FF FF 01 01 01 01 01 01 02 02 02 02 02 02 01 01 00 00 60 E0 80 80 80 80 80 80 80 80 80 80 80 80 80 80 07 04 07 04 07 04 07 04 07 04 07 04 07 04 07 04 0B 09 0B 0A 0F 0A 17 12 17 1C 14 17 17 14 2F 24 00 00 70 70 8F 8F 98 9F E0 FF F0 9F 78 57 7F 4C 3B 2F D0 DF F0 FF C0 FF C0 FF FF FF 00 00 00 00 FF FF FF FF FF FF FF F8 F8 F0 F2 E1 F5 E3 F2 E6 FF FF FF 81 C3 81 DF 85 DF 85 FF BD FF 81 FF FF FF FF FF FF FF FF FF 1F 1F 0F 4F 87 AF C7 4F 67 FF FF FF FF FF FF FF 00 00 00 00 FF FF FF 00 00 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 4F 67 F2 E6 F5 E3 F2 E1 F8 F0 FF F8 FF FF FF FF FF FF 00 00 FF FF 00 FF 00 00 FF 00 FF FF FF FF FF FF 4F 67 AF C7 4F 87 1F 0F FF 1F FF FF FF FF FF FF FF FF FF FF FF FF FF 00 00 00 00 EF E7 CF 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C 24 0C E7 CF 00 EF 00 00 FF 00 FF FF FF FF FF FF 07 07 18 1F 21 3E 47 7F 5F 7F 39 30 7B 62 FB B2 E0 E0 18 F8 84 7C E2 FE FA FE 9C 0C DE 46 DF 4D FF A0 FF C2 7F 54 7F 5C 3F 2E 3F 23 1F 18 07 07 FF 05 FF 43 FE 2A FE 3A FC 74 FC C4 F8 18 E0 E0 07 07 1F 18 3E 20 7F 4F 7F 5F 70 70 A2 A2 B0 B0 E0 E0 F8 18 7C 04 FE F2 FE FA 0E 0E 45 45 0D 0D B4 B4 64 64 3C 3C 2E 2E 27 27 10 10 0C 0C 03 03 2D 2D 26 26 3C 3C 74 74 E4 E4 08 08 30 30 C0 C0 2F 24 2F 24 2F 24 2F 24 67 7C BC A7 FF E4 1B 1B 00 00 00 00 01 01 01 01 03 03 03 03 03 02 07 04 04 07 07 04 07 04 04 04 06 06 05 05 05 05 06 06 07 04 07 04 04 07 04 04 04 04 07 07 07 07 06 06 06 06 06 06 04 04 07 07 05 05 03 03 05 05 0E 0E 0F 1F 01 10 01 10 01 10 01 08 01 07 04 09 00 0F 08 01 F8 F1 4E C1 02 C7 8C BD 84 AD 62 CF 7E FE EC 90 EF 9F FA F7 DA E7 BD BD B5 AD D2 EF 7F 7F F8 F8 18 E8 38 88 B8 08 B0 10 E0 E0 D0 30 F0 F0 18 18 30 30 60 60 C0 C0 C0 C0 FF FF 83 83 60 62 0A 00 08 00 08 07 08 00 08 01 F8 F1 F8 F1 08 01 6C 10 2C 10 2C D1 2C 11 AC 90 EF 9F EF 9F EC 90 18 18 0C 0C 06 C6 03 C3 03 03 FF FF C1 C1 06 46 00 04 00 0C 02 10 02 10 02 10 02 10 02 10 02 10 0C 4C 0C 4C 09 49 0B 4B 0A 4A 10 50 12 52 10 50 7E 33 7E 33 BE 93 FE D3 7E 53 3E 0B 7E 4B 3E 0B A0 20 90 30 98 48 98 48 98 48 98 48 98 48 98 48 00 00 00 00 00 00 00 00 01 01 01 01 02 02 02 02 02 02 02 02 02 02 00 01 02 02 02 02 02 02 02 03 02 03 02 02 02 02 02 03 02 02 06 06 0E 0A 0E 0A 0B 0A 0B 0A 0F 0A 0A 0A 06 06 0A 0A 1A 12 1F 1F 00 00 00 00 1F 1F 3F 20 7F 47 7C 4C 7C 4C 7C 4C 00 00 00 00 E0 E0 F0 30 F8 18 F8 98 F8 98 F8 98 7F 4F 7F 40 7F 4F 7C 4C 7C 4C 7C 7C 00 00 00 00 F8 98 F8 18 F8 98 F8 98 F8 98 F8 F8 00 00 00 00 00 00 7C 7C 4E 4E 4E 4E 4E 4E 4E 4E 7C 7C 00 00 00 00 7E 7E 60 60 7C 7C 60 60 60 60 7E 7E 00 00 00 00 46 46 46 46 46 46 46 46 4E 4E 3C 3C 00 00 00 00 3C 3C 66 66 60 60 60 60 66 66 3C 3C 00 00 00 00 46 46 6E 6E 7E 7E 56 56 46 46 46 46 00 00 00 00 3C 3C 4E 4E 4E 4E 7E 7E 4E 4E 4E 4E 00 00 FF 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 01 01 FF 01 01 FF FF FF 00 00 00 00 00 00 00 00 F0 F0 F0 B0 F0 B0 F0 F0 00 00 00 00 07 07 18 1F 20 3F 30 3F 18 17 3F 2C 7B 4F 70 5F 90 9F 90 9F 70 7F 11 1F 3E 3E 3E 3E 00 00 7C 7C 66 66 66 66 7C 7C 68 68 66 66 00 00 00 00 3C 3C 66 66 66 66 66 66 66 66 3C 3C 00 00 00 00 60 60 60 60 60 60 60 60 60 60 7E 7E 00 00 00 00 3C 3C 66 66 60 60 6E 6E 66 66 3E 3E 00 00 00 EE 00 00 FF FF FF FF FF FF FF FF FF FF FF FF 00 01 00 02 00 02 00 04 00 08 00 08 00 10 00 10 80 80 C0 40 C0 40 E0 20 30 50 30 50 38 48 18 28 00 00 00 00 00 00 00 00 00 03 00 03 00 02 00 02 00 00 00 00 00 00 00 00 08 F8 08 18 08 A8 08 48 00 80 00 80 00 80 00 80 00 00 00 00 00 00 00 00 00 20 00 20 00 20 1F 20 00 40 00 40 00 40 00 40 1C 24 0C 34 0C 34 04 FC 0E 32 0E 32 0E 32 0E 32 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 1F 00 18 00 15 00 12 00 00 00 00 00 00 00 00 40 C0 40 C0 40 40 40 40 00 02 00 03 00 02 00 02 00 02 00 03 00 02 00 02 08 AF 08 1A 08 AD 08 4F 08 A8 08 18 08 A8 08 48 00 00 00 00 00 00 00 00 00 00 00 00 00 01 00 02 00 40 15 40 15 40 15 40 15 C0 15 C1 17 43 16 46 24 0C 34 0C 34 04 FC 0E 32 0E 32 0E 32 0E 32 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 2A 20 01 00 1D 01 09 00 07 01 0B 00 03 20 04 00 20 20 06 00 0A 80 17 00 06 01 06 00 04 01 05 00 1E 80 0B 00 06 80 1C 00 0A 10 08 11 04 01 02 00 04 01 06 00 00 10 06 00 04 10 05 00 1A 80 24 00 15 01 07 00 20 10 04 00 05 10 03 00 0D 10 06 00 03 10 05 00 25 80 15 00 1B 10 04 00 13 80 03 00 1C 80 19 00 1A 01 06 00 0A 20 01 00 09 20 02 00 14 10 03 00 0E 80 16 00 0A 10 0A 11 06 10 16 00 13 80 25 00 1C 01 06 00 03 20 02 00 0E 20 03 00 04 20 02 00 03 20 05 00 0D 80 21 00 13 01 07 00 05 01 06 00 04 01 05 00 06 20 03 00 05 20 02 00 1C 20 03 00 0E 80 12 00 0C 10 04 00 02 01 08 00 10 01 08 00 1E 80 19 00 10 10 03 00 04 10 05 00 24 80 1C 00 05 01 05 00 11 20 03 00 12 80 20 00 0A 10 01 11 06 01 00 00 04 10 04 00 04 10 03 00 02 10 19 00 04 10 07 00 0A 00 00 00 00 00 00 00 4D 20 08 21 06 20 0B 00 07 20 06 00 64 10 00 11 06 10 05 00 2F 80 16 00 17 20 05 00 06 20 06 00 10 80 18 00 34 01 05 00 01 10 0E 11 06 10 20 00 0A 80 0A 00 2B 20 06 00 06 20 05 00 05 20 06 00 0A 80 0C 00 0A 01 07 00 02 10 0B 00 05 10 04 00 0D 80 1C 00 75 01 06 00 0E 80 1F 00 1A 01 06 00 00 10 07 00 05 10 06 00 04 10 08 00 03 10 08 00 0C 80 0F 00 0A 01 07 00 00 10 3D 00 05 80 1F 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 10 18 00 04 08 00 04 08 08 00 04 14 10 08 10 10 14 18 14 00 0C 04 18 00 14 14 08 04 04 0C 00 18 04 00 08 0C 0C 18 00 0C 08 00 18 10 14 14 18 08 AA 65 C6 65 FC 66 28 66 34 67 AF 66 F1 65 54 66 B2 65 CE 65 14 67 CE 65 CE 65 C3 66 F7 65 60 66 D4 67 DC 67 9D 67 A5 67 E4 67 E4 67 E4 67 AD 67 3F 6F 4A 6F 55 6F 60 6F 6B 6F 76 6F 81 6F 8C 6F 97 6F A2 6F AD 6F B8 6F C3 6F CE 6F D9 6F E4 6F EF 6F C9 F5 C5 D5 E5 FA 7F DF FE 01 28 46 FE 02 28 7B FA 7E DF A7 20 7B F0 E4 A7 28 0D AF EA E0 DF EA E8 DF EA F0 DF EA F8 DF CD D2 64 CD DD 69 CD FD 69 CD 3C 68 CD 21 6A CD 44 6C CD 65 6A AF EA E0 DF EA E8 DF EA F0 DF EA F8 DF EA 7F DF E1 D1 C1 F1 C9 CD C7 69 AF EA E1 DF EA F1 DF EA F9 DF 21 BF DF CB BE 21 9F DF CB BE 21 AF DF CB BE 21 CF DF CB BE 21 E9 6E CD 98 69 3E 30 EA 7E DF 21 7B 65 CD 5D 69 18 B7 21 7F 65 18 F6 AF EA 7E DF 18 85 21 7E DF 35 7E FE 28 28 EC FE 20 28 E0 FE 18 28 E4 FE 10 20 97 34 18 94 B2 E3 83 C7 B2 E3 C1 C7 FA F1 DF FE 01 C9 FA E1 DF FE 05 C9 FA E1 DF FE 07 C9 FA E1 DF FE 08 C9 00 B5 D0 40 C7 00 B5 20 40 C7 00 B6 A1 80 C7 3E 05 21 9B 65 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 34 7E FE 02 28 13 21 A0 65 C3 56 69 3E 03 21 A5 65 C3 36 69 CD 8B 69 A7 C0 AF EA E1 DF E0 10 3E 08 E0 12 3E 80 E0 14 21 9F DF CB BE C9 00 80 E1 C1 87 00 80 E1 AC 87 21 E7 65 C3 36 69 21 E4 DF 34 7E FE 04 28 17 FE 0B 28 19 FE 0F 28 0F FE 18 CA 0E 66 C9 3E 01 21 F0 DF 77 C3 D3 65 21 EC 65 C3 56 69 21 E7 65 C3 56 69 48 BC 42 66 87 CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 CD 89 65 C8 3E 02 21 23 66 C3 36 69 00 B0 F1 B6 C7 00 B0 F1 C4 C7 00 B0 F1 CE C7 00 B0 F1 DB C7 CD 8F 65 C8 3E 07 21 40 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 34 7E FE 01 28 12 FE 02 28 13 FE 03 28 14 FE 04 28 15 FE 05 CA D3 65 C9 21 45 66 18 0D 21 4A 66 18 08 21 4F 66 18 03 21 40 66 C3 56 69 3E 80 E3 00 C4 93 83 83 73 63 53 43 33 23 13 00 00 23 43 63 83 A3 C3 D3 E3 FF CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 3E 06 21 95 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 4E 34 06 00 21 9A 66 09 7E A7 CA D3 65 5F 21 A5 66 09 7E 57 06 86 0E 12 7B E2 0C 7A E2 0C 78 E2 C9 3B 80 B2 87 87 A2 93 62 43 23 00 80 40 80 40 80 CD 83 65 C8 CD 95 65 C8 CD 8F 65 C8 CD 89 65 C8 3E 03 21 EC 66 C3 36 69 CD 8B 69 A7 C0 21 E4 DF 4E 34 06 00 21 F1 66 09 7E A7 CA D3 65 5F 21 F7 66 09 7E 57 06 87 18 AD CD 8F 65 C8 3E 28 21 40 67 C3 36 69 B7 80 90 FF 83 00 D1 45 80 00 F1 54 80 00 D5 65 80 00 70 66 80 65 65 65 64 57 56 55 54 54 54 54 54 47 46 46 45 45 45 44 44 44 34 34 34 34 34 34 34 34 34 34 34 34 34 34 34 70 60 70 70 70 80 90 A0 D0 F0 E0 D0 C0 B0 A0 90 80 70 60 50 40 30 30 20 20 20 20 20 20 20 20 20 20 20 10 10 3E 30 21 4D 67 C3 36 69 3E 30 21 51 67 C3 36 69 CD 8B 69 A7 C0 21 FC DF 7E 4F FE 24 CA E9 67 34 06 00 C5 21 55 67 09 7E E0 22 C1 21 79 67 09 7E E0 21 3E 80 E0 23 C9 3E 20 21 49 67 C3 36 69 3E 12 21 45 67 C3 36 69 CD 8B 69 A7 C0 AF EA F9 DF 3E 08 E0 21 3E 80 E0 23 21 CF DF CB BE C9 80 3A 20 60 C6 21 D9 6E CD 0D 69 F0 04 E6 1F 47 3E D0 80 EA F5 DF 21 FB 67 C3 64 69 F0 04 E6 0F 47 21 F4 DF 34 7E 21 F5 DF FE 0E 30 0A 34 34 7E E6 F0 B0 0E 1D E2 C9 FE 1E CA E2 68 35 35 35 18 EE FA F0 DF FE 01 CA 6B 68 FE 02 CA 00 68 FA F1 DF FE 01 CA B6 68 FE 02 CA 17 68 C9 80 80 20 9D 87 80 F8 20 98 87 80 FB 20 96 87 80 F6 20 95 87 21 A9 6E CD 0D 69 21 5A 68 7E EA F6 DF 3E 01 EA F5 DF 21 57 68 C3 64 69 3E 00 EA F5 DF 21 5F 68 7E EA F6 DF 21 5C 68 18 EC 3E 01 EA F5 DF 21 64 68 7E EA F6 DF 21 61 68 18 DB 3E 02 EA F5 DF 21 69 68 7E EA F6 DF 21 66 68 18 CA 21 F4 DF 34 2A FE 09 28 C4 FE 13 28 D1 FE 17 28 DE FE 20 28 17 2A FE 00 C8 FE 01 28 05 FE 02 28 05 C9 34 34 18 02 35 35 7E E0 1D C9 AF EA F1 DF E0 1A 21 BF DF CB BE 21 9F DF CB BE 21 AF DF CB BE 21 CF DF CB BE FA E9 DF FE 05 28 05 21 E9 6E 18 2A 21 C9 6E 18 25 E5 EA F1 DF 21 BF DF CB FE AF EA F4 DF EA F5 DF EA F6 DF E0 1A 21 9F DF CB FE 21 AF DF CB FE 21 CF DF CB FE E1 CD 98 69 C9 F5 1D FA 71 DF 12 1C F1 1C 12 1D AF 12 1C 1C 12 1C 12 7B FE E5 28 09 FE F5 28 13 FE FD 28 16 C9 C5 0E 10 06 05 18 13 C5 0E 16 06 04 18 0C C5 0E 1A 06 05 18 05 C5 0E 20 06 04 2A E2 0C 05 20 FA C1 C9 1C EA 71 DF 1C 3D CB 27 4F 06 00 09 4E 23 46 69 60 7C C9 D5 6B 62 34 2A BE 20 03 2D AF 77 D1 C9 C5 0E 30 2A E2 0C 79 FE 40 20 F8 C1 C9 AF EA E1 DF EA E9 DF EA F1 DF EA F9 DF EA 9F DF EA AF DF EA BF DF EA CF DF 3E FF E0 25 3E 03 EA 78 DF 3E 08 E0 12 E0 17 E0 21 3E 80 E0 14 E0 19 E0 23 AF E0 10 E0 1A C9 11 E0 DF 1A A7 28 0C 21 9F DF CB FE 21 80 64 CD 78 69 E9 1C 1A A7 28 07 21 90 64 CD 7C 69 E9 C9 11 F8 DF 1A A7 28 0C 21 CF DF CB FE 21 A0 64 CD 78 69 E9 1C 1A A7 28 07 21 A8 64 CD 7C 69 E9 C9 CD A5 69 C9 21 E8 DF 2A A7 C8 FE FF 28 F2 77 47 21 B0 64 E6 1F CD 7C 69 CD 13 6B CD 3C 6A C9 FA E9 DF A7 C8 21 BE 6A 3D 28 06 23 23 23 23 18 F7 2A EA 78 DF 2A EA 76 DF 2A EA 79 DF 2A EA 7A DF AF EA 75 DF EA 77 DF C9 FA E9 DF A7 28 3D 21 75 DF FA 78 DF FE 01 28 37 FE 03 28 2F 34 2A BE 20 33 2D 36 00 2C 2C 34 FA 79 DF CB 46 CA 8F 6A FA 7A DF 47 FA F1 DF A7 28 04 CB D0 CB F0 FA F9 DF A7 28 04 CB D8 CB F8 78 E0 25 C9 3E FF 18 F9 FA 79 DF 18 DE FA F9 DF A7 20 F1 FA F1 DF A7 20 EB C9 01 24 EF 56 01 00 E5 00 01 20 FD 00 01 20 DE F7 03 18 7F F7 03 18 F7 7F 03 48 DF 5B 01 18 DB E7 01 00 FD F7 03 20 7F F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 ED F7 01 20 EF F7 01 20 EF F7 2A 4F 7E 47 0A 12 1C 03 0A 12 C9 2A 12 1C 2A 12 C9 CD C7 69 AF EA 75 DF EA 77 DF 11 80 DF 06 00 2A 12 1C CD 0D 6B 11 90 DF CD 0D 6B 11 A0 DF CD 0D 6B 11 B0 DF CD 0D 6B 11 C0 DF CD 0D 6B 21 90 DF 11 94 DF CD 02 6B 21 A0 DF 11 A4 DF CD 02 6B 21 B0 DF 11 B4 DF CD 02 6B 21 C0 DF 11 C4 DF CD 02 6B 01 10 04 21 92 DF 36 01 79 85 6F 05 20 F8 AF EA 9E DF EA AE DF EA BE DF C9 E5 AF E0 1A 6B 62 CD 98 69 E1 18 2A CD B9 6B CD CE 6B 5F CD B9 6B CD CE 6B 57 CD B9 6B CD CE 6B 4F 2C 2C 73 2C 72 2C 71 2D 2D 2D 2D E5 21 70 DF 7E E1 FE 03 28 CA CD B9 6B C3 5E 6C D5 2A 5F 3A 57 13 7B 22 7A 32 D1 C9 D5 2A 5F 3A 57 13 13 18 F1 2A 4F 3A 47 0A 47 C9 E1 18 2C FA 70 DF FE 03 20 10 FA B8 DF CB 7F 28 09 7E FE 06 20 04 3E 40 E0 1C E5 7D C6 09 6F 7E A7 20 DD 7D C6 04 6F CB 7E 20 D5 E1 CD 67 6D 2D 2D C3 39 6D 2D 2D 2D 2D CD C5 6B 7D C6 04 5F 54 CD 02 6B FE 00 28 1F FE FF 28 04 2C C3 5C 6C 2D E5 CD C5 6B CD CE 6B 5F CD B9 6B CD CE 6B 57 E1 7B 22 7A 32 18 D5 21 E9 DF 36 00 CD A5 69 C9 21 E9 DF 7E A7 C8 3E 01 EA 70 DF 21 90 DF 2C 2A A7 CA 04 6C 35 C2 D8 6B 2C 2C CD CE 6B FE 00 CA 09 6C FE 9D CA 89 6B E6 F0 FE A0 20 1A 78 E6 0F 4F 06 00 E5 11 81 DF 1A 6F 13 1A 67 09 7E E1 2D 22 CD B9 6B CD CE 6B 78 4F 06 00 CD B9 6B FA 70 DF FE 04 CA BC 6C E5 7D C6 05 6F 5D 54 2C 2C 79 FE 01 28 0F 36 00 21 02 6E 09 2A 12 1C 7E 12 E1 C3 D3 6C 36 01 E1 18 17 E5 11 C6 DF 21 94 6E 09 2A 12 1C 7B FE CB 20 F8 0E 20 21 C4 DF 18 2E E5 FA 70 DF FE 01 28 21 FE 02 28 19 0E 1A FA BF DF CB 7F 20 05 AF E2 3E 80 E2 0C 2C 2C 2C 2C 2A 5F 16 00 18 15 0E 16 18 05 0E 10 3E 00 0C 2C 2C 2C 3A A7 20 4F 2A 5F 2C 2A 57 E5 2C 2C 2A A7 28 02 1E 01 2C 2C 36 00 2C 7E E1 CB 7F 20 13 7A E2 0C 7B E2 0C 2A E2 0C 7E F6 80 E2 7D F6 05 6F CB 86 E1 2D 3A 32 2D 11 70 DF 1A FE 04 28 09 3C 12 11 10 00 19 C3 52 6C 21 9E DF 34 21 AE DF 34 21 BE DF 34 C9 06 00 E5 E1 2C 18 AC 78 CB 3F 6F 26 00 19 5E C9 E5 7D C6 06 6F 7E E6 0F 28 18 EA 71 DF FA 70 DF 0E 13 FE 01 28 0E 0E 18 FE 02 28 08 0E 1D FE 03 28 02 E1 C9 2C 2A 5F 7E 57 D5 7D C6 04 6F 46 FA 71 DF FE 01 18 09 FE 03 18 00 21 FF FF 18 1C 11 CB 6D CD 5E 6D CB 40 20 02 CB 33 7B E6 0F CB 5F 28 06 26 FF F6 F0 18 02 26 00 6F D1 19 7D E2 0C 7C E2 18 BE 00 00 00 00 00 00 10 00 0F 00 00 11 00 0F F0 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 01 12 10 FF EF 00 0F 2C 00 9C 00 06 01 6B 01 C9 01 23 02 77 02 C6 02 12 03 56 03 9B 03 DA 03 16 04 4E 04 83 04 B5 04 E5 04 11 05 3B 05 63 05 89 05 AC 05 CE 05 ED 05 0A 06 27 06 42 06 5B 06 72 06 89 06 9E 06 B2 06 C4 06 D6 06 E7 06 F7 06 06 07 14 07 21 07 2D 07 39 07 44 07 4F 07 59 07 62 07 6B 07 73 07 7B 07 83 07 8A 07 90 07 97 07 9D 07 A2 07 A7 07 AC 07 B1 07 B6 07 BA 07 BE 07 C1 07 C4 07 C8 07 CB 07 CE 07 D1 07 D4 07 D6 07 D9 07 DB 07 DD 07 DF 07 00 00 00 00 00 C0 A1 00 3A 00 C0 B1 00 29 01 C0 61 00 3A 00 C0 12 34 45 67 9A BC DE FE 98 7A B7 BE A8 76 54 31 01 23 44 55 67 88 9A BB A9 88 76 55 44 33 22 11 01 23 45 67 89 AB CD EF FE DC BA 98 76 54 32 10 A1 82 23 34 45 56 67 78 89 9A AB BC CD 64 32 10 11 23 56 78 99 98 76 67 9A DF FE C9 85 42 11 31 02 04 08 10 20 40 0C 18 30 05 00 01 03 05 0A 14 28 50 0F 1E 3C 03 06 0C 18 30 60 12 24 48 08 10 00 07 0E 1C 38 70 15 2A 54 04 08 10 20 40 80 18 30 60 04 09 12 24 48 90 1B 36 6C 0C 18 04 0A 14 28 50 A0 1E 3C 78 00 0E 6F F9 7C FF 7C 11 7D 21 7D 00 05 6F 48 7E 44 7E 4A 7E 4C 7E 00 0E 6F 3B 76 33 76 41 76 63 76 00 F9 6E 00 76 FC 75 02 76 00 00 00 0E 6F 4C 71 42 71 56 71 62 71 00 0E 6F C6 72 B8 72 D4 72 02 73 00 0E 6F 08 70 FA 6F 00 00 00 00 00 05 6F 9D 7E 91 7E A9 7E B5 7E 00 0E 6F 28 7C 24 7C 2A 7C 2C 7C 00 0E 6F 00 00 00 7A 00 00 00 00 00 0E 6F 00 00 26 7A 2A 7A 00 00 00 0E 6F 73 7A 6F 7A 75 7A 00 00 00 0E 6F DF 7A E3 7A E5 7A E7 7A 00 0E 6F 65 7B 6B 7B 6F 7B 73 7B 00 0E 6F 6C 78 76 78 7E 78 86 78 00 2B 6F 43 75 4B 75 51 75 00 00 00 0E 6F 8D 75 95 75 9B 75 00 00 16 70 34 70 16 70 4D 70 93 70 FF FF FA 6F 62 70 74 70 62 70 85 70 F4 70 FF FF 08 70 9D 74 00 41 A2 44 4C 56 4C 42 4C 44 4C 3E 4C 3C 4C 44 4C 56 4C 42 4C 44 4C 3E 4C 3C 4C 00 44 4C 44 3E 4E 48 42 48 42 3A 4C 44 3E 4C 48 44 42 3E 3C 34 3C 42 4C 48 00 44 4C 44 3E 4E 48 42 48 42 3A 52 48 4C 52 4C 44 3A 42 A8 44 00 9D 64 00 41 A3 26 3E 3C 26 2C 34 3E 36 34 3E 2C 34 00 26 3E 30 22 3A 2C 1E 36 30 A2 34 36 34 30 2C 2A 00 A3 26 3E 30 22 3A 2A 2C 34 34 2C 22 14 00 A2 52 4E 4C 48 44 42 44 48 4C 44 48 4E 4C 4E A3 52 42 A2 44 48 A3 4C 48 4C 56 50 A2 56 5A A3 5C 5A A2 56 52 50 4C 50 4A A8 4C A7 52 A1 56 58 A3 56 A2 52 4E 52 4C 4E 48 A7 56 A1 5A 5C A3 5A A2 56 54 56 50 54 4C 5A 54 4C 54 5A 60 66 54 64 54 60 54 A3 5C A2 60 5C 5A 5C A1 56 5A A4 56 A2 01 00 A2 34 3A 44 3A 30 3A 34 3A 2C 3A 2A 3A 2C 3A 44 3A 30 3A 34 3A 2C 3A 2A 3A 2C 34 2C 26 3E 38 32 38 2A 38 32 38 A3 34 42 2A A2 34 3A 42 3A 30 3A 2E 34 26 34 2E 34 A8 30 A2 32 38 2A 38 32 38 A8 34 A3 34 2A 24 1C 20 24 2C 30 34 A8 26 00 68 71 68 71 AE 71 FF FF 42 71 CB 71 CB 71 1D 72 FF FF 4C 71 3A 72 3A 72 7F 72 7F 72 FF FF 56 71 A3 72 FF FF 62 71 9D 84 00 81 A3 52 A2 48 4A A3 4E A2 4A 48 A3 44 A2 44 4A A3 52 A2 4E 4A A7 48 A2 4A A3 4E 52 A3 4A 44 44 01 A2 01 A3 4E A2 54 A3 5C A2 58 54 A7 52 A2 4A A3 52 A2 4E 4A A3 48 A2 48 4A A3 4E 52 A3 4A 44 44 01 00 9D 50 00 81 A4 3A 32 36 30 A4 32 2C A8 2A A3 01 A4 3A 32 36 30 A3 32 3A A4 44 42 01 00 9D 43 00 81 A3 48 A2 42 44 48 A1 52 4E A2 44 42 A7 3A A2 44 4A 01 A2 48 44 A1 42 42 A2 3A 42 44 A3 48 4A A3 44 3A 3A 01 A2 1E A3 3C A2 44 4A A1 4A 4A A2 48 44 A7 40 A2 3A 40 A1 44 40 A2 3C 3A 42 3A 42 44 48 42 4A 42 A1 44 4A 3A 01 A3 3A 3A 01 00 9D 30 00 81 A4 32 2C 30 2A 2C 22 A4 22 A3 30 01 A4 32 2C 30 2A A3 2C 32 A4 3A 36 01 00 9D C9 6E 20 A2 22 3A 22 3A 22 3A 22 3A 2C 44 2C 44 2C 44 2C 44 2A 42 2A 42 22 3A 22 3A 2C 44 2C 44 2C 44 30 32 36 1E 01 1E 01 1E 2C 24 1A 32 01 32 1A 28 28 01 30 48 01 48 01 3A 01 42 2C 3A 2C 3A A3 2C 01 00 9D C9 6E 20 A2 44 52 44 52 44 52 44 52 42 52 42 52 42 52 42 52 44 52 44 52 44 52 44 52 42 52 42 52 A4 01 00 A2 01 06 01 06 01 A1 06 06 A2 01 06 01 06 01 06 01 06 06 06 00 0B 73 3F 73 67 73 67 73 C9 73 FF FF B8 72 08 73 3C 73 8E 73 8E 73 4B 74 FF FF C6 72 1F 73 53 73 B5 73 B5 73 B5 73 B5 73 B5 73 B5 73 C0 74 DE 74 DE 74 DE 74 EE 74 FE 74 FE 74 0E 75 0E 75 1E 75 1E 75 0E 75 2E 75 FF FF D4 72 33 73 FF FF 02 73 A5 01 00 9D 62 00 80 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 A2 06 A1 06 06 A2 06 06 00 A5 01 00 9D 32 00 80 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 9D 82 00 80 A2 3A 48 52 50 52 A1 48 48 A2 4A 44 48 A1 40 40 A2 44 3E 40 A1 3A 3A A2 3E 38 3A 30 32 38 3A 30 32 3E 00 9D 53 00 40 A2 30 40 40 44 40 A1 3E 40 A2 44 3E 40 A1 38 3A A2 3E 38 3A A1 2E 30 A2 38 30 30 28 2C 2C 30 28 2C 38 00 9D E9 6E A0 A2 3A A1 3A 3A A2 30 30 3A A1 3A 3A A2 30 30 00 A8 3A A2 3E 38 A8 3A A3 3E A2 40 A1 40 40 A2 44 3E 40 A1 40 40 A2 44 3E A8 40 A3 44 A2 48 A1 48 48 A2 4A 44 48 A1 48 48 A2 4A 44 A8 48 A3 4C A2 4E A1 4E 4E A2 4E 4E 52 4E 4E 4C 4E A1 4E 4E A2 4E 4E 52 4E 4E 4C 4E A1 4E 4E A2 4E 4E 4C A1 4C 4C A2 4C 4C 4A A1 4A 4A A2 4A 44 3E 40 44 36 44 A1 40 40 A2 36 A3 40 A1 36 3A A2 36 30 44 A1 40 40 A2 36 A3 40 A1 36 3A A2 36 2E A5 36 A8 01 A3 38 00 A8 30 A2 30 30 A8 30 A3 36 A5 01 A8 01 A3 3E A2 40 A1 40 40 A2 44 3E 40 A1 40 40 A2 44 3E A8 36 A3 3A A2 3E A1 40 44 A2 3E 44 48 48 48 3A 3E A1 40 44 A2 3E 44 46 46 46 3A 3E A1 40 44 A2 3E 44 3A A1 3E 40 A2 3A 40 3A A1 3E 40 A2 3E 3E 2C 3A 3E 26 30 A1 30 30 A2 30 A3 30 A1 30 34 A2 30 28 2E A1 2E 2E A2 2E A3 2E A1 2E 32 A2 2E 28 A5 26 A8 01 A3 2C 00 A2 3A A1 3A 3A A2 32 2C 3A A1 3A 3A A2 38 30 3A A1 3A 3A A2 32 2C 3A A1 3A 3A A2 2C 1E 00 A2 28 A1 40 28 A2 1E 36 28 A1 40 28 A2 1E 36 00 A2 28 A1 40 28 A2 1E 36 28 A1 40 28 A2 2C 44 00 A2 1E A1 36 1E A2 1E 36 28 A1 40 28 A2 28 40 00 A2 1E A1 36 1E A2 1E 36 1E A1 36 1E A2 1E 36 00 A2 22 A1 3A 22 A2 22 3A 22 A1 3A 22 A2 22 3A 00 A2 1E A1 36 1E A2 1E 36 1E A1 36 1E A2 A4 3E 00 36 3E 44 A4 44 57 75 62 75 FF FF 45 75 5E 75 FF FF 4B 75 7C 75 FF FF 51 75 9D 20 00 81 AA 01 00 9D 70 00 81 A2 42 32 38 42 46 34 3C 46 4A 38 42 4A 4C 3C 42 4C 46 34 3C 46 40 2E 34 40 00 9D E9 6E 21 A8 42 A3 2A A8 42 A3 2A A8 42 A3 2A 00 A1 75 AC 75 FF FF 8F 75 A8 75 FF FF 95 75 EE 75 FF FF 9B 75 9D 20 00 81 AA 01 00 9D 70 00 81 A2 4C 42 50 42 54 42 50 42 56 42 54 42 50 42 54 42 4C 42 50 42 54 42 50 42 56 42 54 42 50 42 54 42 5A 46 56 46 54 46 50 46 4E 46 50 46 54 46 50 46 50 3E 4C 3E 4C 3E 4A 3E 4A 3E 46 3E 4A 3E 50 3E 00 9D E9 6E 21 A5 4C 4A 46 42 38 3E 42 42 00 04 76 00 00 14 76 23 76 9D B2 00 80 A2 60 5C 60 5C 60 62 60 5C A4 60 00 9D 92 00 80 A2 52 4E 52 4E 52 54 52 4E A4 52 9D E9 6E 20 A2 62 60 62 60 62 66 62 60 A3 62 01 6F 76 69 77 69 77 00 00 BF 76 AA 77 3C 78 0C 77 EB 77 EB 77 F5 77 EB 77 EB 77 FE 77 F5 77 EB 77 EB 77 FE 77 F5 77 07 78 11 78 FE 77 F5 77 EB 77 5B 77 5B 77 1A 78 1A 78 1A 78 1A 78 9D C3 00 80 A2 3C 3E 3C 3E 38 50 A3 01 A2 3C 3E 3C 3E 38 50 A3 01 A2 01 48 01 46 01 42 01 46 A1 42 46 A2 42 42 38 A3 3C 01 A2 3E 42 3E 42 3C 54 A3 01 A2 3E 42 3E 42 3C 54 A3 01 A2 01 56 01 54 01 54 01 50 A2 01 A1 50 54 A2 50 4E A3 50 01 00 9D 74 00 80 A2 36 38 36 38 2E 3E A3 01 A2 36 38 36 38 2E 3E A3 01 A2 01 36 01 36 01 32 01 36 36 32 32 30 A3 36 01 A2 38 3C 38 3C 36 4E A3 01 A2 38 3C 38 3C 36 4E A3 01 A2 01 50 01 4E 01 46 01 46 A2 01 A1 48 4E A2 48 46 A3 40 01 00 9D E9 6E 20 A2 48 46 48 46 3E 20 A3 01 A2 48 46 48 46 3E 20 A3 01 A2 2E 3C 2E 24 24 24 24 3C 2A 3E 2A 3E A6 2E A3 01 A1 01 A2 48 46 48 46 2E 2E A3 01 A2 48 46 48 46 2E 2E A3 01 A2 2A 3C 2A 3C 2E 3E 2E 3E 2E 42 2E 42 A6 38 A3 01 A1 01 00 A8 01 A2 06 0B A8 01 A2 06 0B A5 01 01 00 9D C5 00 80 A1 46 4A A4 46 A2 01 A3 50 A8 4A A3 01 A1 42 46 A4 42 A2 01 A3 4E A1 4E 50 A4 46 A7 01 A1 40 46 A4 40 A2 01 A3 46 A1 46 4A A4 42 A7 01 A1 36 38 A4 36 A2 01 A3 3C A7 42 A4 40 A2 01 00 9D 84 00 41 A1 40 42 A4 40 A2 01 A3 40 A8 42 A3 01 A1 3C 40 A4 3C A2 01 A3 3C A1 3C 40 A4 40 A7 01 A1 36 32 A4 2E A2 01 A3 40 A1 36 38 A4 32 A7 01 A1 2E 32 A4 2E A2 01 A3 2A A7 30 A4 2E A2 01 00 A2 38 38 01 38 38 38 01 38 00 2E 2E 01 2E 2E 2E 01 2E 00 2A 2A 01 2A 2A 2A 01 2A 00 A2 38 38 01 38 36 36 01 36 00 32 32 01 32 2E 2E 01 2E 00 A2 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 06 0B 01 06 01 0B 01 0B 00 9D 66 00 81 A7 58 5A A3 58 A7 5E A4 5A A2 01 A7 50 54 A3 58 A7 5A A4 58 A2 01 A7 50 A3 4E A7 4E 58 54 A3 4A A7 5A 5E A3 5A A7 54 A4 50 A2 01 00 8E 78 11 79 8E 78 96 79 00 00 AD 78 38 79 AD 78 BA 79 D5 78 5E 79 D5 78 DD 79 FE 78 84 79 FE 78 84 79 9D D1 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 44 A1 4C 52 00 9D B2 00 80 A2 52 A1 52 52 A2 52 A1 52 52 A2 44 A1 44 44 A2 44 01 4C A1 4C 4C A2 4C A1 4C 4C A2 3A A1 3A 3A A2 3A 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E A1 52 52 A2 56 01 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 44 A1 48 48 A2 4C 01 00 A2 06 A7 01 A2 0B 0B 0B 01 A2 06 A7 01 A2 0B 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 44 A1 44 52 A2 48 44 A1 48 52 56 5A 00 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 36 A1 36 36 A2 36 01 00 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 44 A1 44 44 A2 44 A1 44 44 A2 42 A1 42 42 A2 42 01 00 A2 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 48 A1 48 52 A2 44 52 A3 5C 00 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 3A A1 3A 3A A2 01 3A A3 4C 00 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 48 A1 48 48 A2 44 A1 44 44 A2 44 A1 44 44 A2 01 4C A3 44 00 04 7A 00 00 9D C2 00 40 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 A1 44 42 A2 44 A4 01 00 2C 7A 00 00 4B 7A 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E 52 56 01 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 52 4C 44 01 A5 01 77 7A 00 00 96 7A B4 7A 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D C2 00 40 A2 4E A1 4E 52 A2 56 4E A3 48 48 A2 4C A1 4C 4A A2 4C 44 34 4C A3 4C A5 01 00 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 4E 52 A1 56 56 A2 56 A2 5C A1 5C 5C A2 5C A1 5C 5C A2 52 4C A1 44 44 A2 01 A5 01 00 E9 7A 00 00 08 7B 25 7B 4F 7B 9D C2 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 4C 44 52 A3 5C A4 01 00 9D B2 00 80 A2 4E A1 4E 52 A2 56 4E A3 48 48 A2 4C A1 4C 4A A2 4C 44 34 4C A3 4C A5 01 9D E9 6E 20 A2 5C A1 5C 5C A2 5C A1 5C 5C 4E 56 5C 56 4E 44 3E 44 A2 5C A1 5C 5C A2 5C A1 5C 5C 52 4C 44 4C 5C 01 A2 01 A5 01 A2 0B 0B 0B 0B A2 0B 0B 0B 01 A2 0B 0B 0B 0B A2 0B 0B 0B 01 A5 01 77 7B CE 7B 00 00 96 7B F2 7B A8 7B 02 7C BB 7B 12 7C 9D D1 00 80 A2 5C A1 5C 5A A2 5C 5C 56 52 4E 56 A2 52 A1 52 50 A2 52 52 4C 48 44 A1 4C 52 00 A2 52 A7 01 A2 44 44 44 01 4C A7 01 A2 3A 3A 3A 01 00 A2 5C A7 01 A2 4E 52 56 01 A2 5C A7 01 A2 44 48 4C 01 00 A2 06 A7 01 A2 0B 0B 0B 01 A2 06 A7 01 A2 0B 0B 0B 01 00 A2 48 A1 48 52 A2 44 A1 44 52 A2 42 A1 42 52 A2 48 A1 48 52 A2 4C A1 4C 52 A2 48 A1 48 52 A2 5C 52 A3 5C 00 01 3A 01 3A 01 3A 01 3A 01 3A 01 3A 01 3A A3 34 01 48 01 48 01 48 01 48 01 44 01 44 01 4C A3 44 A2 01 0B 01 0B 01 0B 01 0B 01 0B 01 0B A2 01 0B 0B 01 2E 7C 00 00 63 7C 97 7C CB 7C 9D B3 00 80 A6 52 A1 50 A6 52 A1 50 A6 52 A1 48 A3 01 A6 4C A1 4A A6 4C A1 4A A6 4C A1 42 A3 01 A6 3E A1 42 A6 44 A1 48 A6 4C A1 50 A6 52 A1 56 A6 52 A1 6A 00 9D 93 00 C0 A6 42 A1 40 A6 42 A1 40 A6 42 A1 42 A3 01 A6 3A A1 38 A6 3A A1 38 A6 3A A1 3A A3 01 A6 38 A1 38 A6 3A A1 3E A6 42 A1 44 A6 48 A1 4C A6 42 A1 42 9D E9 6E A0 A6 48 A1 46 A6 48 A1 46 A6 48 A1 52 A3 01 A6 44 A1 42 A6 44 A1 42 A6 44 A1 4C A3 01 A6 48 A1 3A A6 3E A1 42 A6 44 A1 48 A6 4C A1 50 A6 52 A1 3A A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 A6 0B A1 06 A6 0B A1 06 A3 01 A6 0B A1 06 2E 7D FF FF 01 7D 29 7D 35 7D 5B 7D 82 7D 5B 7D A4 7D C6 7D FF FF 03 7D 3B 7D 6C 7D 93 7D 6C 7D B5 7D 07 7E FF FF 13 7D 3E 7D 41 7D FF FF 23 7D 9D 60 00 81 00 9D 20 00 81 AA 01 00 A3 01 50 54 58 00 A5 01 00 A5 01 00 A3 01 06 01 06 01 A2 06 06 A3 01 06 A3 01 06 01 06 01 A2 06 06 01 01 06 06 00 A7 5A A2 5E A7 5A A2 58 A7 58 A2 54 A7 58 A2 54 00 9D C9 6E 20 A2 5A 62 68 70 5A 62 68 70 5A 64 66 6C 5A 64 66 6C 00 A7 54 A2 50 A7 54 A2 50 A7 50 A2 4C A7 4A A2 50 00 58 5E 64 6C 58 5E 64 6C 50 54 58 5E 50 58 5E 64 00 A7 54 A2 50 A7 54 A2 50 A7 50 A2 4C A7 4A A2 46 00 58 5E 64 6C 58 5E 64 6C 50 54 58 5E 50 58 5E 64 00 A7 4A A2 4C A7 4A A2 46 A7 46 A2 44 A7 46 A2 4A A7 4C A2 50 A7 4C A2 4A A7 4A A2 46 A7 4A A2 4C A7 50 A2 4E A7 50 A2 52 A7 58 A2 54 A7 5A A2 54 A7 52 A2 50 A7 4C A2 4A A2 42 38 3C 4A A3 42 01 00 4A 52 58 5E 4A 58 5E 62 54 62 68 6C 54 62 68 6C 46 4C 54 5E 46 4C 54 5A 50 58 5E 64 50 5E 64 6C 4A 50 58 5E 4A 58 5E 62 4E 54 5A 62 4E 54 5A 66 50 58 5E 64 50 5E 64 68 A8 5A A3 01 00 4E 7E 00 00 5E 7E 6D 7E 7D 7E 9D B1 00 80 A7 01 A1 5E 5E A6 68 A1 5E A4 68 00 9D 91 00 80 A7 01 A1 54 54 A6 5E A1 58 A4 5E 9D E9 6E 20 A7 01 A1 4E 4E A6 58 A1 50 A3 58 01 A7 01 A1 06 06 A6 0B A1 06 A0 06 06 06 06 06 06 06 06 A3 01 BB 7E 28 7F BB 7E 73 7F FF FF 91 7E E5 7E 4F 7F E5 7E 96 7F FF FF 9D 7E FB 7E 61 7F FB 7E AE 7F FF FF A9 7E 11 7F FF FF B5 7E 9D 82 00 80 A2 54 A1 54 54 54 4A 46 4A A2 54 A1 54 54 54 58 5C 58 A2 54 A1 54 54 58 54 52 54 A1 58 5C 58 5C A2 58 A1 56 58 00 9D 62 00 80 A2 01 44 01 40 01 44 01 46 01 44 01 44 01 40 01 40 00 9D E9 6E 20 A2 54 54 4A 52 54 54 4A 58 54 54 52 54 4E 54 4A 52 00 A2 06 0B 06 0B 06 0B 06 0B 06 0B 06 0B 06 A1 0B 0B 06 A2 0B A1 06 00 A2 5E A1 5E 5E 5E 54 50 54 A2 5E A1 5E 5E 5E 62 66 62 A2 5E A1 5E 5C A2 58 A1 58 54 A1 52 54 52 54 A2 52 A1 4E 52 00 A2 01 46 01 4A 01 46 01 4A 01 46 01 46 01 46 01 46 00 A2 46 54 54 54 46 54 54 54 46 54 52 58 44 52 4A 58 00 A2 62 A1 62 62 62 5E 5A 5E A2 62 A1 62 62 62 5E 5A 5E A2 62 A1 4A 4E A2 52 A1 4A 5C A3 58 A1 54 A6 6C 00 A2 01 4A 01 4A 01 4A 01 4A 01 A1 46 46 A2 46 A1 46 46 A3 46 A2 44 01 00 A2 42 5A 50 5A 42 5A 50 5A 4A A1 52 52 A2 52 A1 52 52 A3 52 A2 54 01 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 00 C3 D3 64 C3 A5 69 00 00 00 00 00 00 00 00 00 00";
+		uint16_t offset = 0x0000;
+		while (!ss.eof())
+		{
+			std::string b;
+			ss >> b;
+			gb->m_memory[offset++] = (uint8_t)std::stoul(b, nullptr, 16);
+		}
+		gb->tiles.invalidate_all();
 	}
 	
 	map_asm = gb->cpu.disassemble(0x0000, 0xFFFF);
+	gb->heatmap.set_granularity(MemoryHeatmap::HEAT_PAGE);
+	gb->rewinder.enable(4 * FRAME_CYCLES, 120); // Snapshot every 4 frames, about 8 seconds of history
+
+	// From now on only emulation thread touches GameBoy, window gets screen through snapshots
+	gb->screen.set_direct(false);
+	capture(m_view);
+	m_emu_active = true;
+	m_emu_thread = std::thread(&Debugger::emulate, this);
 	return true;
 }
 
 bool Debugger::OnUserUpdate(float fElapsedTime)
 {
-	//bool go = false;
+	// Input is only turned into commands here, emulation thread executes them
+	if (GetKey(olc::Key::SPACE).bPressed)
+		m_steps += 1;
+
+	if (GetKey(olc::Key::TAB).bHeld)
+		m_steps += 10;
+
+	if (GetKey(olc::Key::G).bPressed)
+		m_commands |= CMD_RUN;
+
+	if (GetKey(olc::Key::R).bPressed)
+		m_commands |= CMD_RESET;
+
+	if (GetKey(olc::Key::H).bPressed)
+		m_commands |= CMD_HEAT;
+
+	// Joypad events go to emulation thread through lock-free queue
+	static const std::pair<olc::Key, Joypad::KEY> pad[] =
+	{
+		{ olc::Key::RIGHT, Joypad::KEY_RIGHT }, { olc::Key::LEFT, Joypad::KEY_LEFT },
+		{ olc::Key::UP,    Joypad::KEY_UP },    { olc::Key::DOWN, Joypad::KEY_DOWN },
+		{ olc::Key::X,     Joypad::KEY_A },     { olc::Key::Z,    Joypad::KEY_B },
+		{ olc::Key::C,     Joypad::KEY_SELECT },{ olc::Key::ENTER, Joypad::KEY_START }
+	};
+	for (const auto& k : pad)
+	{
+		olc::HWButton button = GetKey(k.first);
+		if (button.bPressed)
+			gb->joypad.push(k.second, true);
+		if (button.bReleased)
+			gb->joypad.push(k.second, false);
+	}
+
+	// Number keys pick speed multiplier, 0 runs unthrottled
+	if (GetKey(olc::Key::K0).bPressed) m_set_speed = 0.0f;
+	if (GetKey(olc::Key::K1).bPressed) m_set_speed = 1.0f;
+	if (GetKey(olc::Key::K2).bPressed) m_set_speed = 2.0f;
+	if (GetKey(olc::Key::K4).bPressed) m_set_speed = 4.0f;
+
+	if (GetKey(olc::Key::V).bPressed)
+		m_commands |= CMD_VRAM;
+
+	if (GetKey(olc::Key::BACK).bPressed)
+		m_commands |= GetKey(olc::Key::SHIFT).bHeld ? CMD_BACK_BREAK : CMD_BACK;
+
+	if (GetKey(olc::Key::B).bPressed)
+	{
+		// Toggled at PC that is currently on screen
+		if (!m_view_breakpoints.erase(m_view.PC.reg))
+			m_view_breakpoints.insert(m_view.PC.reg);
+		m_toggle_break = m_view.PC.reg;
+	}
+
+	// Panels are redrawn only when emulation published something new
+	// and not more often than refresh_rate. Otherwise last frame stays on screen
+	m_since_redraw += fElapsedTime;
+	if (m_published_version == m_view_version || m_since_redraw < 1.0f / refresh_rate)
+		return true;
+
+	{
+		std::lock_guard<std::mutex> lock(m_snapshot_lock);
+		m_view = m_published;
+		m_view_version = m_published_version;
+	}
+	m_since_redraw = 0.0f;
 
 	Clear(olc::BLACK);
 
-	if (GetKey(olc::Key::SPACE).bPressed)
+	if (m_view.vram)
 	{
-		do
-		{
-			gb->cpu.cpu_clock();
-		} while (!gb->cpu.complete());
+		draw_tiles(2, 2);
+		draw_tile_maps(270, 2);
+		draw_oam(270, 150);
+	}
+	else
+	{
+		draw_ram(2, 2, 0, 16, 16);
+		draw_ram(2, 182, 1, 16, 16);
+		draw_cpu(448, 2);
+		draw_cpu_special(2, 341);
+		draw_code(448, 82, 25);
+		draw_stack(615, 82);
+		draw_heatmap(448, 345);
 	}
 
-	if (GetKey(olc::Key::TAB).bHeld)
+	DrawString(2, 460, "SPEED: " + (m_view.speed > 0.0f ? std::to_string((int)m_view.speed) + "x" : std::string("MAX")) + "  1/2/4 = x1/x2/x4  0 = MAX   PAD: ARROWS X=A Z=B ENTER=START C=SELECT", olc::WHITE);
+	DrawString(2, 470, "SPACE=Step TAB=x10 G=GO R=RESET H=HEAT B=BREAK BKSP=Back SHIFT+BKSP=To B V=VRAM", m_view.running ? olc::YELLOW : olc::WHITE);
+
+	gb->screen.present(m_view.screen);
+
+	return true;
+}
+
+bool Debugger::OnUserDestroy()
+{
+	m_emu_active = false;
+	if (m_emu_thread.joinable())
+		m_emu_thread.join();
+	return true;
+}
+
+Debugger::~Debugger()
+{
+	OnUserDestroy();
+}
+
+void Debugger::step()
+{
+	gb->cpu.step();
+}
+
+void Debugger::emulate()
+{
+	using clock = std::chrono::steady_clock;
+
+	DebugSnapshot snapshot;
+	bool running = false;
+	bool vram = false;
+	bool dirty = true;
+	clock::time_point last_publish = clock::now();
+	const auto publish_period = std::chrono::microseconds((int)(1000000.0f / refresh_rate));
+
+	while (m_emu_active)
 	{
-		for (int i = 0; i < 10; i++)
+		H_DWORD commands = m_commands.exchange(0);
+		if (commands & CMD_RESET)
 		{
-			do
+			gb->cpu.reset();
+			gb->joypad.reset();
+			gb->rewinder.clear();
+		}
+		if (commands & CMD_RUN)
+		{
+			running = !running;
+			gb->governor.reset();
+		}
+		if (commands & CMD_VRAM)
+			vram = !vram;
+		if (commands & CMD_HEAT)
+		{
+			switch (gb->heatmap.granularity())
 			{
-				gb->cpu.cpu_clock();
-			} while (!gb->cpu.complete());
+			case MemoryHeatmap::HEAT_PAGE: gb->heatmap.set_granularity(MemoryHeatmap::HEAT_BYTE); break;
+			case MemoryHeatmap::HEAT_BYTE: gb->heatmap.set_granularity(MemoryHeatmap::HEAT_OFF);  break;
+			default:                       gb->heatmap.set_granularity(MemoryHeatmap::HEAT_PAGE); break;
+			}
 		}
+		if (commands & (CMD_BACK | CMD_BACK_BREAK))
+		{
+			running = false;
+			m_steps = 0;
+			if (commands & CMD_BACK_BREAK)
+				gb->rewinder.run_back([this](H_WORD pc) { return (bool)m_breakpoints[pc]; });
+			else
+				gb->rewinder.step_back();
+		}
+		gb->joypad.poll();
+
+		float speed = m_set_speed.exchange(-1.0f);
+		if (speed >= 0.0f)
+		{
+			gb->governor.set_speed(speed);
+			dirty = true;
+		}
+		int toggle = m_toggle_break.exchange(-1);
+		if (toggle >= 0)
+		{
+			m_breakpoints[toggle] = !m_breakpoints[toggle];
+			m_breakpoint_count += m_breakpoints[toggle] ? 1 : -1;
+			gb->cpu.set_breakpoints(m_breakpoint_count != 0 ? &m_breakpoints : nullptr);
+		}
+		dirty |= commands != 0 || toggle >= 0;
+
+		for (int steps = m_steps.exchange(0); steps > 0; steps--)
+		{
+			step();
+			dirty = true;
+		}
+
+		// Free run goes in slices of one frame, commands are checked in between.
+		// Without breakpoints CPU takes its fast paths, with rewinder on as well
+		if (running)
+		{
+			if (gb->cpu.run(gb->cpu.cpu_cycles(FRAME_CYCLES)))
+				running = false;
+			dirty = true;
+
+			// Free run goes at governor speed
+			gb->recorder.frame();
+			gb->audio.update();
+			gb->governor.frame();
+		}
+		gb->audio.pause(!running);
+
+		// While running state changes constantly, so it is published at capped rate
+		clock::time_point now = clock::now();
+		if (dirty && (!running || now - last_publish >= publish_period))
+		{
+			snapshot.vram = vram;
+			capture(snapshot);
+			snapshot.running = running;
+			snapshot.speed   = (float)gb->governor.speed();
+			if (publish(snapshot))
+			{
+				last_publish = now;
+				dirty = false;
+			}
+		}
+
+		if (!running)
+			std::this_thread::sleep_for(std::chrono::milliseconds(1));
 	}
+}
 
-	if (GetKey(olc::Key::R).bPressed)
-		gb->cpu.reset();
+void Debugger::capture(DebugSnapshot& s)
+{
+	const CPUZ80& cpu = gb->cpu;
 
-	draw_ram(2, 2, 0x0370, 16, 16);
-	draw_ram(2, 182, 0x9800, 16, 16);
-	draw_cpu(448, 2);
-	draw_cpu_special(2, 341);
-	draw_code(448, 82, 25);
-	draw_stack(615, 82);
+	s.AF = cpu.AF; s.BC = cpu.BC; s.DE = cpu.DE;
+	s.HL = cpu.HL; s.SP = cpu.SP; s.PC = cpu.PC;
+	s.rom_bank = gb->bank_of(0x4000);
 
-	DrawString(2, 470, "SPACE = Step  TAB = 10 Steps G = GO!!!  R = RESET");
+	s.PEI = cpu.PEI;
+	s.PDI = cpu.PDI;
+	s.IME = cpu.IME;
+	s.IE  = cpu.io[CPUZ80::IO_IE];
+	s.IF  = cpu.io[CPUZ80::IO_IF];
 
-	gb->screen.flush();
+	s.TIMA = cpu.io[CPUZ80::IO_TIMA];
+	s.TAC  = cpu.io[CPUZ80::IO_TAC];
+	s.DIV  = cpu.io[CPUZ80::IO_DIV];
 
-	return true;
+	s.LCD_enabled = cpu.LCD_ENABLED();
+	gb->screen.save(s.screen);
+	s.STAT = cpu.io[CPUZ80::IO_STAT];
+	s.LY   = cpu.io[CPUZ80::IO_LY];
+
+	for (int w = 0; w < 2; w++)
+		for (int i = 0; i < 256; i++)
+			s.ram[w][i] = gb->m_memory[(H_WORD)(s.ram_addr[w] + i)];
+
+	for (int i = 0; i < 8; i++)
+		s.stack[i] = gb->m_memory[(H_WORD)(cpu.SP.reg + 1 + i)];
+
+	const MemoryHeatmap& heat = gb->heatmap;
+	s.heat_mode = heat.granularity();
+	if (s.heat_mode != MemoryHeatmap::HEAT_OFF)
+	{
+		std::copy(heat.page_reads.begin(), heat.page_reads.end(), s.page_reads);
+		std::copy(heat.page_writes.begin(), heat.page_writes.end(), s.page_writes);
+	}
+	if (s.heat_mode == MemoryHeatmap::HEAT_BYTE)
+	{
+		s.heat_page = heat.hottest_page() << 8;
+		std::copy(&heat.byte_reads[s.heat_page], &heat.byte_reads[s.heat_page] + 256, s.byte_reads);
+		std::copy(&heat.byte_writes[s.heat_page], &heat.byte_writes[s.heat_page] + 256, s.byte_writes);
+	}
+
+	if (s.vram)
+	{
+		s.LCDC = cpu.io[CPUZ80::IO_LCDC];
+		s.SCX  = cpu.io[CPUZ80::IO_SCX];
+		s.SCY  = cpu.io[CPUZ80::IO_SCY];
+		s.BGP  = gb->m_memory[0xFF47];
+
+		// Only tiles written since last capture are decoded again
+		for (int t = 0; t < 384; t++)
+			std::copy(gb->tiles.tile(t), gb->tiles.tile(t) + 64, s.tiles[t]);
+		std::copy(&gb->m_memory[0x9800], &gb->m_memory[0x9800] + 2048, &s.tile_maps[0][0]);
+		std::copy(&gb->m_memory[0xFE00], &gb->m_memory[0xFE00] + 160, s.oam);
+	}
 }
+
+bool Debugger::publish(const DebugSnapshot& s)
+{
+	// If UI is copying right now we just skip this one, next loop will try again
+	if (!m_snapshot_lock.try_lock())
+		return false;
+
+	m_published = s;
+	m_published_version++;
+	m_snapshot_lock.unlock();
+	return true;
+}
\ No newline at end of file
@@ -4,15 +4,63 @@
 #include <sstream>
 #include <string>
 #include <cstdint>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <set>
+#include <vector>
 
+#include "core.h"
+#include "Screen.h"
 #include "olcPixelGameEngine.h"
 
 class GameBoy;
 
+/*
+	Debug Snapshot
+
+	Copy of everything debugger panels show. Emulation thread fills it and publishes it,
+	UI thread draws only from the published copy. So panels always show one consistent
+	moment of emulation and never touch live emulation state.
+*/
+struct DebugSnapshot
+{
+	Register AF, BC, DE, HL, SP, PC;
+	H_BYTE   rom_bank = 1; // Bank mapped at 4000-7FFF
+
+	bool   PEI = false, PDI = false, IME = false;
+	H_BYTE IE = 0, IF = 0;
+	H_BYTE TIMA = 0, TAC = 0, DIV = 0;
+	bool   LCD_enabled = false;
+	H_BYTE STAT = 0, LY = 0;
+
+	H_WORD ram_addr[2] = { 0x0370, 0x9800 }; // Memory shown by two RAM panels
+	H_BYTE ram[2][256] = {};
+	H_BYTE stack[8]    = {};
+
+	H_BYTE  heat_mode = 0;
+	H_WORD  heat_page = 0;
+	H_DWORD page_reads[256] = {}, page_writes[256] = {};
+	H_DWORD byte_reads[256] = {}, byte_writes[256] = {};
+
+	// VRAM page. Filled only while it is shown
+	bool   vram = false;
+	H_BYTE LCDC = 0, SCX = 0, SCY = 0, BGP = 0;
+	H_BYTE tiles[384][64]     = {}; // Decoded color numbers from tile cache
+	H_BYTE tile_maps[2][1024] = {}; // $9800 and $9C00
+	H_BYTE oam[160]           = {};
+
+	H_DWORD screen[_SCREEN_W * _SCREEN_H] = {}; // Game screen, window is drawn from it by UI thread
+
+	bool  running = false;
+	float speed   = 1.0f; // Governor multiplier, 0 is unthrottled
+};
+
 class Debugger : public olc::PixelGameEngine
 {
 public:
 	Debugger() { sAppName = "Hadron GameBoy Debugger"; }
+	~Debugger();
 
 	inline void connect_device(GameBoy* instance) { gb = instance; };
 	GameBoy *gb = nullptr;
@@ -21,13 +69,64 @@ public:
 
 	std::string hex(uint32_t, uint8_t);
 
-	void draw_ram(int, int, uint16_t, int, int);
+	void draw_ram(int, int, int, int, int);
 	void draw_cpu(int, int);
 	void draw_cpu_special(int ,int);
 	void draw_code(int, int, int);
 	void draw_stack(int, int);
+	void draw_heatmap(int, int);
+	void draw_tiles(int, int);
+	void draw_tile_maps(int, int);
+	void draw_oam(int, int);
+
+	olc::Pixel  shade(H_BYTE);		// Color number to screen shade
+
+	H_BYTE      view_bank(uint16_t);	// Bank of address in displayed snapshot
+	olc::Pixel  code_color(uint16_t);	// Labeled lines are highlighted
 
 	bool OnUserCreate();
 	bool OnUserUpdate(float);
-};
+	bool OnUserDestroy();
+
+	float refresh_rate = 30.0f; // Panels are redrawn at most this many times per second
+
+private:
+	// Commands from UI thread to emulation thread
+	enum
+	{
+		CMD_RESET = (1 << 0),
+		CMD_RUN   = (1 << 1), // Toggles free run
+		CMD_HEAT  = (1 << 2), // Switches heatmap granularity
+		CMD_BACK  = (1 << 3), // Steps one instruction back
+		CMD_BACK_BREAK = (1 << 4), // Runs back to previous breakpoint
+		CMD_VRAM  = (1 << 5), // Switches between main and VRAM page
+	};
 
+	// Emulation thread
+	std::thread           m_emu_thread;
+	std::atomic<bool>     m_emu_active{ false };
+	std::atomic<H_DWORD>  m_commands{ 0 };
+	std::atomic<int>      m_steps{ 0 };	// Instructions UI asked to step
+	std::atomic<int>      m_toggle_break{ -1 }; // Address UI asked to toggle breakpoint at
+	std::atomic<float>    m_set_speed{ -1.0f }; // Speed UI asked for
+
+	// Breakpoints. Emulation thread checks bitmap, UI thread keeps its own set to draw them
+	std::vector<bool>  m_breakpoints = std::vector<bool>(64 * 1024, false);
+	int                m_breakpoint_count = 0;
+	std::set<uint16_t> m_view_breakpoints;
+
+	void emulate();							// Emulation thread loop
+	void step();							// Executes one instruction
+	void capture(DebugSnapshot&);			// Copies emulation state. Emulation thread only
+	bool publish(const DebugSnapshot&);		// Hands snapshot to UI. Never blocks
+
+	// Published snapshot
+	std::mutex           m_snapshot_lock;
+	DebugSnapshot        m_published;
+	std::atomic<H_QWORD> m_published_version{ 0 };
+
+	// UI thread copy
+	DebugSnapshot m_view;
+	H_QWORD       m_view_version = 0;
+	float         m_since_redraw = 0.0f;
+};
@@ -1,17 +1,32 @@
 #include "GameBoy.h"
 
+#include <cstdint>
+
 GameBoy::GameBoy()
 {
 	cpu.connect_device(this);
+	joypad.connect_device(this);
+	serial.connect_device(this);
+	apu.connect_device(this);
+	cgb.connect_device(this);
+	tiles.connect_device(this);
+	ram.connect_device(this);
 	cpu.reset();
 
 	cartrdige_loader.connect_device(this);
+	mbc.connect_device(this);
 	screen.connect_device(this);
 	debugger.connect_device(this);
+	tracer.connect_device(this);
+	rewinder.connect_device(this);
+	audio.connect_device(this);
+	recorder.connect_device(this);
 
 	screen.flush();
 
 	for (auto& i : m_memory) i = 0x00;
+	joypad.reset();
+	apu.reset();
 }
 
 GameBoy::~GameBoy()
@@ -21,12 +36,31 @@ GameBoy::~GameBoy()
 
 void GameBoy::write(H_WORD addr, H_BYTE data)
 {
+	heatmap.log_write(addr);
+	tiles.invalidate(addr);
+	ram.invalidate(addr);
+
 	if (addr == 0xFF46) // Direct Memory Access Transfer
 		cpu.DMA(data);
+	else if (addr == 0xFF00) // P1. Only select bits are writable
+		joypad.write(data);
+	else if (addr == 0xFF01 || addr == 0xFF02) // Serial
+		serial.write(addr, data);
+	else if (addr >= 0xFF10 && addr <= 0xFF3F) // Sound
+		apu.write(addr, data);
 	else if (addr == 0xFF04) // DIV reset
 		m_memory[addr] = 0x00;
 	else if (addr == 0xFF44) // LY reset
 		m_memory[addr] = 0x00;
+	else if (addr >= 0xFF4D && addr <= 0xFF70 && cgb.enabled() && CGB::owns(addr)) // Banks, palettes, HDMA, speed
+		cgb.write(addr, data);
+	else if (addr <= 0x7FFF) // ROM. Bank controller registers
+		mbc.write(addr, data);
+	else if (addr >= 0xA000 && addr <= 0xBFFF) // Cartridge RAM
+	{
+		if (mbc.ram_enabled())
+			m_memory[addr] = data;
+	}
 	else if (addr >= 0x0000 && addr <= 0xFFFF)
 		m_memory[addr] = data;
 
@@ -34,16 +68,76 @@ void GameBoy::write(H_WORD addr, H_BYTE data)
 
 H_BYTE GameBoy::read(H_WORD addr)
 {	
+	heatmap.log_read(addr);
+	if (addr == 0xFF26) // Channel status changes on its own
+		apu.read_status();
+
 	if (addr >= 0x0000 && addr <= 0xFFFF)
 		return m_memory[addr];
 
 	return 0x00;
 }
 
+H_BYTE GameBoy::bank_of(H_WORD addr)
+{
+	if (addr <= 0x3FFF)
+		return (H_BYTE)mbc.rom_bank0();
+	if (addr >= 0x4000 && addr <= 0x7FFF)
+		return (H_BYTE)mbc.rom_bank();
+	// Switchable WRAM bank
+	if (addr >= 0xD000 && addr <= 0xDFFF)
+		return cgb.wram_bank();
+	if (addr >= 0x8000 && addr <= 0x9FFF)
+		return cgb.vram_bank();
+
+	return 0;
+}
+
 H_BYTE* GameBoy::read_ptr(H_WORD addr)
 {
+	heatmap.log_read(addr);
+	if (addr == 0xFF26)
+		apu.read_status();
+
 	if (addr >= 0x0000 && addr <= 0xFFFF)
 		return &m_memory[addr];
 
 	return nullptr;
-}
\ No newline at end of file
+}
+
+void GameBoy::wrote_ptr(const H_BYTE* ptr)
+{
+	// CPU changes registers through the same pointers, only memory is tracked
+	std::uintptr_t addr = (std::uintptr_t)ptr - (std::uintptr_t)m_memory.data();
+	if (addr >= m_memory.size())
+		return;
+
+	tiles.invalidate((H_WORD)addr);
+	ram.invalidate((H_WORD)addr);
+}
+
+void GameBoy::save_state(SaveState& s) const
+{
+	cpu.save_state(s.cpu);
+	joypad.save_state(s.joypad);
+	serial.save_state(s.serial);
+	apu.save_state(s.apu);
+	mbc.save_state(s.mbc);
+	cgb.save_state(s.cgb);
+	s.memory = m_memory;
+	screen.save(s.screen.data());
+}
+
+void GameBoy::load_state(const SaveState& s)
+{
+	cpu.load_state(s.cpu);
+	m_memory = s.memory;
+	mbc.load_state(s.mbc); // After memory, mapped banks are part of it
+	cgb.load_state(s.cgb);
+	tiles.invalidate_all();
+	ram.invalidate_all();
+	screen.load(s.screen.data());
+	joypad.load_state(s.joypad, cpu.cycle_count()); // After memory, P1 byte is part of it
+	apu.load_state(s.apu);
+	serial.load_state(s.serial); // After CPU, events are scheduled from its cycle
+}
@@ -5,8 +5,26 @@
 #include "Screen.h"
 #include "CPUZ80.h"
 #include "CartridgeLoader.h"
+#include "MBC.h"
+#include "CGB.h"
 #include "Screen.h"
 #include "Debugger.h"
+#include "Tracer.h"
+#include "CodeDataLogger.h"
+#include "MemoryHeatmap.h"
+#include "SymbolTable.h"
+#include "SaveState.h"
+#include "Rewinder.h"
+#include "TileCache.h"
+#include "RamView.h"
+#include "SpeedGovernor.h"
+#include "Joypad.h"
+#include "Serial.h"
+#include "Link.h"
+#include "APU.h"
+#include "AudioOutput.h"
+#include "Recorder.h"
+#include "Recompiler.h"
 
 class GameBoy
 {
@@ -17,8 +35,23 @@ public:
 public:// Hardware
 	CPUZ80 cpu;                       // Custom 8-bit Sharp LR35902. Simplified Z80.
     CartridgeLoader cartrdige_loader; // Cartridge loader. One cartrdige at a time
+    MBC mbc;                          // Bank controller of loaded cartridge
+    CGB cgb;                          // Color hardware, switched on by CGB cartridges
     Screen screen;                    // 160x144 monochromic screen
     Debugger debugger;                // Just simple debugger
+    Tracer tracer;                    // Per instruction CPU state trace
+    CodeDataLogger cdl;               // ROM code/data coverage map
+    MemoryHeatmap heatmap;            // Read/write counters for debugger
+    SymbolTable symbols;              // Debug symbols of loaded ROM
+    Rewinder rewinder;                // Snapshot history for reverse stepping
+    TileCache tiles;                  // Decoded VRAM tiles
+    RamView ram;                      // RAM spans and hash for agents
+    SpeedGovernor governor;           // Frame pacing
+    Joypad joypad;                    // P1 register and input from UI
+    Serial serial;                    // Link port, see Link for cable
+    APU apu;                          // Sound
+    AudioOutput audio;                // Sound device, fed after every frame
+    Recorder recorder;                // Video and sound capture to disk
 
 	/* 
 		Memory Map
@@ -38,7 +71,7 @@ public:// Hardware
         --------------------------- E000
         8kB Internal RAM
         --------------------------- C000
-        8kB switchable RAM bank
+        8kB switchable RAM bank (on cartridge)
         --------------------------- A000
         8kB Video RAM
         --------------------------- 8000 --
@@ -55,5 +88,11 @@ public:
     void  write(H_WORD, H_BYTE);
     H_BYTE  read(H_WORD);
     H_BYTE* read_ptr(H_WORD);
+    void    wrote_ptr(const H_BYTE*); // Byte pointer points to was changed in place
+
+    H_BYTE  bank_of(H_WORD); // Bank currently mapped at address, numbered like RGBDS does
+
+    void save_state(SaveState&) const;
+    void load_state(const SaveState&);
 };
 
@@ -0,0 +1,84 @@
+#pragma once
+#include "core.h"
+
+#include <cstddef>
+#include <cstring>
+
+/*
+	64-bit hash
+
+	XXH64 by Yann Collet. Four independent lanes eat 32 bytes per round,
+	which runs at memory speed, and result is the same as of the reference
+	implementation, so hashes can be checked with xxhsum.
+*/
+namespace Hash
+{
+	static const H_QWORD P1 = 0x9E3779B185EBCA87ull;
+	static const H_QWORD P2 = 0xC2B2AE3D27D4EB4Full;
+	static const H_QWORD P3 = 0x165667B19E3779F9ull;
+	static const H_QWORD P4 = 0x85EBCA77C2B2AE63ull;
+	static const H_QWORD P5 = 0x27D4EB2F165667C5ull;
+
+	inline H_QWORD rotl(H_QWORD x, int r) { return (x << r) | (x >> (64 - r)); }
+
+	// Little endian loads
+	inline H_QWORD read64(const H_BYTE* p) { H_QWORD v; std::memcpy(&v, p, 8); return v; }
+	inline H_DWORD read32(const H_BYTE* p) { H_DWORD v; std::memcpy(&v, p, 4); return v; }
+
+	inline H_QWORD round(H_QWORD acc, H_QWORD input)
+	{
+		acc += input * P2;
+		return rotl(acc, 31) * P1;
+	}
+
+	inline H_QWORD merge(H_QWORD acc, H_QWORD lane)
+	{
+		acc ^= round(0, lane);
+		return acc * P1 + P4;
+	}
+
+	inline H_QWORD xxh64(const void* data, size_t size, H_QWORD seed = 0)
+	{
+		const H_BYTE* p   = (const H_BYTE*)data;
+		const H_BYTE* end = p + size;
+		H_QWORD h;
+
+		if (size >= 32)
+		{
+			H_QWORD v1 = seed + P1 + P2, v2 = seed + P2, v3 = seed, v4 = seed - P1;
+			for (; p + 32 <= end; p += 32)
+			{
+				v1 = round(v1, read64(p));
+				v2 = round(v2, read64(p + 8));
+				v3 = round(v3, read64(p + 16));
+				v4 = round(v4, read64(p + 24));
+			}
+			h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+			h = merge(h, v1);
+			h = merge(h, v2);
+			h = merge(h, v3);
+			h = merge(h, v4);
+		}
+		else
+			h = seed + P5;
+
+		h += (H_QWORD)size;
+
+		for (; p + 8 <= end; p += 8)
+			h = rotl(h ^ round(0, read64(p)), 27) * P1 + P4;
+		if (p + 4 <= end)
+		{
+			h = rotl(h ^ (read32(p) * P1), 23) * P2 + P3;
+			p += 4;
+		}
+		for (; p < end; p++)
+			h = rotl(h ^ (*p * P5), 11) * P1;
+
+		h ^= h >> 33;
+		h *= P2;
+		h ^= h >> 29;
+		h *= P3;
+		h ^= h >> 32;
+		return h;
+	}
+}
\ No newline at end of file
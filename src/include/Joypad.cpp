@@ -0,0 +1,100 @@
+#include "Joypad.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+
+void Joypad::reset()
+{
+	EVENT e;
+	while (m_queue.pop(e));
+
+	m_history.clear();
+	m_index = 0;
+	m_state = STATE();
+	schedule();
+	refresh();
+}
+
+void Joypad::write(H_BYTE data)
+{
+	m_state.select = data & 0x30;
+	refresh();
+}
+
+void Joypad::poll()
+{
+	EVENT e;
+	if (m_queue.empty())
+		return;
+
+	// New input starts new timeline, events ahead of now that came from replay are dropped
+	H_QWORD cycle = gb->cpu.cycle_count();
+	m_history.erase(std::upper_bound(m_history.begin(), m_history.end(), cycle, [](H_QWORD c, const EVENT& e) { return c < e.cycle; }), m_history.end());
+
+	while (m_queue.pop(e))
+	{
+		e.cycle = cycle;
+		m_history.push_back(e);
+	}
+
+	// Dropped in halves, so erasing costs one move per event
+	if (m_history.size() > _JOYPAD_HISTORY)
+	{
+		size_t drop = std::min(m_index, m_history.size() - _JOYPAD_HISTORY / 2);
+		m_history.erase(m_history.begin(), m_history.begin() + drop);
+		m_index -= drop;
+	}
+	schedule();
+}
+
+void Joypad::apply(H_QWORD cycle)
+{
+	while (m_index < m_history.size() && m_history[m_index].cycle <= cycle)
+	{
+		const EVENT& e = m_history[m_index++];
+		H_BYTE& lines = e.key < KEY_A ? m_state.directions : m_state.buttons;
+		H_BYTE  bit   = 1 << (e.key & 0x03);
+		if (e.pressed)
+			lines &= ~bit;
+		else
+			lines |= bit;
+	}
+	schedule();
+	refresh();
+}
+
+void Joypad::schedule()
+{
+	m_next = m_index < m_history.size() ? m_history[m_index].cycle : std::numeric_limits<H_QWORD>::max();
+}
+
+void Joypad::refresh()
+{
+	H_BYTE lines = 0x0F;
+	if (!(m_state.select & 0x10))
+		lines &= m_state.directions;
+	if (!(m_state.select & 0x20))
+		lines &= m_state.buttons;
+
+	H_BYTE& p1 = gb->m_memory[0xFF00];
+	if ((p1 & ~lines) & 0x0F)
+		gb->m_memory[0xFF0F] |= 1 << 4; // Joypad interrupt
+
+	p1 = 0xC0 | m_state.select | lines;
+}
+
+void Joypad::save_state(STATE& s) const
+{
+	s = m_state;
+}
+
+void Joypad::load_state(const STATE& s, H_QWORD cycle)
+{
+	m_state = s;
+
+	// Events after restored moment will be applied again. Ones at that very cycle
+	// are already in the state as input goes before snapshots at instruction boundary
+	m_index = std::upper_bound(m_history.begin(), m_history.end(), cycle, [](H_QWORD c, const EVENT& e) { return c < e.cycle; }) - m_history.begin();
+	schedule();
+	refresh();
+}
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+#define _JOYPAD_HISTORY 1024 // Events kept for replay, half of them once it is full
+
+#include "core.h"
+#include "SPSCQueue.h"
+
+#include <limits>
+#include <vector>
+
+class GameBoy;
+
+/*
+	Joypad
+
+	P1 register at $FF00
+		Bit 7-6 - Not used, read as 1
+		Bit 5   - Select action buttons    (0 = selected)
+		Bit 4   - Select direction buttons (0 = selected)
+		Bit 3   - Down  or Start  (0 = pressed, read only)
+		Bit 2   - Up    or Select (0 = pressed, read only)
+		Bit 1   - Left  or B      (0 = pressed, read only)
+		Bit 0   - Right or A      (0 = pressed, read only)
+
+	Joypad interrupt is requested when any selected input line goes from 1 to 0.
+
+	CPU reads P1 straight from memory, so the byte there is kept up to date
+	on every select write and every input change.
+
+	UI thread pushes key events into lock-free queue. Emulation thread drains
+	it with poll() and stamps every event with the current emulated cycle.
+	Events are applied only at instruction boundaries once their cycle has come,
+	and are kept in history, so replaying emulation from an earlier state
+	gets exactly the same input at exactly the same time. History is bounded,
+	oldest applied events are dropped when it fills up. 512 events are minutes
+	of play, far more than the rewinder reaches back.
+*/
+class Joypad
+{
+public:
+	enum KEY
+	{
+		KEY_RIGHT = 0, KEY_LEFT = 1, KEY_UP     = 2, KEY_DOWN  = 3,
+		KEY_A     = 4, KEY_B    = 5, KEY_SELECT = 6, KEY_START = 7
+	};
+
+	struct EVENT
+	{
+		H_QWORD cycle   = 0;
+		H_BYTE  key     = 0;
+		bool    pressed = false;
+	};
+
+	struct STATE
+	{
+		H_BYTE select  = 0x00; // Bits 5-4 of P1
+		H_BYTE buttons = 0x0F; // 0 = pressed
+		H_BYTE directions = 0x0F;
+	};
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	void reset();				// Releases everything and forgets input history
+	void write(H_BYTE);			// CPU writes P1
+
+	// UI thread. Returns false if queue is full
+	inline bool push(KEY key, bool pressed) { return m_queue.push({ 0, (H_BYTE)key, pressed }); }
+
+	// Emulation thread. Moves queued events to history at current cycle
+	void poll();
+
+	// Called by CPU at every instruction boundary
+	inline void on_instruction(H_QWORD cycle)
+	{
+		if (cycle >= m_next)
+			apply(cycle);
+	}
+	inline H_QWORD next_event() const { return m_next; }
+
+	void save_state(STATE&) const;
+	void load_state(const STATE&, H_QWORD cycle);
+
+private:
+	GameBoy* gb = nullptr;
+	STATE    m_state;
+
+	SPSCQueue<EVENT, 64> m_queue;
+	std::vector<EVENT>   m_history;	// Sorted by cycle, at most _JOYPAD_HISTORY plus one queue of them
+	size_t               m_index = 0; // First event not applied yet
+	H_QWORD              m_next  = std::numeric_limits<H_QWORD>::max(); // Cycle of that event
+
+	void apply(H_QWORD cycle);	// Applies all events due at cycle
+	void refresh();				// Rebuilds P1, requests interrupt on falling lines
+	void schedule();			// Updates m_next
+};
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "Link.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+#include <limits>
+#include <thread>
+
+Link::~Link()
+{
+	disconnect();
+}
+
+void Link::connect(GameBoy& a, GameBoy& b)
+{
+	disconnect();
+
+	GameBoy* gbs[2] = { &a, &b };
+	for (int i = 0; i < 2; i++)
+	{
+		END& e = m_ends[i];
+		e.serial = &gbs[i]->serial;
+		e.serial->m_link = this;
+		e.serial->m_end  = i;
+
+		e.log.clear();
+		e.transfers.clear();
+		e.time   = gbs[i]->cpu.dot_count();
+		e.armed  = false;
+		e.active = false;
+		e.done   = true;
+		record(i, e.time, gbs[i]->m_memory[0xFF01], gbs[i]->m_memory[0xFF02]);
+	}
+
+	// Fast clock of CGB makes shortest transfer much shorter
+	m_lookahead = (a.cgb.enabled() || b.cgb.enabled()) ? _LINK_LOOKAHEAD_CGB : _LINK_LOOKAHEAD;
+
+	for (END& e : m_ends)
+		e.serial->schedule();
+}
+
+void Link::disconnect()
+{
+	for (END& e : m_ends)
+	{
+		if (e.serial == nullptr)
+			continue;
+		e.serial->m_link = nullptr;
+		e.serial->schedule();
+		e.serial = nullptr;
+	}
+}
+
+void Link::run(H_QWORD dots)
+{
+	H_QWORD target[2];
+	for (int i = 0; i < 2; i++)
+	{
+		target[i] = m_ends[i].serial->gb->cpu.dot_count() + dots;
+		m_ends[i].done = false;
+	}
+
+	std::thread second(&Link::run_end, this, 1, target[1]);
+	run_end(0, target[0]);
+	second.join();
+}
+
+void Link::run_end(int side, H_QWORD target)
+{
+	END&     other = m_ends[side ^ 1];
+	GameBoy* gb    = m_ends[side].serial->gb;
+
+	for (H_QWORD now = gb->cpu.dot_count(); now < target; now = gb->cpu.dot_count())
+	{
+		// Other end that takes part in a transfer waits for time of this one, it is published more often then
+		H_QWORD slice = (other.armed || other.active) ? _LINK_SLICE : FRAME_CYCLES;
+		gb->cpu.run(gb->cpu.cpu_cycles(std::min(slice, target - now)));
+
+		// Transfers are received at instruction boundaries only
+		while (!gb->cpu.complete())
+			gb->cpu.cpu_clock();
+		sync(side, gb->cpu.dot_count());
+		gb->serial.schedule();
+	}
+
+	m_ends[side].done = true;
+}
+
+void Link::record(int side, H_QWORD time, H_BYTE sb, H_BYTE sc)
+{
+	END& me    = m_ends[side];
+	END& other = m_ends[side ^ 1];
+
+	std::lock_guard<std::mutex> lock(me.mutex);
+	// End of received transfer may come after writes of the same instruction
+	auto at = std::upper_bound(me.log.begin(), me.log.end(), time, [](H_QWORD t, const WRITE& w) { return t < w.time; });
+	me.log.insert(at, { time, sb, sc });
+	me.armed = (me.log.back().sc & 0x81) == 0x80;
+
+	// Without transfer of the other end running, nothing looks before its time
+	if (!other.active)
+		prune(me.log, other.time);
+}
+
+void Link::start(int side, H_QWORD end, H_BYTE data)
+{
+	END& me = m_ends[side];
+
+	std::lock_guard<std::mutex> lock(me.mutex);
+	me.active = true;
+	me.transfers.push_back({ end, data });
+}
+
+void Link::sync(int side, H_QWORD now)
+{
+	END& me    = m_ends[side];
+	END& other = m_ends[side ^ 1];
+
+	for (;;)
+	{
+		// The other end posts a transfer before it publishes time past its start, so one
+		// missed below starts at or after this snapshot and can't end by now
+		bool    other_done = other.done.load(std::memory_order_acquire);
+		H_QWORD other_time = other.time.load(std::memory_order_acquire);
+
+		// Transfers of the other end that ended by now. Taken out first,
+		// completing one locks this end and ends are never locked both at once
+		std::vector<TRANSFER> due;
+		{
+			std::lock_guard<std::mutex> lock(other.mutex);
+			auto last = std::find_if(other.transfers.begin(), other.transfers.end(), [now](const TRANSFER& t) { return t.end > now; });
+			due.assign(other.transfers.begin(), last);
+			other.transfers.erase(other.transfers.begin(), last);
+		}
+		for (const TRANSFER& t : due)
+		{
+			bool waiting;
+			{
+				std::lock_guard<std::mutex> lock(me.mutex);
+				waiting = (state_at(me.log, t.end).sc & 0x81) == 0x80;
+				prune(me.log, t.end);
+			}
+			if (waiting)
+			{
+				H_BYTE* io = &me.serial->gb->m_memory[0xFF00];
+				me.serial->complete(t.data);
+				record(side, t.end, io[0x01], io[0x02]);
+			}
+		}
+
+		// Only after that, the other end reads log of this one up to time published here
+		me.time = now;
+
+		if (!me.armed || other_done || other_time + m_lookahead >= now)
+			return;
+		std::this_thread::yield();
+	}
+}
+
+H_BYTE Link::exchange(int side, H_QWORD end)
+{
+	END& me    = m_ends[side];
+	END& other = m_ends[side ^ 1];
+
+	while (other.time < end && !other.done)
+		std::this_thread::yield();
+
+	H_BYTE data;
+	{
+		std::lock_guard<std::mutex> lock(other.mutex);
+		WRITE w = state_at(other.log, end);
+		data = (w.sc & 0x81) == 0x80 ? w.sb : 0xFF; // Nobody clocked by us, line stays high
+		prune(other.log, end);
+	}
+	me.active = false;
+	return data;
+}
+
+H_QWORD Link::next_event(int side)
+{
+	END& me    = m_ends[side];
+	END& other = m_ends[side ^ 1];
+
+	H_QWORD next = std::numeric_limits<H_QWORD>::max();
+	{
+		std::lock_guard<std::mutex> lock(other.mutex);
+		if (!other.transfers.empty())
+			next = other.transfers.front().end;
+	}
+	if (me.armed && !other.done)
+		next = std::min<H_QWORD>(next, other.time + m_lookahead);
+	return next;
+}
+
+Link::WRITE Link::state_at(const std::vector<WRITE>& log, H_QWORD time)
+{
+	auto at = std::lower_bound(log.begin(), log.end(), time, [](const WRITE& w, H_QWORD t) { return w.time < t; });
+	if (at == log.begin())
+		return { 0, 0xFF, 0x00 };
+	return *(at - 1);
+}
+
+void Link::prune(std::vector<WRITE>& log, H_QWORD time)
+{
+	auto at = std::lower_bound(log.begin(), log.end(), time, [](const WRITE& w, H_QWORD t) { return w.time < t; });
+	if (at - log.begin() > 1)
+		log.erase(log.begin(), at - 1);
+}
\ No newline at end of file
@@ -0,0 +1,93 @@
+#pragma once
+#define _LINK_LOOKAHEAD     4096	// Dots. Shortest transfer, no byte can arrive sooner than that after it starts
+#define _LINK_LOOKAHEAD_CGB 64		// Fast clock in double speed
+#define _LINK_SLICE         4096	// Dots between time updates while other end waits for a byte
+
+#include "core.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+class GameBoy;
+class Serial;
+
+/*
+	Link Cable
+
+	Connects serial ports of two GameBoy instances in one process. run()
+	emulates each of them on its own thread, they wait for each other only
+	around transfers:
+		- Every end publishes how far it is emulated. End that starts a transfer
+		  posts it with its byte. Byte arrives at the other end when transfer ends,
+		  at least lookahead dots later.
+		- End that waits with external clock may run at most lookahead dots ahead
+		  of the other one, so it sees every transfer before its end comes.
+		- End with internal clock waits at end of its transfer until the other
+		  one gets there and takes its byte as of that moment.
+		- End doing neither can't be affected and runs freely.
+
+	Ends keep a log of their SB and SC writes, so either side decides the same
+	way whether a transfer met a waiting end. Outcome doesn't depend on thread
+	timing, the same run gives the same result every time.
+
+	Both instances have to stay alive while connected. Transfers in flight are not
+	a part of save states.
+*/
+class Link
+{
+public:
+	~Link();
+
+	void connect(GameBoy&, GameBoy&);
+	void disconnect();
+
+	// Emulates both for given dots on two threads
+	void run(H_QWORD dots);
+
+private:
+	friend class Serial;
+
+	struct WRITE
+	{
+		H_QWORD time;
+		H_BYTE  sb;
+		H_BYTE  sc;
+	};
+
+	struct TRANSFER
+	{
+		H_QWORD end;	// Dot byte arrives at
+		H_BYTE  data;
+	};
+
+	struct END
+	{
+		Serial* serial = nullptr;
+
+		std::atomic<H_QWORD> time{ 0 };		// Dot this end is emulated up to
+		std::atomic<bool>    armed{ false };	// Waits with external clock
+		std::atomic<bool>    active{ false };	// Internal clock transfer runs
+		std::atomic<bool>    done{ true };		// Not running
+
+		std::mutex            mutex;		// Guards both below
+		std::vector<WRITE>    log;			// By time
+		std::vector<TRANSFER> transfers;	// Started here, not yet seen by the other end
+	};
+
+	std::array<END, 2> m_ends;
+	H_QWORD m_lookahead = _LINK_LOOKAHEAD;
+
+	void run_end(int, H_QWORD target);
+
+	// Serial calls these
+	void    record(int, H_QWORD time, H_BYTE sb, H_BYTE sc);	// Register write or end of transfer
+	void    start(int, H_QWORD end, H_BYTE data);				// Internal clock transfer
+	void    sync(int, H_QWORD now);								// Receives transfers due by now, publishes time, waits if ahead
+	H_BYTE  exchange(int, H_QWORD end);							// Waits for the other end, byte it sends
+	H_QWORD next_event(int);									// Dot sync has to be called at
+
+	static WRITE state_at(const std::vector<WRITE>&, H_QWORD time);	// Registers just before time
+	static void  prune(std::vector<WRITE>&, H_QWORD time);				// Drops what no lookup from time on needs
+};
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include "MBC.h"
+#include "GameBoy.h"
+
+#include <algorithm>
+#include <cstring>
+
+void MBC::load(const Cartridge& cartridge)
+{
+	m_type      = cartridge.header.mbc;
+	m_rom       = cartridge.m_rom;
+	m_rom_banks = cartridge.m_banks;
+	m_rumble    = cartridge.header.type >= 0x1C && cartridge.header.type <= 0x1E;
+
+	m_s = STATE();
+	m_s.ram.assign(cartridge.header.ram_size, 0x00);
+
+	// Both ROM windows are filled here, cartridge without RAM leaves A000-BFFF as it is
+	std::memcpy(&gb->m_memory[0x0000], m_rom, 0x8000);
+	m_mapped_rom  = 1;
+	m_mapped_rom0 = 0;
+	m_mapped_ram  = -1;
+	map();
+}
+
+void MBC::write(H_WORD addr, H_BYTE data)
+{
+	switch (m_type)
+	{
+	case CartridgeHeader::MBC_1:
+		if (addr <= 0x1FFF)
+			m_s.ram_enabled = (data & 0x0F) == 0x0A;
+		else if (addr <= 0x3FFF)
+			m_s.rom = std::max(data & 0x1F, 1);
+		else if (addr <= 0x5FFF)
+			m_s.upper = data & 0x03;
+		else
+			m_s.mode = data & 0x01;
+		break;
+	case CartridgeHeader::MBC_2:
+		if (addr > 0x3FFF)
+			break;
+		if (addr & 0x0100)
+			m_s.rom = std::max(data & 0x0F, 1);
+		else
+			m_s.ram_enabled = (data & 0x0F) == 0x0A;
+		break;
+	case CartridgeHeader::MBC_3:
+		if (addr <= 0x1FFF)
+			m_s.ram_enabled = (data & 0x0F) == 0x0A;
+		else if (addr <= 0x3FFF)
+			m_s.rom = std::max(data & 0x7F, 1);
+		else if (addr <= 0x5FFF)
+			m_s.upper = data;
+		break;	// Clock latch is ignored
+	case CartridgeHeader::MBC_5:
+		if (addr <= 0x1FFF)
+			m_s.ram_enabled = (data & 0x0F) == 0x0A;
+		else if (addr <= 0x2FFF)
+			m_s.rom = (m_s.rom & 0x100) | data;
+		else if (addr <= 0x3FFF)
+			m_s.rom = (m_s.rom & 0x0FF) | ((data & 0x01) << 8);
+		else if (addr <= 0x5FFF)
+			m_s.upper = data & (m_rumble ? 0x07 : 0x0F);
+		break;
+	default:
+		return; // No registers, ROM can't be written
+	}
+	map();
+}
+
+H_WORD MBC::rom_bank() const
+{
+	if (m_type == CartridgeHeader::MBC_1)
+		return (H_WORD)(((m_s.upper << 5) | m_s.rom) % m_rom_banks);
+	if (m_type == CartridgeHeader::MBC_2 || m_type == CartridgeHeader::MBC_3 || m_type == CartridgeHeader::MBC_5)
+		return (H_WORD)(m_s.rom % m_rom_banks);
+	return 1;
+}
+
+H_WORD MBC::rom_bank0() const
+{
+	if (m_type == CartridgeHeader::MBC_1 && m_s.mode)
+		return (H_WORD)((m_s.upper << 5) % m_rom_banks);
+	return 0;
+}
+
+int MBC::ram_bank() const
+{
+	if (m_s.ram.empty())
+		return -1;
+
+	int banks = (int)std::max<size_t>(m_s.ram.size() / 0x2000, 1);
+	switch (m_type)
+	{
+	case CartridgeHeader::MBC_1: return m_s.mode ? m_s.upper % banks : 0;
+	case CartridgeHeader::MBC_3: return m_s.upper <= 0x07 ? m_s.upper % banks : -1; // 08-0C are clock registers
+	case CartridgeHeader::MBC_5: return m_s.upper % banks;
+	default:                     return 0;
+	}
+}
+
+void MBC::map()
+{
+	H_WORD rom  = rom_bank();
+	H_WORD rom0 = rom_bank0();
+	int    ram  = ram_bank();
+
+	if (rom != m_mapped_rom)
+	{
+		std::memcpy(&gb->m_memory[0x4000], m_rom + (size_t)rom * 0x4000, 0x4000);
+		m_mapped_rom = rom;
+	}
+	if (rom0 != m_mapped_rom0)
+	{
+		std::memcpy(&gb->m_memory[0x0000], m_rom + (size_t)rom0 * 0x4000, 0x4000);
+		m_mapped_rom0 = rom0;
+	}
+	gb->cdl.map_banks(rom0, rom);
+	if (ram != m_mapped_ram)
+	{
+		size_t window = std::min<size_t>(m_s.ram.size(), 0x2000);
+		if (m_mapped_ram >= 0)
+			std::memcpy(&m_s.ram[(size_t)m_mapped_ram * 0x2000], &gb->m_memory[0xA000], window);
+
+		if (ram >= 0)
+			std::memcpy(&gb->m_memory[0xA000], &m_s.ram[(size_t)ram * 0x2000], window);
+		else
+			std::memset(&gb->m_memory[0xA000], 0x00, 0x2000);
+		m_mapped_ram = ram;
+		gb->ram.invalidate(0xA000, 0xBFFF);
+	}
+}
+
+void MBC::save_state(STATE& s) const
+{
+	s = m_s;
+	if (m_mapped_ram >= 0)
+		std::memcpy(&s.ram[(size_t)m_mapped_ram * 0x2000], &gb->m_memory[0xA000], std::min<size_t>(s.ram.size(), 0x2000));
+}
+
+void MBC::load_state(const STATE& s)
+{
+	// Memory was restored before, windows in it already hold these banks
+	m_s = s;
+	m_mapped_rom  = rom_bank();
+	m_mapped_rom0 = rom_bank0();
+	m_mapped_ram  = ram_bank();
+}
\ No newline at end of file
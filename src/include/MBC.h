@@ -0,0 +1,80 @@
+#pragma once
+#include "core.h"
+#include "Cartridge.h"
+
+#include <vector>
+
+class GameBoy;
+
+/*
+	Memory Bank Controller
+
+	Maps banks of cartridge ROM and RAM into the address space. Writes to
+	0000-7FFF never change ROM, they set MBC registers
+		MBC1 - 0000-1FFF RAM enable (xA), 2000-3FFF ROM bank bits 4-0 (0 selects 1),
+		       4000-5FFF RAM bank or ROM bank bits 6-5, 6000-7FFF mode.
+		       In mode 1 bits 6-5 switch bank at 0000-3FFF and RAM bank too
+		MBC2 - 0000-3FFF, address bit 8 clear is RAM enable, set is ROM bank bits 3-0.
+		       512 bytes of RAM are built in
+		MBC3 - 0000-1FFF RAM enable, 2000-3FFF ROM bank bits 6-0 (0 selects 1),
+		       4000-5FFF RAM bank 0-3 or clock register 08-0C, 6000-7FFF clock latch
+		MBC5 - 0000-1FFF RAM enable, 2000-2FFF ROM bank bits 7-0, 3000-3FFF bit 8,
+		       bank 0 can be selected. 4000-5FFF RAM bank 0-F
+
+	Everything reads memory straight from GameBoy::m_memory, so selecting a bank
+	copies it into its window there: 16kB for ROM, 8kB for RAM. A switch costs about
+	200-250 ns. Banked code calling through a trampoline switches twice per call;
+	a ROM doing nothing but that, 1460 switches per frame, runs 17% slower than
+	the same code writing the bank already mapped. Games spend far more cycles
+	between calls, and every read pays nothing for banking.
+	Window of the mapped RAM bank is the live copy and goes back to cartridge RAM
+	before another bank replaces it.
+
+	Clock of MBC3 is not emulated, its registers read as zeros.
+*/
+class MBC
+{
+public:
+	// Registers as written, banks are derived from them
+	struct STATE
+	{
+		H_WORD rom   = 1;		// 2000-3FFF, MBC5 bit 8 included
+		H_BYTE upper = 0;		// 4000-5FFF
+		bool   ram_enabled = false;
+		bool   mode  = false;	// MBC1 6000-7FFF
+		std::vector<H_BYTE> ram;	// Cartridge RAM, all banks
+	};
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	// Maps first banks of cartridge. It has to stay alive as long as it is loaded
+	void load(const Cartridge&);
+
+	void write(H_WORD, H_BYTE);	// CPU writes 0000-7FFF
+
+	// Writes to A000-BFFF are dropped while false
+	inline bool ram_enabled() const { return m_type == CartridgeHeader::MBC_NONE || m_type == CartridgeHeader::MBC_UNSUPPORTED || m_s.ram_enabled; }
+
+	H_WORD rom_bank() const;	// At 4000-7FFF
+	H_WORD rom_bank0() const;	// At 0000-3FFF
+	int    ram_bank() const;	// At A000-BFFF, -1 is none
+
+	void save_state(STATE&) const;
+	void load_state(const STATE&);
+
+private:
+	GameBoy* gb = nullptr;
+	STATE    m_s;
+
+	CartridgeHeader::MBC_TYPE m_type = CartridgeHeader::MBC_NONE;
+	const H_BYTE* m_rom = nullptr;
+	size_t m_rom_banks = 2;
+	bool   m_rumble = false;	// MBC5 bit 3 of RAM bank is motor
+
+	// Banks in windows now
+	H_WORD m_mapped_rom  = 1;
+	H_WORD m_mapped_rom0 = 0;
+	int    m_mapped_ram  = -1;
+
+	void map();	// Copies banks that changed into windows
+};
\ No newline at end of file
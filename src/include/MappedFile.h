@@ -0,0 +1,35 @@
+#pragma once
+#include "core.h"
+
+#include <cstddef>
+
+/*
+	Mapped File
+
+	Read only view of whole file through mmap, or file mapping object on
+	Windows. Pages are loaded by OS when touched and shared with page cache,
+	so opening big file costs nothing until it is read.
+*/
+class MappedFile
+{
+public:
+	MappedFile() = default;
+	~MappedFile();
+
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	bool open(const char*);	// False if file is missing or empty
+	void close();
+
+	inline const H_BYTE* data() const { return m_data; }
+	inline size_t        size() const { return m_size; }
+
+private:
+	const H_BYTE* m_data = nullptr;
+	size_t        m_size = 0;
+#ifdef _WIN32
+	void* m_file    = nullptr;
+	void* m_mapping = nullptr;
+#endif
+};
\ No newline at end of file
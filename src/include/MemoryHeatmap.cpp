@@ -0,0 +1,88 @@
+#include "MemoryHeatmap.h"
+
+#include <algorithm>
+
+void MemoryHeatmap::set_granularity(GRANULARITY g)
+{
+	if (g == HEAT_BYTE)
+	{
+		byte_reads.assign(64 * 1024, 0);
+		byte_writes.assign(64 * 1024, 0);
+	}
+	else
+	{
+		byte_reads.clear();
+		byte_reads.shrink_to_fit();
+		byte_writes.clear();
+		byte_writes.shrink_to_fit();
+	}
+
+	m_granularity = g;
+}
+
+void MemoryHeatmap::decay()
+{
+	if (m_granularity == HEAT_OFF)
+		return;
+
+	for (H_DWORD& v : page_reads)  v -= (v + 7) >> 3;
+	for (H_DWORD& v : page_writes) v -= (v + 7) >> 3;
+
+	if (m_granularity == HEAT_BYTE)
+	{
+		for (H_DWORD& v : byte_reads)  v -= (v + 7) >> 3;
+		for (H_DWORD& v : byte_writes) v -= (v + 7) >> 3;
+	}
+}
+
+void MemoryHeatmap::clear()
+{
+	page_reads.fill(0);
+	page_writes.fill(0);
+	std::fill(byte_reads.begin(), byte_reads.end(), 0);
+	std::fill(byte_writes.begin(), byte_writes.end(), 0);
+}
+
+void MemoryHeatmap::log_reads(H_WORD first, H_WORD last, H_DWORD count)
+{
+	add(page_reads, byte_reads, first, last, count);
+}
+
+void MemoryHeatmap::log_writes(H_WORD first, H_WORD last, H_DWORD count)
+{
+	add(page_writes, byte_writes, first, last, count);
+}
+
+void MemoryHeatmap::add(std::array<H_DWORD, 256>& pages, std::vector<H_DWORD>& bytes, H_WORD first, H_WORD last, H_DWORD count)
+{
+	if (m_granularity == HEAT_OFF)
+		return;
+
+	// Whole pages at once, range is cut at page ends
+	for (H_DWORD page = first >> 8; page <= (H_DWORD)(last >> 8); page++)
+	{
+		H_DWORD from = std::max<H_DWORD>(first, page << 8);
+		H_DWORD to   = std::min<H_DWORD>(last, (page << 8) | 0xFF);
+		pages[page] += (to - from + 1) * count;
+	}
+
+	if (m_granularity == HEAT_BYTE)
+		for (H_DWORD addr = first; addr <= last; addr++)
+			bytes[addr] += count;
+}
+
+H_BYTE MemoryHeatmap::hottest_page() const
+{
+	H_BYTE page = 0;
+	H_DWORD best = 0;
+	for (int i = 0; i < 256; i++)
+	{
+		H_DWORD v = page_reads[i] + page_writes[i];
+		if (v > best)
+		{
+			best = v;
+			page = (H_BYTE)i;
+		}
+	}
+	return page;
+}
\ No newline at end of file
@@ -0,0 +1,66 @@
+#pragma once
+#include "core.h"
+
+#include <array>
+#include <vector>
+
+/*
+	Memory Heatmap
+
+	Counts reads and writes per 256 byte page of the address space and
+	optionally per byte. Counters decay every frame so the map shows
+	what is being hammered right now, not since power on.
+
+	Per byte counters take 512kB so they are allocated only when enabled.
+*/
+class MemoryHeatmap
+{
+public:
+	enum GRANULARITY
+	{
+		HEAT_OFF  = 0,
+		HEAT_PAGE = 1, // 256 pages
+		HEAT_BYTE = 2  // 256 pages + 65536 bytes
+	};
+
+	void set_granularity(GRANULARITY);
+	inline GRANULARITY granularity() const { return m_granularity; }
+
+	void decay();	// Called once per frame. Each counter loses 1/8 of its value rounded up, so it gets to 0
+	void clear();
+
+	inline void log_read(H_WORD addr)
+	{
+		if (m_granularity == HEAT_OFF)
+			return;
+		page_reads[addr >> 8]++;
+		if (m_granularity == HEAT_BYTE)
+			byte_reads[addr]++;
+	}
+
+	inline void log_write(H_WORD addr)
+	{
+		if (m_granularity == HEAT_OFF)
+			return;
+		page_writes[addr >> 8]++;
+		if (m_granularity == HEAT_BYTE)
+			byte_writes[addr]++;
+	}
+
+	// Same counts as count accesses to every byte first to last, inclusive. For work done in bulk
+	void log_reads(H_WORD first, H_WORD last, H_DWORD count);
+	void log_writes(H_WORD first, H_WORD last, H_DWORD count);
+
+	H_BYTE hottest_page() const;
+
+public:
+	std::array<H_DWORD, 256> page_reads  = {};
+	std::array<H_DWORD, 256> page_writes = {};
+	std::vector<H_DWORD>     byte_reads;
+	std::vector<H_DWORD>     byte_writes;
+
+private:
+	GRANULARITY m_granularity = HEAT_OFF;
+
+	void add(std::array<H_DWORD, 256>& pages, std::vector<H_DWORD>& bytes, H_WORD first, H_WORD last, H_DWORD count);
+};
\ No newline at end of file
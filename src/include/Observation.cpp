@@ -0,0 +1,277 @@
+#include "Observation.h"
+#include "Screen.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _OBSERVATION_SSE2
+#include <emmintrin.h>
+#endif
+
+Observation::Observation()
+{
+	configure(_OBSERVATION_W, _OBSERVATION_H, _OBSERVATION_STACK);
+}
+
+void Observation::configure(int width, int height, int stack)
+{
+	m_width  = std::max(1, width);
+	m_height = std::max(1, height);
+	m_stack  = std::max(1, stack);
+
+	build_taps(m_columns, _SCREEN_W, m_width);
+	build_taps(m_rows, _SCREEN_H, m_height);
+
+	m_gray.assign(_SCREEN_W * _SCREEN_H, 0);
+	m_narrow.assign(m_width * _SCREEN_H, 0);
+	m_frames.assign(size(), 0);
+	reset();
+}
+
+void Observation::reset()
+{
+	m_newest = -1;
+}
+
+void Observation::push(const Screen& screen)
+{
+	size_t frame = (size_t)m_width * m_height;
+	int slot = (m_newest + 1) % m_stack;
+
+	grayscale(screen, m_gray.data());
+	resize(m_gray.data(), &m_frames[slot * frame]);
+
+	// First frame stands for the ones before it
+	if (m_newest < 0)
+		for (int i = 0; i < m_stack; i++)
+			if (i != slot)
+				std::memcpy(&m_frames[i * frame], &m_frames[slot * frame], frame);
+	m_newest = slot;
+}
+
+void Observation::read(H_BYTE* out) const
+{
+	size_t frame = (size_t)m_width * m_height;
+	for (int i = 0; i < m_stack; i++)
+	{
+		int slot = (m_newest + 1 + i) % m_stack;
+		std::memcpy(out + i * frame, &m_frames[slot * frame], frame);
+	}
+}
+
+void Observation::read(float* out) const
+{
+	size_t frame = (size_t)m_width * m_height;
+	for (int i = 0; i < m_stack; i++)
+	{
+		int slot = (m_newest + 1 + i) % m_stack;
+		normalize(&m_frames[slot * frame], out + i * frame, frame);
+	}
+}
+
+void Observation::grayscale(const Screen& screen, H_BYTE* out)
+{
+	grayscale(screen.data(), out, _SCREEN_W * _SCREEN_H);
+}
+
+void Observation::grayscale(const ScreenData* in, H_BYTE* out, int count)
+{
+	int i = 0;
+
+#ifdef _OBSERVATION_SSE2
+	// 16 pixels at a time, channels are spread to 16 bit lanes. 255 * 256 still fits them
+	const __m128i mask = _mm_set1_epi32(0xFF);
+	const __m128i wr = _mm_set1_epi16(77);
+	const __m128i wg = _mm_set1_epi16(150);
+	const __m128i wb = _mm_set1_epi16(29);
+	static_assert(sizeof(ScreenData) == sizeof(H_DWORD), "pixels are loaded as 32 bit lanes");
+	auto luma = [&](const ScreenData* p)
+	{
+		__m128i a = _mm_loadu_si128((const __m128i*)p);
+		__m128i b = _mm_loadu_si128((const __m128i*)(p + 4));
+		__m128i r = _mm_packs_epi32(_mm_and_si128(a, mask), _mm_and_si128(b, mask));
+		__m128i g = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(a, 8), mask), _mm_and_si128(_mm_srli_epi32(b, 8), mask));
+		__m128i c = _mm_packs_epi32(_mm_and_si128(_mm_srli_epi32(a, 16), mask), _mm_and_si128(_mm_srli_epi32(b, 16), mask));
+		__m128i y = _mm_add_epi16(_mm_add_epi16(_mm_mullo_epi16(r, wr), _mm_mullo_epi16(g, wg)), _mm_mullo_epi16(c, wb));
+		return _mm_srli_epi16(y, 8);
+	};
+	for (; i + 16 <= count; i += 16)
+		_mm_storeu_si128((__m128i*)(out + i), _mm_packus_epi16(luma(in + i), luma(in + i + 8)));
+#endif
+
+	grayscale_plain(in + i, out + i, count - i);
+}
+
+void Observation::grayscale_plain(const ScreenData* in, H_BYTE* out, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		H_DWORD p = in[i].val;
+		out[i] = (H_BYTE)((77 * (p & 0xFF) + 150 * ((p >> 8) & 0xFF) + 29 * ((p >> 16) & 0xFF)) >> 8);
+	}
+}
+
+void Observation::narrow(const H_BYTE* gray)
+{
+	// Gathers few pixels per column, it stays scalar
+	for (int y = 0; y < _SCREEN_H; y++)
+	{
+		const H_BYTE* row = gray + y * _SCREEN_W;
+		H_BYTE* dst = &m_narrow[y * m_width];
+		for (int x = 0; x < m_width; x++)
+		{
+			const TAP& t = m_columns[x];
+			unsigned acc = 128;
+			for (size_t k = 0; k < t.weight.size(); k++)
+				acc += t.weight[k] * row[t.first + k];
+			dst[x] = (H_BYTE)(acc >> 8);
+		}
+	}
+}
+
+void Observation::resize(const H_BYTE* gray, H_BYTE* out)
+{
+	narrow(gray);
+
+	// Vertical pass weighs whole rows the same way
+	for (int y = 0; y < m_height; y++)
+	{
+		const TAP& t = m_rows[y];
+		const H_BYTE* src = &m_narrow[t.first * m_width];
+		H_BYTE* dst = out + y * m_width;
+		int x = 0;
+
+#ifdef _OBSERVATION_SSE2
+		const __m128i zero = _mm_setzero_si128();
+		for (; x + 16 <= m_width; x += 16)
+		{
+			__m128i lo = _mm_set1_epi16(128);
+			__m128i hi = lo;
+			for (size_t k = 0; k < t.weight.size(); k++)
+			{
+				__m128i v = _mm_loadu_si128((const __m128i*)(src + k * m_width + x));
+				__m128i w = _mm_set1_epi16((short)t.weight[k]);
+				lo = _mm_add_epi16(lo, _mm_mullo_epi16(_mm_unpacklo_epi8(v, zero), w));
+				hi = _mm_add_epi16(hi, _mm_mullo_epi16(_mm_unpackhi_epi8(v, zero), w));
+			}
+			_mm_storeu_si128((__m128i*)(dst + x), _mm_packus_epi16(_mm_srli_epi16(lo, 8), _mm_srli_epi16(hi, 8)));
+		}
+#endif
+
+		vertical_plain(y, x, out);
+	}
+}
+
+void Observation::resize_plain(const H_BYTE* gray, H_BYTE* out)
+{
+	narrow(gray);
+	for (int y = 0; y < m_height; y++)
+		vertical_plain(y, 0, out);
+}
+
+void Observation::vertical_plain(int y, int x, H_BYTE* out) const
+{
+	const TAP& t = m_rows[y];
+	const H_BYTE* src = &m_narrow[t.first * m_width];
+	H_BYTE* dst = out + y * m_width;
+	for (; x < m_width; x++)
+	{
+		unsigned acc = 128;
+		for (size_t k = 0; k < t.weight.size(); k++)
+			acc += t.weight[k] * src[k * m_width + x];
+		dst[x] = (H_BYTE)(acc >> 8);
+	}
+}
+
+void Observation::normalize(const H_BYTE* in, float* out, size_t count)
+{
+	size_t i = 0;
+
+#ifdef _OBSERVATION_SSE2
+	const __m128i zero = _mm_setzero_si128();
+	const __m128 s = _mm_set1_ps(1.0f / 255.0f);
+	for (; i + 16 <= count; i += 16)
+	{
+		__m128i v  = _mm_loadu_si128((const __m128i*)(in + i));
+		__m128i lo = _mm_unpacklo_epi8(v, zero);
+		__m128i hi = _mm_unpackhi_epi8(v, zero);
+		_mm_storeu_ps(out + i,      _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), s));
+		_mm_storeu_ps(out + i + 4,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), s));
+		_mm_storeu_ps(out + i + 8,  _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), s));
+		_mm_storeu_ps(out + i + 12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), s));
+	}
+#endif
+
+	normalize_plain(in + i, out + i, count - i);
+}
+
+void Observation::normalize_plain(const H_BYTE* in, float* out, size_t count)
+{
+	const float scale = 1.0f / 255.0f;
+	for (size_t i = 0; i < count; i++)
+		out[i] = in[i] * scale;
+}
+
+bool Observation::check()
+{
+	// Random colors, sizes are picked so every SSE2 loop runs and leaves a tail
+	std::mt19937 random(1);
+	std::vector<ScreenData> screen(_SCREEN_W * _SCREEN_H);
+	for (ScreenData& p : screen)
+		p.val = random();
+
+	std::vector<H_BYTE> gray(screen.size()), plain(screen.size());
+	grayscale(screen.data(), gray.data(), (int)screen.size() - 5);
+	grayscale_plain(screen.data(), plain.data(), (int)screen.size() - 5);
+	if (gray != plain)
+		return false;
+
+	static const int sizes[][2] = { { _OBSERVATION_W, _OBSERVATION_H }, { _SCREEN_W, _SCREEN_H }, { 64, 48 }, { 37, 29 }, { 1, 1 } };
+	Observation o;
+	for (const auto& s : sizes)
+	{
+		o.configure(s[0], s[1], 1);
+		size_t frame = (size_t)o.width() * o.height();
+		std::vector<H_BYTE> a(frame), b(frame);
+		o.resize(gray.data(), a.data());
+		o.resize_plain(gray.data(), b.data());
+		if (a != b)
+			return false;
+
+		std::vector<float> fa(frame), fb(frame);
+		normalize(a.data(), fa.data(), frame);
+		normalize_plain(a.data(), fb.data(), frame);
+		if (fa != fb)
+			return false;
+	}
+	return true;
+}
+
+void Observation::build_taps(std::vector<TAP>& taps, int in, int out)
+{
+	// Output pixel i covers [i * step, (i + 1) * step) of input
+	double step = (double)in / out;
+	taps.assign(out, TAP());
+	for (int i = 0; i < out; i++)
+	{
+		double from = i * step;
+		double to   = std::min((double)in, from + step);
+		TAP& t = taps[i];
+		t.first = std::min(in - 1, (int)from);
+
+		int sum = 0;
+		for (int p = t.first; p < in && p < to; p++)
+		{
+			double cover = std::min(to, p + 1.0) - std::max(from, (double)p);
+			t.weight.push_back((H_WORD)std::lround(256.0 * cover / step));
+			sum += t.weight.back();
+		}
+
+		// Rounding is made up on the biggest one, so flat areas keep their value
+		auto biggest = std::max_element(t.weight.begin(), t.weight.end());
+		*biggest = (H_WORD)(*biggest + 256 - sum);
+	}
+}
\ No newline at end of file
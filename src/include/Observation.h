@@ -0,0 +1,84 @@
+#pragma once
+#define _OBSERVATION_W     84	// Default frame size
+#define _OBSERVATION_H     84
+#define _OBSERVATION_STACK 4	// Default number of stacked frames
+
+#include "core.h"
+
+#include <cstddef>
+#include <vector>
+
+class Screen;
+struct ScreenData;
+
+/*
+	Observation
+
+	Turns screen into input for learning agents. Every pushed frame is
+		- converted to grayscale, Y = (77 R + 150 G + 29 B) / 256, so CGB colors
+		  and DMG shades map the same way
+		- resized to configured size by area averaging, every output pixel is the
+		  mean of screen area it covers, weights are 8 bit fixed point
+		- put into ring of last K frames
+
+	read() writes the stack, oldest frame first, into buffer of caller as bytes
+	or as floats normalized to 0..1. Nothing is allocated after configure().
+
+	Grayscale, vertical pass of resize and normalization use SSE2 when
+	compiler targets it, there is plain C++ otherwise. Both give the same bytes,
+	check() compares them on random screens.
+*/
+class Observation
+{
+public:
+	Observation();
+
+	void configure(int width, int height, int stack);
+	void reset(); // Empties stack, next push fills all of it
+
+	void push(const Screen&);
+
+	void read(H_BYTE* out) const;	// stack x height x width
+	void read(float* out) const;	// Same, 0..1
+
+	inline int    width()  const { return m_width; }
+	inline int    height() const { return m_height; }
+	inline int    stack()  const { return m_stack; }
+	inline size_t size()   const { return (size_t)m_stack * m_width * m_height; }
+
+	// Kernels push is made of
+	static void grayscale(const Screen&, H_BYTE* out);		// _SCREEN_W x _SCREEN_H
+	void        resize(const H_BYTE* gray, H_BYTE* out);	// To width x height
+	static void normalize(const H_BYTE* in, float* out, size_t count);
+
+	// Plain C++ versions of kernels, built with SSE2 or not
+	static void grayscale_plain(const ScreenData* in, H_BYTE* out, int count);
+	void        resize_plain(const H_BYTE* gray, H_BYTE* out);
+	static void normalize_plain(const H_BYTE* in, float* out, size_t count);
+
+	static bool check();	// False if any kernel differs from its plain version
+
+private:
+	struct TAP
+	{
+		int first;					// First source pixel
+		std::vector<H_WORD> weight;	// One per source pixel, sum is 256
+	};
+
+	int m_width  = 0;
+	int m_height = 0;
+	int m_stack  = 0;
+
+	std::vector<TAP> m_columns;	// Per output column
+	std::vector<TAP> m_rows;	// Per output row
+
+	std::vector<H_BYTE> m_gray;		// Screen in grayscale
+	std::vector<H_BYTE> m_narrow;	// Resized horizontally
+	std::vector<H_BYTE> m_frames;	// Ring of m_stack frames
+	int m_newest = -1;				// Slot of last frame, -1 when empty
+
+	static void build_taps(std::vector<TAP>&, int in, int out);
+	static void grayscale(const ScreenData* in, H_BYTE* out, int count);
+	void        narrow(const H_BYTE* gray);							// Horizontal pass into m_narrow
+	void        vertical_plain(int y, int x, H_BYTE* out) const;	// Row y of output from column x on
+};
\ No newline at end of file
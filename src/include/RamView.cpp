@@ -0,0 +1,110 @@
+#include "RamView.h"
+#include "GameBoy.h"
+#include "Hash.h"
+
+#include <algorithm>
+
+// Addresses that only CPU writes to
+static const RamView::REGION RAM[] = { { 0xA000, 0xBFFF }, { 0xC000, 0xDFFF }, { 0xFF80, 0xFFFE } };
+
+RamView::RamView()
+{
+	m_dirty.fill(true);
+}
+
+void RamView::connect_device(GameBoy* instance)
+{
+	gb = instance;
+	select({ { 0xC000, 0xDFFF }, { 0xFF80, 0xFFFE } });
+}
+
+RamView::SPAN RamView::wram() const
+{
+	return { &gb->m_memory[0xC000], 0x2000, 0xC000 };
+}
+
+RamView::SPAN RamView::hram() const
+{
+	return { &gb->m_memory[0xFF80], 0x7F, 0xFF80 };
+}
+
+RamView::SPAN RamView::sram() const
+{
+	return { &gb->m_memory[0xA000], 0x2000, 0xA000 };
+}
+
+void RamView::invalidate_all()
+{
+	m_dirty.fill(true);
+}
+
+void RamView::select(const std::vector<REGION>& regions)
+{
+	// Every address once, cut to RAM
+	std::vector<bool> selected(0x10000, false);
+	for (const REGION& r : regions)
+		for (const REGION& ram : RAM)
+		{
+			int first = std::max<int>(r.first, ram.first);
+			int last  = std::min<int>(r.last, ram.last);
+			for (int addr = first; addr <= last; addr++)
+				selected[addr] = true;
+		}
+
+	m_regions.clear();
+	m_runs.clear();
+	m_pages.clear();
+	m_page_run.clear();
+	for (int addr = 0; addr < 0x10000;)
+	{
+		if (!selected[addr])
+		{
+			addr++;
+			continue;
+		}
+		int end = addr;
+		while (end < 0x10000 && selected[end])
+			end++;
+		m_regions.push_back({ (H_WORD)addr, (H_WORD)(end - 1) });
+
+		// Runs don't cross page ends, so every page rehashes only its own bytes
+		while (addr < end)
+		{
+			int page = addr >> _RAMVIEW_PAGE_BITS;
+			int stop = std::min(end, (page + 1) << _RAMVIEW_PAGE_BITS);
+			if (m_pages.empty() || m_pages.back() != page)
+			{
+				m_pages.push_back(page);
+				m_page_run.push_back((int)m_runs.size());
+			}
+			m_runs.push_back({ (H_WORD)addr, (H_WORD)(stop - addr), 0 });
+			addr = stop;
+		}
+	}
+	m_page_run.push_back((int)m_runs.size());
+
+	m_hash = 0;
+	for (int page : m_pages)
+		m_dirty[page] = true;
+}
+
+H_QWORD RamView::hash()
+{
+	const H_BYTE* memory = gb->m_memory.data();
+	for (size_t i = 0; i < m_pages.size(); i++)
+	{
+		int page = m_pages[i];
+		if (!m_dirty[page])
+			continue;
+		m_dirty[page] = false;
+
+		for (int r = m_page_run[i]; r < m_page_run[i + 1]; r++)
+		{
+			RUN& run = m_runs[r];
+			m_hash -= run.hash;
+			run.hash = Hash::xxh64(memory + run.first, run.size, run.first);
+			m_hash += run.hash;
+		}
+	}
+	return m_hash;
+}
\ No newline at end of file
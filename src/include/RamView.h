@@ -0,0 +1,95 @@
+#pragma once
+#define _RAMVIEW_PAGE_BITS 6	// 64 byte pages
+#define _RAMVIEW_PAGES     (0x10000 >> _RAMVIEW_PAGE_BITS)
+
+#include "core.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+class GameBoy;
+
+/*
+	RAM View
+
+	Read-only access to game RAM for agents that observe it, and 64-bit
+	hash of chosen parts of it for novelty search.
+
+	Spans point straight into memory of GameBoy, nothing is copied, and stay
+	valid as long as instance lives. Their bytes change as emulation runs.
+	On CGB D000-DFFF is the WRAM bank mapped now.
+
+	Hash is the sum of XXH64 of every selected run of bytes within a 64 byte
+	page, seeded with its address. Writes mark their page dirty, same as in
+	TileCache, and hash() rehashes only selected pages that are dirty, so
+	a step that touched few bytes costs few pages, not whole RAM. Hash of
+	the same bytes is the same in every instance and every run.
+
+	Only RAM can be selected: cartridge RAM A000-BFFF, WRAM C000-DFFF and
+	HRAM FF80-FFFE. Other addresses change without CPU writes.
+*/
+class RamView
+{
+public:
+	struct SPAN
+	{
+		const H_BYTE* data;
+		size_t        size;
+		H_WORD        address;	// Of data[0]
+
+		inline const H_BYTE* begin() const { return data; }
+		inline const H_BYTE* end()   const { return data + size; }
+		inline H_BYTE operator[](size_t i) const { return data[i]; }
+	};
+
+	struct REGION
+	{
+		H_WORD first;
+		H_WORD last;	// Inclusive
+	};
+
+	RamView();
+
+	void connect_device(GameBoy* instance);
+
+	SPAN wram() const;	// C000-DFFF
+	SPAN hram() const;	// FF80-FFFE
+	SPAN sram() const;	// A000-BFFF, cartridge RAM bank mapped now
+
+	// Called on every write
+	inline void invalidate(H_WORD addr)
+	{
+		m_dirty[addr >> _RAMVIEW_PAGE_BITS] = true;
+	}
+	// Called on bulk writes, first to last inclusive
+	inline void invalidate(H_WORD first, H_WORD last)
+	{
+		for (int i = first >> _RAMVIEW_PAGE_BITS; i <= last >> _RAMVIEW_PAGE_BITS; i++)
+			m_dirty[i] = true;
+	}
+	void invalidate_all();
+
+	// Regions hash() covers, WRAM and HRAM unless told otherwise
+	void select(const std::vector<REGION>&);
+	inline const std::vector<REGION>& selected() const { return m_regions; }
+
+	H_QWORD hash();	// Rehashes dirty pages
+
+private:
+	struct RUN
+	{
+		H_WORD  first;
+		H_WORD  size;
+		H_QWORD hash;
+	};
+
+	GameBoy* gb = nullptr;
+
+	std::array<bool, _RAMVIEW_PAGES> m_dirty;
+	std::vector<REGION> m_regions;
+	std::vector<RUN>    m_runs;		// Selected bytes split at page ends, by address
+	std::vector<int>    m_pages;	// Selected pages
+	std::vector<int>    m_page_run;	// First run of every selected page, then end of runs
+	H_QWORD m_hash = 0;
+};
\ No newline at end of file
@@ -0,0 +1,340 @@
+#include "Recompiler.h"
+#include "CodeDataLogger.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <iostream>
+#include <string>
+
+RecompiledRegistrar::RecompiledRegistrar(const RecompiledROM* rom)
+{
+	Recompiler::registry().push_back(rom);
+}
+
+std::vector<const RecompiledROM*>& Recompiler::registry()
+{
+	// Function static, generated files register from static initializers of other units
+	static std::vector<const RecompiledROM*> roms;
+	return roms;
+}
+
+// FNV-1a of 0000-7FFF window, same bytes CPU sees
+H_DWORD Recompiler::hash(const H_BYTE* rom, size_t size)
+{
+	H_DWORD h = 2166136261u;
+	for (size_t i = 0; i < std::min<size_t>(size, 0x8000); i++)
+		h = (h ^ rom[i]) * 16777619u;
+	return h;
+}
+
+bool Recompiler::install(CPUZ80& cpu, const H_BYTE* rom, size_t size)
+{
+	H_DWORD h = hash(rom, size);
+	for (const RecompiledROM* r : registry())
+	{
+		if (r->hash != h)
+			continue;
+
+		std::vector<CPUZ80::BLOCK> table(0x8000, nullptr);
+		for (size_t i = 0; i < r->count; i++)
+			table[r->blocks[i].addr] = r->blocks[i].run;
+		cpu.set_blocks(std::move(table));
+
+		std::cout << "Recompiled blocks loaded: " << r->count << " (" << r->title << ")" << std::endl;
+		return true;
+	}
+
+	cpu.set_blocks({});
+	return false;
+}
+
+#define _RECOMPILER_NAME(f) { &CPUZ80::f, #f }
+
+const char* Recompiler::data_name(void (CPUZ80::* func)(void))
+{
+	static const struct { void (CPUZ80::* func)(void); const char* name; } names[] =
+	{
+		_RECOMPILER_NAME(dimm_8),  _RECOMPILER_NAME(da),      _RECOMPILER_NAME(db),     _RECOMPILER_NAME(dc),
+		_RECOMPILER_NAME(dd),      _RECOMPILER_NAME(de),      _RECOMPILER_NAME(dh),     _RECOMPILER_NAME(dl),
+		_RECOMPILER_NAME(b0),      _RECOMPILER_NAME(b1),      _RECOMPILER_NAME(b2),     _RECOMPILER_NAME(b3),
+		_RECOMPILER_NAME(b4),      _RECOMPILER_NAME(b5),      _RECOMPILER_NAME(b6),     _RECOMPILER_NAME(b7),
+		_RECOMPILER_NAME(mimm_16), _RECOMPILER_NAME(mbc),     _RECOMPILER_NAME(mde),    _RECOMPILER_NAME(mhl),
+		_RECOMPILER_NAME(mFF00c),  _RECOMPILER_NAME(mFF00n),  _RECOMPILER_NAME(dimm_16),_RECOMPILER_NAME(daf),
+		_RECOMPILER_NAME(dbc),     _RECOMPILER_NAME(dde),     _RECOMPILER_NAME(dhl),    _RECOMPILER_NAME(dsp),
+		_RECOMPILER_NAME(dspn),    _RECOMPILER_NAME(dnop)
+	};
+	for (const auto& n : names)
+		if (n.func == func)
+			return n.name;
+	return nullptr;
+}
+
+const char* Recompiler::op_name(void (CPUZ80::* func)(void))
+{
+	static const struct { void (CPUZ80::* func)(void); const char* name; } names[] =
+	{
+		_RECOMPILER_NAME(LD_A),      _RECOMPILER_NAME(LD_B),     _RECOMPILER_NAME(LD_C),     _RECOMPILER_NAME(LD_D),
+		_RECOMPILER_NAME(LD_E),      _RECOMPILER_NAME(LD_H),     _RECOMPILER_NAME(LD_L),     _RECOMPILER_NAME(LDD_A),
+		_RECOMPILER_NAME(LDI_A),     _RECOMPILER_NAME(LD_BC),    _RECOMPILER_NAME(LD_DE),    _RECOMPILER_NAME(LD_HL),
+		_RECOMPILER_NAME(LD_SP),     _RECOMPILER_NAME(LDHL),     _RECOMPILER_NAME(PUSH),     _RECOMPILER_NAME(POP),
+		_RECOMPILER_NAME(LD_M_BC),   _RECOMPILER_NAME(LD_M_DE),  _RECOMPILER_NAME(LD_M_HL),  _RECOMPILER_NAME(LD_M_NN),
+		_RECOMPILER_NAME(LD_M_FFFOC),_RECOMPILER_NAME(LDD_M_HL), _RECOMPILER_NAME(LDI_M_HL), _RECOMPILER_NAME(LDH_M),
+		_RECOMPILER_NAME(ADD_A),     _RECOMPILER_NAME(ADC),      _RECOMPILER_NAME(SUB),      _RECOMPILER_NAME(SBC),
+		_RECOMPILER_NAME(AND),       _RECOMPILER_NAME(OR),       _RECOMPILER_NAME(XOR),      _RECOMPILER_NAME(CP),
+		_RECOMPILER_NAME(INC_8),     _RECOMPILER_NAME(DEC_8),    _RECOMPILER_NAME(ADD_HL),   _RECOMPILER_NAME(ADD_SP),
+		_RECOMPILER_NAME(INC_16),    _RECOMPILER_NAME(DEC_16),   _RECOMPILER_NAME(SWAP),     _RECOMPILER_NAME(DAA),
+		_RECOMPILER_NAME(CPL),       _RECOMPILER_NAME(CCF),      _RECOMPILER_NAME(SCF),      _RECOMPILER_NAME(NOP),
+		_RECOMPILER_NAME(HALT),      _RECOMPILER_NAME(STOP),     _RECOMPILER_NAME(DI),       _RECOMPILER_NAME(EI),
+		_RECOMPILER_NAME(RLCA),      _RECOMPILER_NAME(RLA),      _RECOMPILER_NAME(RRCA),     _RECOMPILER_NAME(RRA),
+		_RECOMPILER_NAME(RLC),       _RECOMPILER_NAME(RL),       _RECOMPILER_NAME(RRC),      _RECOMPILER_NAME(RR),
+		_RECOMPILER_NAME(SLA),       _RECOMPILER_NAME(SRA),      _RECOMPILER_NAME(SRL),
+		_RECOMPILER_NAME(BIT_A),     _RECOMPILER_NAME(BIT_B),    _RECOMPILER_NAME(BIT_C),    _RECOMPILER_NAME(BIT_D),
+		_RECOMPILER_NAME(BIT_E),     _RECOMPILER_NAME(BIT_H),    _RECOMPILER_NAME(BIT_L),    _RECOMPILER_NAME(BIT_M_HL),
+		_RECOMPILER_NAME(SET_A),     _RECOMPILER_NAME(SET_B),    _RECOMPILER_NAME(SET_C),    _RECOMPILER_NAME(SET_D),
+		_RECOMPILER_NAME(SET_E),     _RECOMPILER_NAME(SET_H),    _RECOMPILER_NAME(SET_L),    _RECOMPILER_NAME(SET_M_HL),
+		_RECOMPILER_NAME(RES_A),     _RECOMPILER_NAME(RES_B),    _RECOMPILER_NAME(RES_C),    _RECOMPILER_NAME(RES_D),
+		_RECOMPILER_NAME(RES_E),     _RECOMPILER_NAME(RES_H),    _RECOMPILER_NAME(RES_L),    _RECOMPILER_NAME(RES_M_HL),
+		_RECOMPILER_NAME(JP),        _RECOMPILER_NAME(JPNZ),     _RECOMPILER_NAME(JPZ),      _RECOMPILER_NAME(JPNC),
+		_RECOMPILER_NAME(JPC),       _RECOMPILER_NAME(JR),       _RECOMPILER_NAME(JRNZ),     _RECOMPILER_NAME(JRZ),
+		_RECOMPILER_NAME(JRNC),      _RECOMPILER_NAME(JRC),
+		_RECOMPILER_NAME(CALL),      _RECOMPILER_NAME(CALL_NZ),  _RECOMPILER_NAME(CALL_Z),   _RECOMPILER_NAME(CALL_NC),
+		_RECOMPILER_NAME(CALL_C),
+		_RECOMPILER_NAME(RST_00),    _RECOMPILER_NAME(RST_08),   _RECOMPILER_NAME(RST_10),   _RECOMPILER_NAME(RST_18),
+		_RECOMPILER_NAME(RST_20),    _RECOMPILER_NAME(RST_28),   _RECOMPILER_NAME(RST_30),   _RECOMPILER_NAME(RST_38),
+		_RECOMPILER_NAME(RET),       _RECOMPILER_NAME(RET_NZ),   _RECOMPILER_NAME(RET_Z),    _RECOMPILER_NAME(RET_NC),
+		_RECOMPILER_NAME(RET_C),     _RECOMPILER_NAME(RETI)
+	};
+	for (const auto& n : names)
+		if (n.func == func)
+			return n.name;
+	return nullptr;
+}
+
+// Length follows what interpreter does with PC, CPU_LOG_COVERAGE counts it the same way
+Recompiler::DECODED Recompiler::decode(const CPUZ80& cpu, const H_BYTE* rom, size_t size, H_WORD addr) const
+{
+	typedef CPUZ80 h;
+
+	DECODED d;
+	size_t limit = std::min<size_t>(size, 0x8000);
+	const CPUZ80::INSTRUCTION& in = cpu.opcodes[rom[addr]];
+
+	if (in.data_func == &h::dimm_8 || in.data_func == &h::mFF00n || in.data_func == &h::dspn)
+		d.length = 2;
+	else if (in.data_func == &h::dimm_16 || in.data_func == &h::mimm_16)
+		d.length = 3;
+	else
+		d.length = 1;
+
+	if (in.op_func == &h::LD_M_NN)
+		d.length += 2;
+	else if (in.op_func == &h::LDH_M || in.op_func == &h::PREFIX)
+		d.length += 1;
+
+	d.known = (in.op_func == &h::PREFIX || op_name(in.op_func) != nullptr) && data_name(in.data_func) != nullptr &&
+		addr + d.length <= limit;
+	if (!d.known)
+		return d;
+
+	if (in.op_func == &h::PREFIX)
+	{
+		const CPUZ80::INSTRUCTION& cb = cpu.prefixes[rom[addr + 2]];
+		d.known = op_name(cb.op_func) != nullptr && data_name(cb.data_func) != nullptr;
+		d.falls = true;
+		return d;
+	}
+
+	auto imm16 = [&]() { return rom[addr + 1] | (rom[addr + 2] << 8); };
+	auto rel8  = [&]() { return (H_WORD)(addr + 2 + (H_S_BYTE)rom[addr + 1]); };
+
+	auto f = in.op_func;
+	if (f == &h::JP || f == &h::JPNZ || f == &h::JPZ || f == &h::JPNC || f == &h::JPC)
+	{
+		d.stop   = true;
+		d.falls  = f != &h::JP;
+		d.target = in.data_func == &h::dimm_16 ? imm16() : -1; // JP (HL) is indirect
+	}
+	else if (f == &h::JR || f == &h::JRNZ || f == &h::JRZ || f == &h::JRNC || f == &h::JRC)
+	{
+		d.stop   = true;
+		d.falls  = f != &h::JR;
+		d.target = rel8();
+	}
+	else if (f == &h::CALL || f == &h::CALL_NZ || f == &h::CALL_Z || f == &h::CALL_NC || f == &h::CALL_C)
+	{
+		d.stop   = true;
+		d.falls  = true;
+		d.target = imm16();
+	}
+	else if (f == &h::RST_00 || f == &h::RST_08 || f == &h::RST_10 || f == &h::RST_18 ||
+	         f == &h::RST_20 || f == &h::RST_28 || f == &h::RST_30 || f == &h::RST_38)
+	{
+		d.stop   = true;
+		d.falls  = true;
+		d.target = rom[addr] & 0x38;
+	}
+	else if (f == &h::RET || f == &h::RETI)
+		d.stop = true;
+	else if (f == &h::RET_NZ || f == &h::RET_Z || f == &h::RET_NC || f == &h::RET_C || f == &h::HALT || f == &h::STOP)
+	{
+		d.stop  = true;
+		d.falls = true;
+	}
+	else
+		d.falls = true;
+
+	return d;
+}
+
+bool Recompiler::translate(const CPUZ80& cpu, const H_BYTE* rom, size_t size, const CodeDataLogger* coverage, const char* path)
+{
+	size_t limit = std::min<size_t>(size, 0x8000);
+	std::vector<bool> leader(limit, false), instruction(limit, false);
+	std::vector<size_t> work;
+
+	auto push = [&](int addr) { if (addr >= 0 && (size_t)addr < limit && !leader[addr]) work.push_back(addr); };
+
+	// Reset, RST and interrupt vectors
+	push(0x0100);
+	for (int v = 0x00; v <= 0x60; v += 0x08)
+		push(v);
+
+	// Follows every block to blocks it branches or falls to
+	auto walk = [&]()
+	{
+		while (!work.empty())
+		{
+			size_t start = work.back();
+			work.pop_back();
+			if (leader[start])
+				continue;
+			leader[start] = true;
+
+			size_t addr = start;
+			for (int n = 1; ; n++)
+			{
+				DECODED d = decode(cpu, rom, size, (H_WORD)addr);
+				if (!d.known)
+					break;
+
+				instruction[addr] = true;
+				push(d.target);
+				if (d.stop)
+				{
+					if (d.falls)
+						push((int)(addr + d.length));
+					break;
+				}
+
+				addr += d.length;
+				if (n == _RECOMPILER_BLOCK_MAX)
+				{
+					push((int)addr);
+					break;
+				}
+			}
+		}
+	};
+	walk();
+
+	// Coverage adds code only indirect jumps reach. Executed instruction no block
+	// contains yet starts a new one
+	if (coverage != nullptr)
+		for (size_t addr = 0; addr < limit; addr++)
+			if ((coverage->flags((H_WORD)addr) & CodeDataLogger::CDL_OPCODE) && !instruction[addr])
+			{
+				push((int)addr);
+				walk();
+			}
+
+	size_t count = std::count(leader.begin(), leader.end(), true);
+	if (count == 0)
+	{
+		std::cerr << "Recompiler found no code" << std::endl;
+		return false;
+	}
+
+	FILE* pFile = fopen(path, "w");
+	if (pFile == nullptr)
+	{
+		std::cerr << "Recompiler output failure: " << path << std::endl;
+		return false;
+	}
+
+	std::string title;
+	for (size_t i = 0x134; i < 0x144 && i < limit && rom[i] >= 0x20 && rom[i] < 0x7F; i++)
+		title += rom[i] == '"' || rom[i] == '\\' ? '_' : (char)rom[i];
+
+	H_DWORD h = hash(rom, size);
+	fprintf(pFile, "// Recompiled code of \"%s\", ROM hash $%08X. Generated by hadron --recompile, do not edit\n", title.c_str(), h);
+	fprintf(pFile, "#include \"include/Recompiler.h\"\n\n");
+	fprintf(pFile, "template<>\nstruct Recompiled<0x%08Xu>\n{\n", h);
+
+	std::vector<H_WORD> entries;
+	for (size_t start = 0; start < limit; start++)
+	{
+		if (!leader[start] || !decode(cpu, rom, size, (H_WORD)start).known)
+			continue;
+		entries.push_back((H_WORD)start);
+
+		// Instructions of block first, their bytes are checked on entry
+		std::vector<std::pair<H_WORD, DECODED>> list;
+		size_t addr = start;
+		for (int n = 1; ; n++)
+		{
+			DECODED d = decode(cpu, rom, size, (H_WORD)addr);
+			if (!d.known)
+				break;
+			list.push_back({ (H_WORD)addr, d });
+			addr += d.length;
+			if (d.stop || n == _RECOMPILER_BLOCK_MAX)
+				break;
+		}
+
+		fprintf(pFile, "\tstatic bool block_%04X(CPUZ80& cpu, H_QWORD end)\n\t{\n", (unsigned)start);
+		fprintf(pFile, "\t\tstatic const H_BYTE code[] = {");
+		for (size_t i = start; i < addr; i++)
+			fprintf(pFile, "%s0x%02X", i == start ? " " : ", ", rom[i]);
+		fprintf(pFile, " };\n");
+		fprintf(pFile, "\t\tif (!cpu.block_valid(0x%04X, code, sizeof(code)))\n\t\t\treturn false;\n", (unsigned)start);
+
+		for (size_t i = 0; i < list.size(); i++)
+		{
+			H_WORD at = list[i].first;
+			const DECODED& d = list[i].second;
+			const CPUZ80::INSTRUCTION& in = cpu.opcodes[rom[at]];
+
+			fprintf(pFile, "\n\t\t// $%04X: %s\n", at, in.name.c_str());
+			fprintf(pFile, "\t\tif (!cpu.block_begin(0x%02X, %d, end)) return true;\n", rom[at], in.cycles);
+			fprintf(pFile, "\t\tcpu.%s();\n", data_name(in.data_func));
+			if (in.op_func == &CPUZ80::PREFIX)
+			{
+				// Inlined PREFIX, second byte was read by dimm_8 and the third selects instruction
+				const CPUZ80::INSTRUCTION& cb = cpu.prefixes[rom[at + 2]];
+				fprintf(pFile, "\t\tcpu.block_prefix(0x%02X, %d); // %s\n", rom[at + 2], cb.cycles, cb.name.c_str());
+				fprintf(pFile, "\t\tcpu.%s();\n", data_name(cb.data_func));
+				fprintf(pFile, "\t\tcpu.%s();\n", op_name(cb.op_func));
+			}
+			else
+				fprintf(pFile, "\t\tcpu.%s();\n", op_name(in.op_func));
+
+			if (i + 1 < list.size())
+				fprintf(pFile, "\t\tif (!cpu.block_end(0x%04X)) return true;\n", (unsigned)(at + d.length));
+			else
+				fprintf(pFile, "\t\tcpu.block_tick();\n\t\treturn true;\n");
+		}
+		fprintf(pFile, "\t}\n\n");
+	}
+
+	fprintf(pFile, "\tstatic const RecompiledBlock blocks[];\n};\n\n");
+	fprintf(pFile, "const RecompiledBlock Recompiled<0x%08Xu>::blocks[] =\n{\n", h);
+	for (H_WORD e : entries)
+		fprintf(pFile, "\t{ 0x%04X, &Recompiled<0x%08Xu>::block_%04X },\n", e, h, e);
+	fprintf(pFile, "};\n\n");
+	fprintf(pFile, "static const RecompiledROM rom_%08X = { 0x%08Xu, \"%s\", Recompiled<0x%08Xu>::blocks, %zu };\n", h, h, title.c_str(), h, entries.size());
+	fprintf(pFile, "static RecompiledRegistrar registrar_%08X(&rom_%08X);\n", h, h);
+	fclose(pFile);
+
+	std::cout << "Recompiled " << entries.size() << " blocks to " << path << std::endl;
+	return true;
+}
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+#define _RECOMPILER_BLOCK_MAX 64 // Instructions in one block, longer runs are split
+
+#include "core.h"
+#include "CPUZ80.h"
+
+#include <cstddef>
+#include <vector>
+
+class CodeDataLogger;
+
+/*
+	Static Recompiler
+
+	Offline tool that translates reachable ROM code of one title to C++.
+	Every basic block becomes a function which does exactly what interpreter
+	would do for its instructions, with operands and opcode table lookups
+	resolved at translation time
+		1. Same data and instruction functions of CPUZ80 are called directly
+		2. Every cycle still goes through the same timer, LCD and interrupt code,
+		   an interrupt taken in the middle leaves the block
+		3. On entry block checks that memory still holds code it was made from,
+		   if not (self-modifying code, data written over ROM) interpreter runs it
+
+	Code is found by following branches from reset and interrupt vectors.
+	Code/Data Logger file of earlier runs adds what only indirect jumps reach.
+	Everything else, RAM code included, stays interpreted.
+
+	Generated file is compiled together with emulator. It registers itself by
+	hash of ROM and is installed when that ROM is loaded
+		hadron game.gb --cdl game.cdl --recompile src/recompiled_game.cpp
+*/
+
+// Generated file registers one of these, see translate()
+struct RecompiledBlock
+{
+	H_WORD        addr;
+	CPUZ80::BLOCK run;
+};
+struct RecompiledROM
+{
+	H_DWORD                hash;	// Of the 0000-7FFF window
+	const char*            title;
+	const RecompiledBlock* blocks;
+	size_t                 count;
+};
+struct RecompiledRegistrar
+{
+	RecompiledRegistrar(const RecompiledROM*);
+};
+
+class Recompiler
+{
+	friend struct RecompiledRegistrar;
+
+public:
+	// Writes C++ source for ROM. Coverage is Code/Data Logger with banks of translated window mapped, may be null
+	bool translate(const CPUZ80&, const H_BYTE* rom, size_t size, const CodeDataLogger* coverage, const char* path);
+
+	// Looks for built in code of ROM and installs it to CPU
+	static bool install(CPUZ80&, const H_BYTE* rom, size_t size);
+
+	static H_DWORD hash(const H_BYTE* rom, size_t size);
+
+private:
+	struct DECODED
+	{
+		H_BYTE length = 0;
+		bool   known  = false;	// Not one of the holes in opcode table
+		bool   stop   = false;	// Ends block
+		bool   falls  = false;	// Next instruction can follow it
+		int    target = -1;		// Static branch target
+	};
+	DECODED decode(const CPUZ80&, const H_BYTE* rom, size_t size, H_WORD addr) const;
+
+	static const char* data_name(void (CPUZ80::*)(void));
+	static const char* op_name(void (CPUZ80::*)(void));
+
+	static std::vector<const RecompiledROM*>& registry();
+};
\ No newline at end of file
@@ -0,0 +1,220 @@
+#include "Recorder.h"
+#include "GameBoy.h"
+
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <vector>
+
+Recorder::~Recorder()
+{
+	stop();
+}
+
+bool Recorder::start(const char* video, const char* audio)
+{
+	stop();
+
+	if (video != nullptr)
+	{
+		m_video = fopen(video, "wb");
+		if (m_video == nullptr)
+		{
+			std::cerr << "Video record failure: " << video << std::endl;
+			return false;
+		}
+		setvbuf(m_video, nullptr, _IOFBF, _RECORDER_BUFFER);
+
+		std::string name(video);
+		m_y4m = name.size() >= 4 && name.compare(name.size() - 4, 4, ".y4m") == 0;
+		if (m_y4m)
+			fprintf(m_video, "YUV4MPEG2 W%d H%d F%d:%d Ip A1:1 C444\n", _SCREEN_W, _SCREEN_H, CLOCKSPEED, FRAME_CYCLES);
+
+		m_frames  = std::make_unique<SPSCQueue<FRAME, _RECORDER_FRAMES>>();
+		m_staging = std::make_unique<FRAME>();
+		m_pending = std::make_unique<FRAME>();
+	}
+
+	if (audio != nullptr)
+	{
+		m_rate = gb->apu.sample_rate();
+		if (m_rate == 0)
+		{
+			std::cerr << "Audio record failure: sound is off" << std::endl;
+			stop();
+			return false;
+		}
+
+		m_audio = fopen(audio, "wb");
+		if (m_audio == nullptr)
+		{
+			std::cerr << "Audio record failure: " << audio << std::endl;
+			stop();
+			return false;
+		}
+		setvbuf(m_audio, nullptr, _IOFBF, _RECORDER_BUFFER);
+
+		// Sizes are not known yet, header is written again on stop
+		m_audio_bytes = 0;
+		write_wav_header();
+
+		m_samples = std::make_unique<SPSCQueue<H_S_WORD, _RECORDER_SAMPLES * 2>>();
+
+		// Device output is rate controlled, AudioOutput passes fixed ratio tap instead
+		gb->apu.set_tap(gb->audio.opened());
+	}
+
+	m_dropped_frames  = 0;
+	m_dropped_samples = 0;
+	m_stop = false;
+	if (m_video != nullptr || m_audio != nullptr)
+		m_writer = std::thread(&Recorder::write, this);
+	return true;
+}
+
+void Recorder::stop()
+{
+	if (m_writer.joinable())
+	{
+		m_stop = true;
+		m_writer.join();
+
+		if (m_dropped_frames != 0 || m_dropped_samples != 0)
+			std::cerr << "Recorder dropped " << m_dropped_frames << " frames and "
+			          << m_dropped_samples << " samples" << std::endl;
+	}
+
+	if (m_video != nullptr)
+	{
+		fclose(m_video);
+		m_video = nullptr;
+	}
+	if (m_audio != nullptr)
+	{
+		write_wav_header();
+		fclose(m_audio);
+		m_audio = nullptr;
+	}
+
+	if (m_samples != nullptr)
+		gb->apu.set_tap(false);
+	m_frames.reset();
+	m_samples.reset();
+	m_staging.reset();
+	m_pending.reset();
+}
+
+void Recorder::frame()
+{
+	if (m_frames == nullptr)
+		return;
+
+	// Full ring means writer is behind, frame is skipped rather than waited for
+	gb->screen.save(m_staging->data());
+	if (!m_frames->push(*m_staging))
+		m_dropped_frames++;
+}
+
+void Recorder::samples(const H_S_WORD* data, size_t count)
+{
+	if (m_samples == nullptr)
+		return;
+
+	size_t pushed = m_samples->push(data, count * 2) / 2;
+	m_dropped_samples += count - pushed;
+}
+
+void Recorder::write()
+{
+	while (!m_stop)
+	{
+		if (!drain())
+			std::this_thread::sleep_for(std::chrono::milliseconds(5));
+	}
+
+	// What was queued before stop still goes to disk
+	while (drain());
+}
+
+bool Recorder::drain()
+{
+	bool any = false;
+
+	if (m_frames != nullptr)
+	{
+		while (m_frames->pop(*m_pending))
+		{
+			write_frame(*m_pending);
+			any = true;
+		}
+	}
+
+	if (m_samples != nullptr)
+	{
+		H_S_WORD chunk[8192];
+		size_t count;
+		while ((count = m_samples->pop(chunk, 8192)) != 0)
+		{
+			// WAV is little endian like every host this runs on
+			fwrite(chunk, sizeof(H_S_WORD), count, m_audio);
+			m_audio_bytes += count * sizeof(H_S_WORD);
+			any = true;
+		}
+	}
+
+	return any;
+}
+
+void Recorder::write_frame(const FRAME& frame)
+{
+	const int pixels = _SCREEN_W * _SCREEN_H;
+
+	if (!m_y4m)
+	{
+		// Screen colors are already R, G, B, A in memory
+		fwrite(frame.data(), sizeof(H_DWORD), pixels, m_video);
+		return;
+	}
+
+	// BT.601 limited range, what players assume for Y4M without color tags
+	m_yuv.resize(pixels * 3);
+	H_BYTE* y = m_yuv.data();
+	H_BYTE* u = y + pixels;
+	H_BYTE* v = u + pixels;
+	for (int i = 0; i < pixels; i++)
+	{
+		Color c(frame[i]);
+		y[i] = (H_BYTE)((( 66 * c.r + 129 * c.g +  25 * c.b + 128) >> 8) +  16);
+		u[i] = (H_BYTE)(((-38 * c.r -  74 * c.g + 112 * c.b + 128) >> 8) + 128);
+		v[i] = (H_BYTE)(((112 * c.r -  94 * c.g -  18 * c.b + 128) >> 8) + 128);
+	}
+
+	fwrite("FRAME\n", 1, 6, m_video);
+	fwrite(m_yuv.data(), 1, m_yuv.size(), m_video);
+}
+
+void Recorder::write_wav_header()
+{
+	auto put16 = [](H_BYTE* p, H_WORD v)  { p[0] = v & 0xFF; p[1] = v >> 8; };
+	auto put32 = [](H_BYTE* p, H_DWORD v) { for (int i = 0; i < 4; i++) p[i] = (v >> (i * 8)) & 0xFF; };
+
+	H_BYTE header[44];
+	H_DWORD data = (H_DWORD)std::min<H_QWORD>(m_audio_bytes, 0xFFFFFFFF - 36);
+
+	memcpy(header, "RIFF", 4);
+	put32(header + 4, 36 + data);
+	memcpy(header + 8, "WAVEfmt ", 8);
+	put32(header + 16, 16);				// fmt chunk size
+	put16(header + 20, 1);				// PCM
+	put16(header + 22, 2);				// Channels
+	put32(header + 24, m_rate);
+	put32(header + 28, m_rate * 4);		// Bytes per second
+	put16(header + 32, 4);				// Bytes per frame
+	put16(header + 34, 16);				// Bits per sample
+	memcpy(header + 36, "data", 4);
+	put32(header + 40, data);
+
+	fseek(m_audio, 0, SEEK_SET);
+	fwrite(header, 1, sizeof(header), m_audio);
+	fseek(m_audio, 0, SEEK_END);
+}
\ No newline at end of file
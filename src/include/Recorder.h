@@ -0,0 +1,79 @@
+#pragma once
+#define _RECORDER_FRAMES  64      // Frames ring can hold, about a second
+#define _RECORDER_SAMPLES 131072  // Stereo frames of audio ring, power of two
+#define _RECORDER_BUFFER  (1 << 20) // Stream buffer of every output file
+
+#include "core.h"
+#include "Screen.h"
+#include "SPSCQueue.h"
+
+#include <array>
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <thread>
+#include <vector>
+
+class GameBoy;
+
+/*
+	Recorder
+
+	Captures video as Y4M or raw RGBA and audio as WAV.
+
+	Emulation thread only copies a finished frame or a batch of samples into
+	preallocated rings and goes on. Writer thread drains rings, converts
+	frames to output format and writes them in large sequential chunks.
+	If writer can't keep up rings get full and new data is dropped and
+	counted, emulation is never slowed down by disk.
+
+	Format of video follows file extension
+		.y4m   YUV 4:4:4 with frame rate of 4194304/70224, no chroma subsampling so pixels stay sharp
+		other  raw RGBA frames one after another, 160x144
+*/
+class Recorder
+{
+public:
+	~Recorder();
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	// Either path may be null. Audio is recorded at current APU rate
+	bool start(const char* video, const char* audio);
+	void stop();
+	inline bool recording() const { return m_writer.joinable(); }
+
+	void frame();								// Emulation thread, after every frame
+	void samples(const H_S_WORD*, size_t);		// Emulation thread, stereo frames APU made
+
+	inline H_QWORD dropped_frames()  const { return m_dropped_frames; }
+	inline H_QWORD dropped_samples() const { return m_dropped_samples; }
+
+private:
+	using FRAME = std::array<H_DWORD, _SCREEN_W * _SCREEN_H>;
+
+	GameBoy* gb = nullptr;
+
+	FILE* m_video = nullptr;
+	FILE* m_audio = nullptr;
+	bool  m_y4m = false;
+	int   m_rate = 0;
+	H_QWORD m_audio_bytes = 0;
+
+	// Rings are big, only allocated while recording
+	std::unique_ptr<SPSCQueue<FRAME, _RECORDER_FRAMES>>           m_frames;
+	std::unique_ptr<SPSCQueue<H_S_WORD, _RECORDER_SAMPLES * 2>>   m_samples;
+	std::unique_ptr<FRAME> m_staging;	// Frame being copied from screen
+	std::unique_ptr<FRAME> m_pending;	// Frame being written, writer thread only
+	std::vector<H_BYTE>    m_yuv;
+
+	std::thread       m_writer;
+	std::atomic<bool> m_stop{ false };
+	H_QWORD m_dropped_frames  = 0;
+	H_QWORD m_dropped_samples = 0;
+
+	void write();		// Writer thread
+	bool drain();		// Writes everything queued, false if there was nothing
+	void write_frame(const FRAME&);
+	void write_wav_header();
+};
\ No newline at end of file
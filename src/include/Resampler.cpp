@@ -0,0 +1,128 @@
+#include "Resampler.h"
+
+#include <algorithm>
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _RESAMPLER_SSE2
+#include <emmintrin.h>
+#endif
+
+static const double PI = 3.14159265358979323846;
+
+void Resampler::configure(double in_rate, double out_rate)
+{
+	m_base_step = in_rate / out_rate;
+	m_step = m_base_step;
+
+	// Cutoff relative to input rate, 90% of the lower Nyquist
+	double cutoff = 0.45 * std::min(1.0, out_rate / in_rate);
+
+	m_filter.assign(_RESAMPLER_PHASES * _RESAMPLER_TAPS, 0.0f);
+	for (int p = 0; p < _RESAMPLER_PHASES; p++)
+	{
+		float* taps = &m_filter[p * _RESAMPLER_TAPS];
+		double frac = (double)p / _RESAMPLER_PHASES;
+		double sum = 0.0;
+		for (int i = 0; i < _RESAMPLER_TAPS; i++)
+		{
+			// Distance from output position, which is frac after tap 15
+			double x = i - (_RESAMPLER_TAPS / 2 - 1) - frac;
+			double sinc = (x == 0.0) ? 1.0 : std::sin(2.0 * PI * cutoff * x) / (2.0 * PI * cutoff * x);
+			double window = 0.42 + 0.5 * std::cos(PI * x / (_RESAMPLER_TAPS / 2)) + 0.08 * std::cos(2.0 * PI * x / (_RESAMPLER_TAPS / 2));
+			taps[i] = (float)(sinc * window);
+			sum += taps[i];
+		}
+
+		// Unity gain at DC for every phase
+		for (int i = 0; i < _RESAMPLER_TAPS; i++)
+			taps[i] = (float)(taps[i] / sum);
+	}
+
+	clear();
+}
+
+void Resampler::clear()
+{
+	m_in[0].assign(_RESAMPLER_TAPS, 0.0f);
+	m_in[1].assign(_RESAMPLER_TAPS, 0.0f);
+	m_pos = 0.0;
+}
+
+void Resampler::set_adjust(double adjust)
+{
+	m_step = m_base_step / (1.0 + adjust);
+}
+
+void Resampler::write(const float* left, const float* right, size_t count)
+{
+	m_in[0].insert(m_in[0].end(), left, left + count);
+	m_in[1].insert(m_in[1].end(), right, right + count);
+}
+
+size_t Resampler::available() const
+{
+	double last = (double)m_in[0].size() - _RESAMPLER_TAPS;
+	if (last < m_pos)
+		return 0;
+	return (size_t)((last - m_pos) / m_step) + 1;
+}
+
+size_t Resampler::read(H_S_WORD* out, size_t count)
+{
+	count = std::min(count, available());
+
+	const float* left  = m_in[0].data();
+	const float* right = m_in[1].data();
+	for (size_t n = 0; n < count; n++)
+	{
+		size_t index = (size_t)m_pos;
+		int    phase = (int)((m_pos - index) * _RESAMPLER_PHASES);
+		const float* taps = &m_filter[phase * _RESAMPLER_TAPS];
+		const float* l = left + index;
+		const float* r = right + index;
+
+#ifdef _RESAMPLER_SSE2
+		__m128 acc_l = _mm_setzero_ps();
+		__m128 acc_r = _mm_setzero_ps();
+		for (int i = 0; i < _RESAMPLER_TAPS; i += 4)
+		{
+			__m128 h = _mm_loadu_ps(taps + i);
+			acc_l = _mm_add_ps(acc_l, _mm_mul_ps(_mm_loadu_ps(l + i), h));
+			acc_r = _mm_add_ps(acc_r, _mm_mul_ps(_mm_loadu_ps(r + i), h));
+		}
+
+		// Horizontal sums end up as L, R in the two low lanes
+		__m128 lo = _mm_unpacklo_ps(acc_l, acc_r);	// l0 r0 l1 r1
+		__m128 hi = _mm_unpackhi_ps(acc_l, acc_r);	// l2 r2 l3 r3
+		__m128 sum = _mm_add_ps(lo, hi);
+		sum = _mm_add_ps(sum, _mm_movehl_ps(sum, sum));
+
+		// Rounds and saturates to 16 bit
+		__m128i pcm = _mm_packs_epi32(_mm_cvtps_epi32(sum), _mm_setzero_si128());
+		*(H_DWORD*)(out + n * 2) = (H_DWORD)_mm_cvtsi128_si32(pcm);
+#else
+		float acc_l = 0.0f, acc_r = 0.0f;
+		for (int i = 0; i < _RESAMPLER_TAPS; i++)
+		{
+			acc_l += l[i] * taps[i];
+			acc_r += r[i] * taps[i];
+		}
+		out[n * 2]     = (H_S_WORD)std::max(-32768.0f, std::min(32767.0f, std::round(acc_l)));
+		out[n * 2 + 1] = (H_S_WORD)std::max(-32768.0f, std::min(32767.0f, std::round(acc_r)));
+#endif
+
+		m_pos += m_step;
+	}
+
+	// Input before current position is not needed anymore
+	size_t used = (size_t)m_pos;
+	if (used > 0)
+	{
+		m_in[0].erase(m_in[0].begin(), m_in[0].begin() + used);
+		m_in[1].erase(m_in[1].begin(), m_in[1].begin() + used);
+		m_pos -= used;
+	}
+
+	return count;
+}
\ No newline at end of file
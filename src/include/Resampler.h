@@ -0,0 +1,44 @@
+#pragma once
+#define _RESAMPLER_TAPS   32 // Filter length, multiple of 4
+#define _RESAMPLER_PHASES 64 // Fractional positions filter is precomputed for
+
+#include "core.h"
+
+#include <cstddef>
+#include <vector>
+
+/*
+	Resampler
+
+	Converts stereo float stream from one rate to another with polyphase
+	windowed-sinc low-pass filter. Filter is computed in advance for
+	_RESAMPLER_PHASES fractional positions between input samples, every
+	output sample takes the nearest one and is a dot product of
+	_RESAMPLER_TAPS input samples with it. Dot products use SSE2 when
+	compiler targets it.
+
+	Cutoff is set a bit below the lower of both Nyquist frequencies,
+	so nothing from above output Nyquist folds back as alias.
+
+	Ratio can be nudged while running, for rate control against audio device clock.
+*/
+class Resampler
+{
+public:
+	void configure(double in_rate, double out_rate);
+	void clear();
+
+	// Output rate becomes out_rate * (1 + adjust). Small values only, filter is not recomputed
+	void set_adjust(double adjust);
+
+	void   write(const float* left, const float* right, size_t count);	// Input samples
+	size_t available() const;											// Output frames that can be read
+	size_t read(H_S_WORD* out, size_t count);							// Interleaved stereo output frames
+
+private:
+	std::vector<float> m_filter;	// _RESAMPLER_PHASES x _RESAMPLER_TAPS
+	std::vector<float> m_in[2];		// Input not consumed yet
+	double m_pos  = 0.0;			// Position of next output sample in input
+	double m_step = 1.0;			// Input samples per output sample
+	double m_base_step = 1.0;
+};
\ No newline at end of file
@@ -0,0 +1,126 @@
+#include "Rewinder.h"
+#include "GameBoy.h"
+
+void Rewinder::enable(H_QWORD interval, size_t capacity)
+{
+	m_ring.clear();
+	m_ring.resize(capacity);
+	m_interval = interval;
+	m_enabled  = capacity > 0 && interval > 0;
+	clear();
+}
+
+void Rewinder::disable()
+{
+	m_ring.clear();
+	m_ring.shrink_to_fit();
+	m_enabled = false;
+	clear();
+}
+
+void Rewinder::clear()
+{
+	m_first = 0;
+	m_count = 0;
+	m_next  = 0;
+}
+
+void Rewinder::take_snapshot()
+{
+	SNAPSHOT* s;
+	if (m_count < m_ring.size())
+		s = &at(m_count++);
+	else
+	{
+		// Oldest snapshot is overwritten
+		s = &at(0);
+		m_first = (m_first + 1) % m_ring.size();
+	}
+
+	s->instruction = gb->cpu.instruction_count();
+	gb->save_state(s->state);
+	m_next = gb->cpu.cycle_count() + m_interval;
+}
+
+int Rewinder::find(H_QWORD instruction)
+{
+	for (int i = (int)m_count - 1; i >= 0; --i)
+		if (at(i).instruction <= instruction)
+			return i;
+	return -1;
+}
+
+void Rewinder::restore(size_t i, bool truncate)
+{
+	gb->load_state(at(i).state);
+	if (truncate)
+	{
+		// Replaying forward takes the same snapshots again
+		m_count = i + 1;
+		m_next  = at(i).state.cpu.clock_count + m_interval;
+	}
+}
+
+void Rewinder::replay(H_QWORD instruction)
+{
+	while (gb->cpu.instruction_count() < instruction)
+		gb->cpu.step();
+}
+
+bool Rewinder::seek(H_QWORD instruction)
+{
+	if (!m_enabled)
+		return false;
+
+	int i = find(instruction);
+	if (i < 0)
+		return false;
+
+	restore(i, true);
+	replay(instruction);
+	return true;
+}
+
+bool Rewinder::step_back()
+{
+	H_QWORD current = gb->cpu.instruction_count();
+	if (current == 0)
+		return false;
+	return seek(current - 1);
+}
+
+bool Rewinder::run_back(const std::function<bool(H_WORD)>& stop)
+{
+	if (!m_enabled)
+		return false;
+
+	const H_QWORD current = gb->cpu.instruction_count();
+	int i = find(current == 0 ? 0 : current - 1);
+	if (i < 0 || current == 0)
+		return false;
+
+	// Scan intervals from newest to oldest, each one ends where the previous scan started
+	m_replaying = true;
+	H_QWORD end = current;
+	bool found = false;
+	H_QWORD target = 0;
+	for (; i >= 0 && !found; --i)
+	{
+		restore(i, false);
+		while (gb->cpu.instruction_count() < end)
+		{
+			if (stop(gb->cpu.PC.reg))
+			{
+				target = gb->cpu.instruction_count();
+				found  = true;
+			}
+			gb->cpu.step();
+		}
+		end = at(i).instruction;
+	}
+	m_replaying = false;
+
+	// Nothing in history, come back to where we started
+	seek(found ? target : current);
+	return found;
+}
\ No newline at end of file
@@ -0,0 +1,72 @@
+#pragma once
+#include "core.h"
+#include "SaveState.h"
+
+#include <functional>
+#include <vector>
+
+class GameBoy;
+
+/*
+	Rewinder
+
+	Keeps a ring of snapshots taken every `interval` emulated cycles.
+	Going back means restoring the nearest earlier snapshot and replaying
+	forward at full speed to the target instruction, so only one snapshot
+	per interval is stored instead of one per instruction.
+
+	Emulation is deterministic as long as nothing outside of the machine
+	changes its state, so replayed instructions repeat exactly.
+*/
+class Rewinder
+{
+public:
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	void enable(H_QWORD interval, size_t capacity);
+	void disable();
+	void clear();	// Drops history. Must be called whenever state is changed from outside
+
+	inline bool   enabled() const { return m_enabled; }
+	inline size_t size()    const { return m_count; }
+
+	// Called by CPU at every instruction boundary
+	inline void on_instruction(H_QWORD cycle)
+	{
+		if (cycle >= m_next && !m_replaying)
+			take_snapshot();
+	}
+
+	// Returns to the state right before instruction with given index was fetched
+	bool seek(H_QWORD instruction);
+
+	// Goes one instruction back
+	bool step_back();
+
+	// Goes back to the latest earlier instruction boundary where stop(PC) is true
+	bool run_back(const std::function<bool(H_WORD)>& stop);
+
+private:
+	GameBoy* gb = nullptr;
+
+	struct SNAPSHOT
+	{
+		H_QWORD   instruction = 0;
+		SaveState state;
+	};
+	std::vector<SNAPSHOT> m_ring;
+	size_t  m_first = 0; // Oldest snapshot
+	size_t  m_count = 0;
+
+	H_QWORD m_interval  = 0;
+	H_QWORD m_next      = 0; // Cycle at which next snapshot is taken
+	bool    m_enabled   = false;
+	bool    m_replaying = false;
+
+	inline SNAPSHOT& at(size_t i) { return m_ring[(m_first + i) % m_ring.size()]; }
+
+	void take_snapshot();
+	int  find(H_QWORD instruction);           // Latest snapshot at or before instruction, -1 if history is too short
+	void restore(size_t i, bool truncate);    // Loads snapshot, optionally dropping everything after it
+	void replay(H_QWORD instruction);         // Runs forward until given instruction is next
+};
\ No newline at end of file
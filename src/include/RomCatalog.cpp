@@ -0,0 +1,279 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "RomCatalog.h"
+#include "Archive.h"
+#include "Cartridge.h"
+#include "Hash.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+static_assert(sizeof(RomCatalog::ENTRY) == 64, "Catalog entry has to stay 64 bytes");
+
+static std::string lower(std::string s)
+{
+	for (char& c : s)
+		c = (char)std::tolower((unsigned char)c);
+	return s;
+}
+
+// Hash and header of ROM in file
+static bool read_entry(const std::string& path, RomCatalog::ENTRY& e)
+{
+	MappedFile file;
+	if (!file.open(path.c_str()))
+		return false;
+
+	const H_BYTE* rom  = file.data();
+	size_t        size = file.size();
+
+	// Compressed one is identified by what is inside
+	std::vector<H_BYTE> unpacked;
+	Archive::ITEM item;
+	if (Archive::detect(rom, size) != Archive::FORMAT_NONE)
+	{
+		if (!Archive::locate(rom, size, item) || item.size > _CARTRIDGE_MAX_SIZE)
+			return false;
+		if (item.format == Archive::FORMAT_ZIP && !Archive::rom_name(item.name))
+			return false;
+
+		unpacked.resize(item.size);
+		if (!Archive::extract(item, unpacked.data()))
+			return false;
+		rom  = unpacked.data();
+		size = unpacked.size();
+	}
+
+	e = RomCatalog::ENTRY();
+	e.hash = Hash::xxh64(rom, size);
+
+	CartridgeHeader h;
+	if (CartridgeHeader::parse(rom, size, h))
+	{
+		h.check_global(rom, size);
+		// Entry is zeroed above, shorter title stays terminated
+		std::memcpy(e.title, h.title.data(), std::min(h.title.size(), sizeof(e.title)));
+		e.rom_size = (H_DWORD)h.rom_size;
+		e.ram_size = (H_DWORD)h.ram_size;
+		e.type  = h.type;
+		e.cgb   = h.cgb;
+		e.mbc   = (H_BYTE)h.mbc;
+		e.flags = RomCatalog::FLAG_HEADER
+			| (h.header_valid ? RomCatalog::FLAG_HEADER_VALID : 0)
+			| (h.global_valid ? RomCatalog::FLAG_GLOBAL_VALID : 0);
+	}
+	return true;
+}
+
+bool RomCatalog::open(const char* filename)
+{
+	close();
+	if (!m_file.open(filename) || m_file.size() < sizeof(HEADER))
+	{
+		close();
+		return false;
+	}
+
+	HEADER h;
+	std::memcpy(&h, m_file.data(), sizeof(h));
+	size_t expected = sizeof(HEADER) + (size_t)h.count * (sizeof(ENTRY) + sizeof(H_DWORD)) + h.strings;
+	if (std::memcmp(h.magic, "HRCT", 4) != 0 || h.version != _CATALOG_VERSION || expected != m_file.size())
+	{
+		close();
+		return false;
+	}
+
+	m_count        = h.count;
+	m_strings_size = h.strings;
+	m_entries = (const ENTRY*)(m_file.data() + sizeof(HEADER));
+	m_names   = (const H_DWORD*)(m_entries + m_count);
+	m_strings = (const char*)(m_names + m_count);
+
+	// Terminated string table keeps every string inside the file. Offsets in entries and
+	// name index are checked by lookups that use them, nothing else is read here
+	if (m_strings_size == 0 ? m_count != 0 : m_strings[m_strings_size - 1] != '\0')
+	{
+		close();
+		return false;
+	}
+	return true;
+}
+
+void RomCatalog::close()
+{
+	m_file.close();
+	m_entries = nullptr;
+	m_names   = nullptr;
+	m_strings = nullptr;
+	m_count   = 0;
+	m_strings_size = 0;
+}
+
+bool RomCatalog::scan(const char* catalog, const char* directory)
+{
+	namespace fs = std::filesystem;
+
+	struct ROM
+	{
+		ENTRY       entry;
+		std::string path, name;
+	};
+	std::vector<ROM> roms;
+
+	// Previous scan, by path. Damaged entries are hashed again
+	open(catalog);
+	std::unordered_map<std::string, const ENTRY*> known;
+	for (const ENTRY& e : *this)
+		if (valid(e))
+			known.emplace(path(e), &e);
+
+	m_hashed = 0;
+
+	std::error_code ec;
+	fs::recursive_directory_iterator it(directory, fs::directory_options::skip_permission_denied, ec), last;
+	if (ec)
+	{
+		std::cerr << "Directory failure: " << directory << std::endl;
+		return false;
+	}
+	for (; it != last; it.increment(ec))
+	{
+		if (ec)
+		{
+			std::cerr << "Directory failure: " << ec.message() << std::endl;
+			return false;
+		}
+		if (!it->is_regular_file(ec))
+			continue;
+
+		// game.gb.gz is named game too
+		fs::path stem = it->path().stem();
+		std::string extension = lower(it->path().extension().string());
+		if (extension == ".gz" || extension == ".zip")
+		{
+			if (Archive::rom_name(stem.string()))
+				stem = stem.stem();
+		}
+		else if (!Archive::rom_name(extension))
+			continue;
+
+		ROM rom;
+		rom.path = it->path().string();
+		rom.name = lower(stem.string());
+		H_QWORD size = (H_QWORD)it->file_size(ec);
+		if (ec)
+			continue;
+		H_S_QWORD mtime = (H_S_QWORD)it->last_write_time(ec).time_since_epoch().count();
+		if (ec)
+			continue;
+
+		auto k = known.find(rom.path);
+		bool same = k != known.end() && k->second->size == size && k->second->mtime == mtime;
+		if (same)
+			rom.entry = *k->second;
+		if (k != known.end())
+			known.erase(k); // Whatever is left at the end was removed
+
+		if (!same)
+		{
+			if (!read_entry(rom.path, rom.entry))
+				continue;
+			m_hashed++;
+		}
+
+		rom.entry.size  = size;
+		rom.entry.mtime = mtime;
+		roms.push_back(std::move(rom));
+	}
+	m_removed = known.size();
+
+	std::sort(roms.begin(), roms.end(), [](const ROM& a, const ROM& b) { return a.entry.hash != b.entry.hash ? a.entry.hash < b.entry.hash : a.path < b.path; });
+
+	std::string strings;
+	for (ROM& rom : roms)
+	{
+		rom.entry.path = (H_DWORD)strings.size();
+		strings.append(rom.path).push_back('\0');
+		rom.entry.name = (H_DWORD)strings.size();
+		strings.append(rom.name).push_back('\0');
+	}
+
+	std::vector<H_DWORD> names(roms.size());
+	for (size_t i = 0; i < names.size(); i++)
+		names[i] = (H_DWORD)i;
+	std::sort(names.begin(), names.end(), [&](H_DWORD a, H_DWORD b) { return roms[a].name != roms[b].name ? roms[a].name < roms[b].name : a < b; });
+
+	std::vector<ENTRY> entries(roms.size());
+	for (size_t i = 0; i < roms.size(); i++)
+		entries[i] = roms[i].entry;
+
+	HEADER h;
+	std::memcpy(h.magic, "HRCT", 4);
+	h.version = _CATALOG_VERSION;
+	h.count   = (H_DWORD)entries.size();
+	h.strings = (H_DWORD)strings.size();
+
+	std::string temp = std::string(catalog) + ".tmp";
+	FILE* pFile = fopen(temp.c_str(), "wb");
+	if (pFile == nullptr)
+	{
+		std::cerr << "Catalog write failure: " << temp << std::endl;
+		return false;
+	}
+	bool written = fwrite(&h, sizeof(h), 1, pFile) == 1
+		&& fwrite(entries.data(), sizeof(ENTRY), entries.size(), pFile) == entries.size()
+		&& fwrite(names.data(), sizeof(H_DWORD), names.size(), pFile) == names.size()
+		&& fwrite(strings.data(), 1, strings.size(), pFile) == strings.size();
+	written = (fclose(pFile) == 0) && written;
+
+	// Old mapping has to be gone before file is replaced on Windows
+	close();
+	if (written)
+		fs::rename(temp, catalog, ec);
+	if (!written || ec)
+	{
+		std::cerr << "Catalog write failure: " << catalog << std::endl;
+		fs::remove(temp, ec);
+		return false;
+	}
+	return open(catalog);
+}
+
+const RomCatalog::ENTRY* RomCatalog::find(H_QWORD hash) const
+{
+	const ENTRY* e = std::lower_bound(begin(), end(), hash, [](const ENTRY& e, H_QWORD h) { return e.hash < h; });
+	return (e != end() && e->hash == hash && valid(*e)) ? e : nullptr;
+}
+
+const RomCatalog::ENTRY* RomCatalog::find(const char* name) const
+{
+	// Damaged index number reads as empty name, search stays inside the file
+	std::string key = lower(name);
+	auto key_of = [&](H_DWORD i) { return i < m_count ? this->name(m_entries[i]) : ""; };
+	const H_DWORD* i = std::lower_bound(m_names, m_names + m_count, key, [&](H_DWORD i, const std::string& k) { return std::strcmp(key_of(i), k.c_str()) < 0; });
+	if (i == m_names + m_count || *i >= m_count || !valid(m_entries[*i]) || key != key_of(*i))
+		return nullptr;
+	return &m_entries[*i];
+}
+
+const char* RomCatalog::path(const ENTRY& e) const
+{
+	return e.path < m_strings_size ? m_strings + e.path : "";
+}
+
+const char* RomCatalog::name(const ENTRY& e) const
+{
+	return e.name < m_strings_size ? m_strings + e.name : "";
+}
+
+bool RomCatalog::valid(const ENTRY& e) const
+{
+	return e.path < m_strings_size && e.name < m_strings_size;
+}
\ No newline at end of file
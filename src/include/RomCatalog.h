@@ -0,0 +1,103 @@
+#pragma once
+#define _CATALOG_VERSION 1
+
+#include "core.h"
+#include "MappedFile.h"
+
+#include <cstddef>
+
+/*
+	ROM Catalog
+
+	Index of every ROM under a directory tree, kept in one file that is
+	memory mapped and used as it is, so opening a catalog of tens of thousands
+	of ROMs reads nothing but pages that lookups touch. Open checks header and
+	sizes only, offsets of an entry are checked when a lookup gets to it
+		Header     - magic, version, entry count, string table size
+		Entries    - 64 bytes each, sorted by hash
+		Name index - entry numbers sorted by name
+		Strings    - zero terminated paths and names
+
+	Name is lower case file name without extensions. Hash is XXH64 of ROM,
+	same as `xxhsum -H1` prints for it, unpacked first if file is gzip or zip,
+	so the same game has the same hash either way. Both lookups are binary searches.
+
+	Rescan reuses entries of files whose path, size and modification time are
+	unchanged. Only new and changed files are read, their hash and header are
+	computed in one go over mapped file, or over unpacked copy of compressed one. New catalog is written next to old one
+	and renamed over it, so a reader never sees half of a file.
+
+	File is in native byte order, it is a cache and is not meant to be moved
+	between machines.
+*/
+class RomCatalog
+{
+public:
+	enum FLAGS
+	{
+		FLAG_HEADER       = (1 << 0),	// Header could be parsed, fields below are valid
+		FLAG_HEADER_VALID = (1 << 1),	// Header checksum matches
+		FLAG_GLOBAL_VALID = (1 << 2)	// Global checksum matches
+	};
+
+	struct ENTRY
+	{
+		H_QWORD   hash;
+		H_QWORD   size;			// File size
+		H_S_QWORD mtime;		// Modification time, in ticks of filesystem clock
+		H_DWORD   path;			// Offset in string table
+		H_DWORD   name;			// Offset in string table
+		char      title[16];	// Not terminated if 16 characters long
+		H_DWORD   rom_size;		// From header
+		H_DWORD   ram_size;
+		H_BYTE    type;			// Raw header bytes
+		H_BYTE    cgb;
+		H_BYTE    mbc;			// CartridgeHeader::MBC_TYPE
+		H_BYTE    flags;
+		H_DWORD   reserved;
+	};
+
+	// Maps existing catalog. False if it is missing, damaged or of other version
+	bool open(const char*);
+	void close();
+
+	// Updates catalog with ROMs found under directory and opens it.
+	// Files with .gb, .gbc or .sgb extension are taken, and .gz or .zip ones that hold ROM
+	bool scan(const char* catalog, const char* directory);
+
+	const ENTRY* find(H_QWORD hash) const;
+	const ENTRY* find(const char* name) const;	// Case insensitive
+
+	// Empty for entry of damaged catalog
+	const char* path(const ENTRY&) const;
+	const char* name(const ENTRY&) const;
+
+	inline size_t       size()  const { return m_count; }
+	inline const ENTRY* begin() const { return m_entries; }
+	inline const ENTRY* end()   const { return m_entries + m_count; }
+
+	// Statistics of last scan
+	inline size_t hashed()  const { return m_hashed; }
+	inline size_t removed() const { return m_removed; }
+
+private:
+	struct HEADER
+	{
+		char    magic[4];	// "HRCT"
+		H_DWORD version;
+		H_DWORD count;
+		H_DWORD strings;	// Bytes
+	};
+
+	MappedFile     m_file;
+	const ENTRY*   m_entries = nullptr;
+	const H_DWORD* m_names   = nullptr;
+	const char*    m_strings = nullptr;
+	size_t         m_count   = 0;
+	size_t         m_strings_size = 0;
+
+	size_t m_hashed  = 0;
+	size_t m_removed = 0;
+
+	bool valid(const ENTRY&) const;	// Offsets stay inside string table
+};
\ No newline at end of file
@@ -0,0 +1,77 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+/*
+	Single Producer Single Consumer Queue
+
+	Fixed size ring for handing data from one thread to exactly one other.
+	Producer only moves head, consumer only moves tail, so neither side
+	ever takes a lock or waits. Capacity must be a power of two.
+*/
+template<typename T, size_t N>
+class SPSCQueue
+{
+	static_assert(N > 0 && (N & (N - 1)) == 0, "SPSCQueue capacity must be a power of two");
+
+public:
+	// Producer. Returns false if queue is full
+	bool push(const T& value)
+	{
+		size_t head = m_head.load(std::memory_order_relaxed);
+		if (head - m_tail.load(std::memory_order_acquire) == N)
+			return false;
+
+		m_data[head & (N - 1)] = value;
+		m_head.store(head + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer. Returns false if queue is empty
+	bool pop(T& value)
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		if (tail == m_head.load(std::memory_order_acquire))
+			return false;
+
+		value = m_data[tail & (N - 1)];
+		m_tail.store(tail + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Producer. Pushes as many of count values as fit, returns how many
+	size_t push(const T* values, size_t count)
+	{
+		size_t head = m_head.load(std::memory_order_relaxed);
+		count = std::min(count, N - (head - m_tail.load(std::memory_order_acquire)));
+
+		for (size_t i = 0; i < count; i++)
+			m_data[(head + i) & (N - 1)] = values[i];
+		m_head.store(head + count, std::memory_order_release);
+		return count;
+	}
+
+	// Consumer. Pops up to count values, returns how many
+	size_t pop(T* values, size_t count)
+	{
+		size_t tail = m_tail.load(std::memory_order_relaxed);
+		count = std::min(count, m_head.load(std::memory_order_acquire) - tail);
+
+		for (size_t i = 0; i < count; i++)
+			values[i] = m_data[(tail + i) & (N - 1)];
+		m_tail.store(tail + count, std::memory_order_release);
+		return count;
+	}
+
+	inline bool   empty() const { return m_head.load(std::memory_order_acquire) == m_tail.load(std::memory_order_acquire); }
+	inline size_t size()  const { return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire); }
+	static constexpr size_t capacity() { return N; }
+
+private:
+	// Each index on its own cache line so threads don't fight over it
+	alignas(64) std::atomic<size_t> m_head{ 0 };
+	alignas(64) std::atomic<size_t> m_tail{ 0 };
+	alignas(64) std::array<T, N>    m_data;
+};
\ No newline at end of file
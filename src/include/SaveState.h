@@ -0,0 +1,30 @@
+#pragma once
+#include <array>
+
+#include "core.h"
+#include "CPUZ80.h"
+#include "Screen.h"
+#include "Joypad.h"
+#include "Serial.h"
+#include "APU.h"
+#include "MBC.h"
+#include "CGB.h"
+
+/*
+	Save State
+
+	Complete machine state at an instruction boundary. Restoring it and
+	running the same number of instructions always ends in the same state,
+	which is what the rewinder relies on.
+*/
+struct SaveState
+{
+	CPUZ80::STATE                              cpu;
+	Joypad::STATE                              joypad;
+	Serial::STATE                              serial;
+	APU::STATE                                 apu;
+	MBC::STATE                                 mbc;
+	CGB::STATE                                 cgb;
+	std::array<H_BYTE, 64 * 1024>              memory;
+	std::array<H_DWORD, _SCREEN_W * _SCREEN_H> screen;
+};
\ No newline at end of file
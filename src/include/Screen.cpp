@@ -7,7 +7,13 @@ Screen::Screen()
 	for (int x = 0; x < _SCREEN_W; ++x)
 		for (int y = 0; y < _SCREEN_H; ++y)
 			m_screenData[x + y * _SCREEN_W] = blackPixel;
-	
+}
+
+void Screen::open()
+{
+	if (m_window != nullptr)
+		return;
+
 	if (SDL_Init(SDL_INIT_VIDEO) != 0) {
 		std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
 		exit(1);
@@ -31,11 +37,19 @@ Screen::Screen()
 		whitePixel.b
 	));
 
+	// Picture drawn before window existed
+	for (int y = 0; y < _SCREEN_H; ++y)
+		for (int x = 0; x < _SCREEN_W; ++x)
+			set_pixel(x, y, ScreenData(m_screenData[x + y * _SCREEN_W].val));
+
 	SDL_UpdateWindowSurface(m_window);
 }
 
 Screen::~Screen()
 {
+	if (m_window == nullptr)
+		return;
+
 	SDL_DestroyWindow(m_window);
 	SDL_Quit();
 }
@@ -53,10 +67,39 @@ H_BYTE* Screen::read_ptr(H_WORD addr)
 	return gb->read_ptr(addr);
 }
 
+void Screen::save(H_DWORD* buffer) const
+{
+	for (int i = 0; i < _SCREEN_W * _SCREEN_H; ++i)
+		buffer[i] = m_screenData[i].val;
+}
+
+void Screen::load(const H_DWORD* buffer)
+{
+	for (int y = 0; y < _SCREEN_H; ++y)
+		for (int x = 0; x < _SCREEN_W; ++x)
+			set_pixel(x, y, ScreenData(buffer[x + y * _SCREEN_W]));
+}
+
+void Screen::present(const H_DWORD* buffer)
+{
+	if (m_screen == nullptr)
+		return;
+
+	for (int y = 0; y < _SCREEN_H; ++y)
+		for (int x = 0; x < _SCREEN_W; ++x)
+			draw(x, y, ScreenData(buffer[x + y * _SCREEN_W]));
+	SDL_UpdateWindowSurface(m_window);
+}
+
 void Screen::set_pixel(int x, int y, ScreenData sd)
 {
 	m_screenData[x + y * _SCREEN_W] = sd;
+	if (m_screen != nullptr && m_direct)
+		draw(x, y, sd);
+}
 
+void Screen::draw(int x, int y, ScreenData sd)
+{
 	int _x = x * _SCREEN_M;
 	int _y = y * _SCREEN_M;
 
@@ -65,13 +108,7 @@ void Screen::set_pixel(int x, int y, ScreenData sd)
 		for (int y_offset = 0; y_offset < _SCREEN_M; ++y_offset)
 		{
 			Uint8* p = (Uint8*)m_screen->pixels + (_y + y_offset) * m_screen->pitch + (_x + x_offset) * 4;
-			*(Uint32*)p = SDL_MapRGB
-			(
-				m_screen->format, 
-				m_screenData[x + y * _SCREEN_W].r, 
-				m_screenData[x + y * _SCREEN_W].g, 
-				m_screenData[x + y * _SCREEN_W].b
-			);
+			*(Uint32*)p = SDL_MapRGB(m_screen->format, sd.r, sd.g, sd.b);
 		}
 	}
 }
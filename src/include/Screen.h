@@ -31,9 +31,23 @@ public:
 	~Screen();
 
 	inline void connect_device(GameBoy* instance) { gb = instance; };
-	inline void flush() { SDL_UpdateWindowSurface(m_window); }
+	inline void flush() { if (m_window != nullptr) SDL_UpdateWindowSurface(m_window); }
+
+	// Window is created only when asked, headless runs never touch SDL
+	void open();
+	inline bool opened() const { return m_window != nullptr; }
 
 	void set_pixel(int, int, ScreenData);
+	inline const ScreenData& pixel(int x, int y) const { return m_screenData[x + y * _SCREEN_W]; }
+	inline const ScreenData* data() const { return m_screenData; } // _SCREEN_W * _SCREEN_H pixels, row by row
+
+	void save(H_DWORD*) const; // Copies screen colors to buffer of _SCREEN_W * _SCREEN_H
+	void load(const H_DWORD*); // Restores screen colors and redraws window
+
+	// When emulation runs on another thread than window, set_pixel only fills the buffer
+	// and window thread draws copies of it with present
+	inline void set_direct(bool on) { m_direct = on; }
+	void present(const H_DWORD*);	// Draws buffer of _SCREEN_W * _SCREEN_H colors to window
 
 private:
 	ScreenData m_screenData[_SCREEN_W * _SCREEN_H];
@@ -41,6 +55,9 @@ private:
 	// SDL context
 	SDL_Window* m_window;
 	SDL_Surface* m_screen;
+	bool m_direct = true;	// set_pixel draws to window
+
+	void draw(int, int, ScreenData);
 private:
 public:
 	// GameBoy instance
@@ -0,0 +1,87 @@
+#include "Serial.h"
+#include "GameBoy.h"
+#include "Link.h"
+
+#include <algorithm>
+
+void Serial::reset()
+{
+	m_s = STATE();
+	schedule();
+}
+
+void Serial::write(H_WORD addr, H_BYTE data)
+{
+	H_BYTE* io  = &gb->m_memory[0xFF00];
+	H_QWORD now = gb->cpu.dot_count();
+
+	if (addr == 0xFF01)
+		io[0x01] = data;
+	else
+	{
+		io[0x02] = data | (gb->cgb.enabled() ? 0x7C : 0x7E);
+		m_s.active = (data & 0x81) == 0x81;
+		if (m_s.active)
+		{
+			// Clock is taken from CPU one, it is twice as fast in double speed
+			H_QWORD cycles = (gb->cgb.enabled() && (data & 0x02)) ? 128 : 4096;
+			m_s.end = now + (gb->cpu.double_speed ? cycles / 2 : cycles);
+		}
+	}
+
+	if (m_link != nullptr)
+	{
+		m_link->record(m_end, now, io[0x01], io[0x02]);
+		if (addr == 0xFF02 && m_s.active)
+			m_link->start(m_end, m_s.end, io[0x01]);
+	}
+	schedule();
+}
+
+void Serial::apply()
+{
+	H_QWORD now = gb->cpu.dot_count();
+
+	if (m_link != nullptr)
+		m_link->sync(m_end, now);
+
+	if (m_s.active && now >= m_s.end)
+	{
+		m_s.active = false;
+		H_BYTE received = m_link != nullptr ? m_link->exchange(m_end, m_s.end) : 0xFF;
+		complete(received);
+		if (m_link != nullptr)
+			m_link->record(m_end, m_s.end, gb->m_memory[0xFF01], gb->m_memory[0xFF02]);
+	}
+
+	schedule();
+}
+
+void Serial::schedule()
+{
+	H_QWORD none = std::numeric_limits<H_QWORD>::max();
+	H_QWORD now  = gb->cpu.dot_count();
+	H_QWORD next = m_s.active ? m_s.end : none;
+	if (m_link != nullptr)
+		next = std::min(next, m_link->next_event(m_end));
+
+	m_next = next == none ? none : gb->cpu.cycle_count() + gb->cpu.cpu_cycles(next > now ? next - now : 0);
+}
+
+void Serial::complete(H_BYTE received)
+{
+	gb->m_memory[0xFF01] = received;
+	gb->m_memory[0xFF02] &= 0x7F;
+	gb->m_memory[0xFF0F] |= 1 << 3; // Serial interrupt
+}
+
+void Serial::save_state(STATE& s) const
+{
+	s = m_s;
+}
+
+void Serial::load_state(const STATE& s)
+{
+	m_s = s;
+	schedule();
+}
\ No newline at end of file
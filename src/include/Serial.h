@@ -0,0 +1,69 @@
+#pragma once
+#include "core.h"
+
+#include <limits>
+
+class GameBoy;
+class Link;
+
+/*
+	Serial port
+
+	Two registers
+		FF01 - SB. Byte to send, received byte replaces it when transfer ends
+		FF02 - SC. Bit 7 starts transfer and stays set while it runs,
+		       bit 1 is CGB fast clock, bit 0 selects internal clock (1) or external (0)
+
+	Game Boy with internal clock shifts 8 bits out at 8192 Hz, 4096 CPU cycles
+	per byte (128 with CGB fast clock), and other end shifts its byte back at the same
+	time. End with external clock waits for other one to clock it. Both
+	request serial interrupt when byte is done.
+
+	Without cable received byte is FF. With one, see Link, transfers are
+	exchanged with other Game Boy, which can be emulated on another thread.
+
+	Transfer ends are events at instruction boundaries, same as joypad input,
+	so nothing is checked on every cycle. Times are in CPUZ80::dot_count,
+	which both ends of cable share.
+*/
+class Serial
+{
+public:
+	struct STATE
+	{
+		bool    active = false;	// Internal clock transfer runs
+		H_QWORD end    = 0;		// Dot it ends at
+	};
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	void reset();
+	void write(H_WORD, H_BYTE);	// CPU writes FF01 or FF02
+
+	// Called by CPU at every instruction boundary
+	inline void on_instruction(H_QWORD cycle)
+	{
+		if (cycle >= m_next)
+			apply();
+	}
+	inline H_QWORD next_event() const { return m_next; }
+
+	inline bool linked() const { return m_link != nullptr; }
+
+	void save_state(STATE&) const;
+	void load_state(const STATE&);
+
+private:
+	friend class Link;
+
+	GameBoy* gb = nullptr;
+	STATE    m_s;
+	H_QWORD  m_next = std::numeric_limits<H_QWORD>::max();	// CPU cycle of next event
+
+	Link* m_link = nullptr;
+	int   m_end  = 0;	// Which end of cable
+
+	void apply();						// Handles events due now
+	void schedule();					// Updates m_next
+	void complete(H_BYTE received);		// Byte is in, requests interrupt
+};
\ No newline at end of file
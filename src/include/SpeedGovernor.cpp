@@ -0,0 +1,51 @@
+#include "SpeedGovernor.h"
+
+#include <algorithm>
+#include <thread>
+
+void SpeedGovernor::set_speed(double speed)
+{
+	m_speed = std::max(0.0, speed);
+	if (m_speed > 0.0)
+		m_frame_time = std::chrono::duration_cast<clock::duration>(std::chrono::duration<double>(FRAME_CYCLES / (CLOCKSPEED * m_speed)));
+	reset();
+}
+
+void SpeedGovernor::reset()
+{
+	m_deadline = clock::now();
+}
+
+void SpeedGovernor::frame()
+{
+	m_frames++;
+	if (m_speed <= 0.0)
+		return;
+
+	m_deadline += m_frame_time;
+	clock::time_point now = clock::now();
+
+	// More than 100ms behind, catching up would only look like fast forward
+	if (now > m_deadline)
+	{
+		m_late++;
+		if (now - m_deadline > std::chrono::milliseconds(100))
+			m_deadline = now;
+		return;
+	}
+
+	// Sleep most of the wait and learn how late sleep wakes up
+	if (m_deadline - now > m_spin)
+	{
+		clock::time_point wake = m_deadline - m_spin;
+		std::this_thread::sleep_until(wake);
+		clock::duration overshoot = clock::now() - wake;
+
+		// Spin margin moves a quarter of the way to twice the observed overshoot
+		clock::duration target = std::min<clock::duration>(std::max<clock::duration>(overshoot * 2, std::chrono::microseconds(200)), std::chrono::milliseconds(4));
+		m_spin += (target - m_spin) / 4;
+	}
+
+	while (clock::now() < m_deadline)
+		std::this_thread::yield();
+}
\ No newline at end of file
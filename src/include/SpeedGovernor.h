@@ -0,0 +1,47 @@
+#pragma once
+#include "core.h"
+#include "CPUZ80.h"
+
+#include <chrono>
+
+/*
+	Speed Governor
+
+	Paces emulation to the real frame rate of 59.73 Hz, to a multiple of it,
+	or not at all. Called once after every emulated frame.
+
+	OS sleep usually wakes up late by up to a few milliseconds, so most of
+	the wait is slept and only the last bit is spun. How much is spun
+	follows how late sleeps actually wake up, so a precise timer costs
+	almost no CPU and a sloppy one still gives even frame times.
+
+	If emulation falls far behind (breakpoint, host hiccup) the schedule
+	restarts from now instead of running fast to catch up.
+*/
+class SpeedGovernor
+{
+public:
+	SpeedGovernor() { set_speed(1.0); }
+
+	// 1.0 is real time, 2.0 twice as fast, 0 is unthrottled
+	void set_speed(double);
+	inline double speed() const { return m_speed; }
+	inline bool   throttled() const { return m_speed > 0.0; }
+
+	void reset();	// Schedule starts from now. Call after pause
+	void frame();	// Waits until current frame is due
+
+	inline H_QWORD frames() const { return m_frames; }
+	inline H_QWORD late()   const { return m_late; }   // Frames that came after their deadline
+
+private:
+	using clock = std::chrono::steady_clock;
+
+	double            m_speed = 1.0;
+	clock::duration   m_frame_time;
+	clock::time_point m_deadline;
+	clock::duration   m_spin = std::chrono::microseconds(1000); // Part of wait that is spun, not slept
+
+	H_QWORD m_frames = 0;
+	H_QWORD m_late   = 0;
+};
\ No newline at end of file
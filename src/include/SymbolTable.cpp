@@ -0,0 +1,115 @@
+#include "SymbolTable.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+
+bool SymbolTable::load(const char* filename)
+{
+	std::ifstream file(filename);
+	if (!file.is_open())
+		return false;
+
+	clear();
+
+	std::string line;
+	while (std::getline(file, line))
+	{
+		size_t comment = line.find(';');
+		if (comment != std::string::npos)
+			line.resize(comment);
+
+		// BB:AAAA Name
+		size_t colon = line.find(':');
+		size_t space = line.find_first_of(" \t", colon);
+		if (colon == std::string::npos || space == std::string::npos)
+			continue;
+
+		size_t name_start = line.find_first_not_of(" \t", space);
+		size_t name_end   = line.find_last_not_of(" \t\r");
+		if (name_start == std::string::npos || name_end < name_start)
+			continue;
+
+		char* end = nullptr;
+		unsigned long bank = std::strtoul(line.c_str(), &end, 16);
+		if (end != line.c_str() + colon)
+			continue;
+		unsigned long addr = std::strtoul(line.c_str() + colon + 1, &end, 16);
+		if (end != line.c_str() + space || bank > 0xFF || addr > 0xFFFF)
+			continue;
+
+		m_symbols.push_back({ (H_DWORD)((bank << 16) | addr), (H_DWORD)m_names.size() });
+		m_names.append(line, name_start, name_end - name_start + 1);
+		m_names.push_back('\0');
+	}
+
+	// Labels sharing an address keep file order, so the first one wins
+	std::stable_sort(m_symbols.begin(), m_symbols.end(), [](const SYMBOL& a, const SYMBOL& b) { return a.key < b.key; });
+
+	std::cout << "Symbols loaded: " << m_symbols.size() << std::endl;
+	return true;
+}
+
+void SymbolTable::clear()
+{
+	m_symbols.clear();
+	m_names.clear();
+}
+
+H_WORD SymbolTable::region(H_WORD addr)
+{
+	if (addr < 0x4000) return 0x0000; // ROM bank 0
+	if (addr < 0x8000) return 0x4000; // Switchable ROM bank
+	if (addr < 0xA000) return 0x8000; // VRAM
+	if (addr < 0xC000) return 0xA000; // Cartridge RAM
+	if (addr < 0xD000) return 0xC000; // WRAM bank 0
+	if (addr < 0xE000) return 0xD000; // Switchable WRAM bank
+	if (addr < 0xFF80) return 0xE000; // Echo, OAM and I/O
+	return 0xFF80;                    // HRAM
+}
+
+const char* SymbolTable::lookup(H_BYTE bank, H_WORD addr, H_WORD* offset) const
+{
+	H_DWORD key = (bank << 16) | addr;
+	auto it = std::upper_bound(m_symbols.begin(), m_symbols.end(), key, [](H_DWORD k, const SYMBOL& s) { return k < s.key; });
+	if (it == m_symbols.begin())
+		return nullptr;
+
+	// Last one at or below addr, then first of the labels sharing its address
+	it = std::lower_bound(m_symbols.begin(), it, (it - 1)->key, [](const SYMBOL& s, H_DWORD k) { return s.key < k; });
+
+	// Label from another bank or region is not a meaningful base
+	H_WORD symbol_addr = it->key & 0xFFFF;
+	if ((it->key >> 16) != bank || region(symbol_addr) != region(addr))
+		return nullptr;
+
+	if (offset != nullptr)
+		*offset = addr - symbol_addr;
+	return &m_names[it->name];
+}
+
+const char* SymbolTable::exact(H_BYTE bank, H_WORD addr) const
+{
+	H_WORD offset = 0;
+	const char* name = lookup(bank, addr, &offset);
+	return offset == 0 ? name : nullptr;
+}
+
+std::string SymbolTable::describe(H_BYTE bank, H_WORD addr) const
+{
+	H_WORD offset = 0;
+	const char* name = lookup(bank, addr, &offset);
+	if (name == nullptr)
+		return std::string();
+
+	std::string s(name);
+	if (offset > 0)
+	{
+		char buffer[8];
+		snprintf(buffer, sizeof(buffer), "+$%X", offset);
+		s += buffer;
+	}
+	return s;
+}
\ No newline at end of file
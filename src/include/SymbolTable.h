@@ -0,0 +1,48 @@
+#pragma once
+#include "core.h"
+
+#include <string>
+#include <vector>
+
+/*
+	Symbol Table
+
+	Loads RGBDS .sym files
+		; comment
+		00:0150 Main
+		01:4a2f Main.loop
+
+	Symbols are kept in one vector sorted by bank:address key with names packed
+	into a single string pool, so lookup is a binary search over 8 byte entries
+	and is cheap enough to be used while tracing.
+*/
+class SymbolTable
+{
+public:
+	bool load(const char*);
+	void clear();
+
+	inline bool   empty() const { return m_symbols.empty(); }
+	inline size_t size()  const { return m_symbols.size(); }
+
+	// Returns the closest symbol at or below bank:addr in the same memory region, nullptr if there is none
+	// offset receives addr - symbol address
+	const char* lookup(H_BYTE bank, H_WORD addr, H_WORD* offset = nullptr) const;
+
+	// Returns symbol placed exactly at bank:addr, nullptr if there is none
+	const char* exact(H_BYTE bank, H_WORD addr) const;
+
+	// Formats closest symbol as "Name" or "Name+$1F". Empty string if there is none
+	std::string describe(H_BYTE bank, H_WORD addr) const;
+
+private:
+	struct SYMBOL
+	{
+		H_DWORD key;  // bank << 16 | addr
+		H_DWORD name; // Offset in names pool
+	};
+	std::vector<SYMBOL> m_symbols;
+	std::string         m_names;
+
+	static H_WORD region(H_WORD); // Start of memory region address belongs to
+};
\ No newline at end of file
@@ -0,0 +1,26 @@
+#include "TileCache.h"
+#include "GameBoy.h"
+
+void TileCache::invalidate_all()
+{
+	m_dirty.fill(true);
+}
+
+void TileCache::decode(int index)
+{
+	const H_BYTE* data = gb->cgb.vram(index / 384) + (index % 384) * 16;
+	H_BYTE* pixels = m_tiles[index].data();
+
+	for (int line = 0; line < 8; line++)
+	{
+		H_BYTE lo = data[line * 2];
+		H_BYTE hi = data[line * 2 + 1];
+		for (int x = 0; x < 8; x++)
+		{
+			int bit = 7 - x;
+			*pixels++ = (((hi >> bit) & 1) << 1) | ((lo >> bit) & 1);
+		}
+	}
+
+	m_dirty[index] = false;
+}
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+#include "core.h"
+
+#include <algorithm>
+#include <array>
+
+class GameBoy;
+
+/*
+	Tile Cache
+
+	VRAM $8000-$97FF holds 384 tiles, 16 bytes each. Every tile row is
+	two bytes, first one has low bits of colors, second one high bits,
+	leftmost pixel is bit 7.
+
+	Tiles are kept decoded to one color number (0-3) per byte and are
+	re-decoded only after something writes to their VRAM bytes, so
+	renderer and debugger don't decode the same tile over and over.
+
+	CGB has the same 384 tiles in second VRAM bank, they follow first
+	bank's ones. Writes go to tiles of bank mapped at 8000 now.
+*/
+class TileCache
+{
+public:
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	// Called on every VRAM write
+	inline void invalidate(H_WORD addr)
+	{
+		if (addr >= 0x8000 && addr < 0x9800)
+			m_dirty[m_bank + ((addr - 0x8000) >> 4)] = true;
+	}
+	// Called on bulk writes, first to last inclusive
+	inline void invalidate(H_WORD first, H_WORD last)
+	{
+		if (last < 0x8000 || first >= 0x9800)
+			return;
+		int from = (std::max<int>(first, 0x8000) - 0x8000) >> 4;
+		int to   = (std::min<int>(last, 0x97FF) - 0x8000) >> 4;
+		for (int i = from; i <= to; i++)
+			m_dirty[m_bank + i] = true;
+	}
+	void invalidate_all();
+
+	// VRAM bank CPU writes to
+	inline void set_bank(int bank) { m_bank = bank * 384; }
+
+	// 8x8 color numbers of tile, row by row. Tile 0 is at $8000, tile 383 is at $97F0,
+	// 384-767 are the same in CGB bank 1
+	inline const H_BYTE* tile(int index)
+	{
+		if (m_dirty[index])
+			decode(index);
+		return m_tiles[index].data();
+	}
+
+private:
+	GameBoy* gb = nullptr;
+
+	std::array<std::array<H_BYTE, 64>, 768> m_tiles = {};
+	std::array<bool, 768>                   m_dirty;
+	int                                     m_bank = 0;	// First tile of mapped bank
+
+	void decode(int);
+
+public:
+	TileCache() { m_dirty.fill(true); }
+};
\ No newline at end of file
@@ -0,0 +1,166 @@
+#define _CRT_SECURE_NO_WARNINGS
+
+#include "Tracer.h"
+#include "GameBoy.h"
+
+#include <cstring>
+#include <iostream>
+
+Tracer::Tracer()
+	: m_current{ 0 }, m_expected{ 0 }
+{
+}
+
+Tracer::~Tracer()
+{
+	close();
+}
+
+bool Tracer::open_log(const char* filename)
+{
+	// Stdout may have been written to already, it keeps its own buffering
+	if (std::strcmp(filename, "-") == 0)
+	{
+		m_log = stdout;
+		return true;
+	}
+
+	m_log = fopen(filename, "wb");
+	if (m_log == nullptr)
+	{
+		std::cerr << "Trace log failure: " << filename << std::endl;
+		return false;
+	}
+
+	m_log_buffer = new char[_TRACE_IO_BUFFER];
+	setvbuf(m_log, m_log_buffer, _IOFBF, _TRACE_IO_BUFFER);
+	return true;
+}
+
+bool Tracer::open_reference(const char* filename)
+{
+	m_reference = fopen(filename, "rb");
+	if (m_reference == nullptr)
+	{
+		std::cerr << "Reference log failure: " << filename << std::endl;
+		return false;
+	}
+
+	m_reference_buffer = new char[_TRACE_IO_BUFFER];
+	setvbuf(m_reference, m_reference_buffer, _IOFBF, _TRACE_IO_BUFFER);
+	return true;
+}
+
+void Tracer::close()
+{
+	if (m_log != nullptr)
+	{
+		fflush(m_log);
+		if (m_log != stdout)
+			fclose(m_log);
+		m_log = nullptr;
+	}
+
+	if (m_reference != nullptr)
+	{
+		fclose(m_reference);
+		m_reference = nullptr;
+	}
+
+	delete[] m_log_buffer;
+	delete[] m_reference_buffer;
+	m_log_buffer = nullptr;
+	m_reference_buffer = nullptr;
+}
+
+// Writes CPU state to m_current. No std::string or printf here
+// as this function is called for every single instruction
+int Tracer::format()
+{
+	static const char* digits = "0123456789ABCDEF";
+
+	char* p = m_current;
+	auto put_str = [&p](const char* s)
+	{
+		while (*s)
+			*p++ = *s++;
+	};
+	auto put_hex = [&p](H_WORD n, int d)
+	{
+		for (int i = d - 1; i >= 0; i--)
+			p[i] = digits[(n >> ((d - 1 - i) * 4)) & 0xF];
+		p += d;
+	};
+
+	const CPUZ80& cpu = gb->cpu;
+
+	put_str("A:");      put_hex(cpu.AF.hi, 2);
+	put_str(" F:");     put_hex(cpu.AF.lo, 2);
+	put_str(" B:");     put_hex(cpu.BC.hi, 2);
+	put_str(" C:");     put_hex(cpu.BC.lo, 2);
+	put_str(" D:");     put_hex(cpu.DE.hi, 2);
+	put_str(" E:");     put_hex(cpu.DE.lo, 2);
+	put_str(" H:");     put_hex(cpu.HL.hi, 2);
+	put_str(" L:");     put_hex(cpu.HL.lo, 2);
+	put_str(" SP:");    put_hex(cpu.SP.reg, 4);
+	put_str(" PC:");    put_hex(cpu.PC.reg, 4);
+	put_str(" PCMEM:"); put_hex(gb->read(cpu.PC.reg), 2);
+	for (int i = 1; i < 4; i++)
+	{
+		*p++ = ',';
+		put_hex(gb->read(cpu.PC.reg + i), 2);
+	}
+	*p = '\0';
+
+	return (int)(p - m_current);
+}
+
+void Tracer::trace()
+{
+	if (stopped())
+		return;
+
+	int length = format();
+	m_line++;
+
+	if (m_log != nullptr)
+	{
+		m_current[length] = '\n';
+		fwrite(m_current, 1, length + 1, m_log);
+		m_current[length] = '\0';
+	}
+
+	if (m_reference == nullptr)
+		return;
+
+	if (fgets(m_expected, _TRACE_LINE_SIZE, m_reference) == nullptr)
+	{
+		std::cout << "Reference log ended after " << (m_line - 1) << " lines, no mismatches" << std::endl;
+		m_exhausted = true;
+		return;
+	}
+
+	// Reference logs may come with Windows line endings
+	size_t expected_length = std::strcspn(m_expected, "\r\n");
+	m_expected[expected_length] = '\0';
+
+	if (expected_length != (size_t)length || std::memcmp(m_expected, m_current, length) != 0)
+	{
+		m_failed = true;
+		report();
+	}
+}
+
+void Tracer::report()
+{
+	if (m_log != nullptr)
+		fflush(m_log);
+
+	std::cerr << "Trace mismatch at line " << m_line << std::endl
+		<< "Expected >> " << m_expected << std::endl
+		<< "Got      >> " << m_current << std::endl;
+
+	H_WORD pc = gb->cpu.PC.reg;
+	if (!gb->symbols.empty())
+		std::cerr << "At       >> " << gb->symbols.describe(gb->bank_of(pc), pc) << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+#define _TRACE_LINE_SIZE 128
+#define _TRACE_IO_BUFFER 0x100000
+
+#include "core.h"
+
+#include <cstdio>
+
+class GameBoy;
+
+/*
+	Tracer
+
+	Prints CPU state before every instruction in gameboy-doctor format
+		A:01 F:B0 B:00 C:13 D:00 E:D8 H:01 L:4D SP:FFFE PC:0100 PCMEM:00,C3,13,02
+
+	Each line can be streamed to a log file and/or compared against a reference log.
+	Reference log is read one line at a time into a fixed buffer, so memory use
+	doesn't depend on the log size and multi-GB logs are fine.
+	Tracing stops at the first mismatch.
+*/
+class Tracer
+{
+public:
+	Tracer();
+	~Tracer();
+
+	inline void connect_device(GameBoy* instance) { gb = instance; };
+
+	bool open_log(const char*);		  // Streams trace to file. "-" means stdout
+	bool open_reference(const char*); // Compares trace against reference log
+	void close();
+
+	inline bool enabled() const { return m_log != nullptr || m_reference != nullptr; }
+	inline bool stopped() const { return m_failed || m_exhausted; }
+	inline bool failed()  const { return m_failed; }
+	inline H_QWORD lines() const { return m_line; }
+
+	// Called by CPU before each instruction
+	void trace();
+
+private:
+	// GameBoy instance
+	GameBoy* gb = nullptr;
+
+	FILE* m_log       = nullptr;
+	FILE* m_reference = nullptr;
+
+	char* m_log_buffer       = nullptr; // Large stdio buffers so we do big sequential reads/writes
+	char* m_reference_buffer = nullptr;
+
+	char m_current[_TRACE_LINE_SIZE];
+	char m_expected[_TRACE_LINE_SIZE];
+
+	H_QWORD m_line      = 0;
+	bool    m_failed    = false;
+	bool    m_exhausted = false; // Reference log has ended
+
+	int  format();				 // Formats current CPU state, returns line length
+	void report();				 // Prints mismatch
+};
\ No newline at end of file
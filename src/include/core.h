@@ -10,6 +10,9 @@ typedef int16_t  H_S_WORD;
 typedef uint32_t H_DWORD;
 typedef int32_t  H_S_DWORD;
 
+typedef uint64_t H_QWORD;
+typedef int64_t  H_S_QWORD;
+
 struct Register
 {
 	union
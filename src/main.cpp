@@ -1,18 +1,499 @@
 #define OLC_PGE_APPLICATION
 #include "include/GameBoy.h"
+#include "include/Observation.h"
+#include "include/RomCatalog.h"
 
+#include <algorithm>
 #include <iostream>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+static void usage()
+{
+	std::cout
+		<< "Usage: hadron [rom] [options]" << std::endl
+		<< "  rom can be gzip or zip compressed, or name or 16 digit hash of ROM in --catalog" << std::endl
+		<< "  --headless             Run without debugger window" << std::endl
+		<< "  --frames <n>           Run n frames and exit" << std::endl
+		<< "  --cycles <n>           Run n cycles and exit" << std::endl
+		<< "  --bench                Run unthrottled and print frames per second" << std::endl
+		<< "  --threads <n>          Number of emulator instances benchmarked in parallel" << std::endl
+		<< "  --link <rom>           Connect second Game Boy running rom by link cable, both run headless" << std::endl
+		<< "  --audio <rate>         Sound rate, 0 is off. Default is 48000 with window, off headless" << std::endl
+		<< "                         With --bench sound is not played, its cost is measured" << std::endl
+		<< "  --observe              With --bench every frame is made into observation for learning agents," << std::endl
+		<< "                         its cost is measured and SSE2 kernels are checked against plain C++" << std::endl
+		<< "  --dump-frames <dir>    Write every frame to <dir> as PPM" << std::endl
+		<< "  --record <file>        Record video, Y4M if file ends with .y4m, raw RGBA otherwise" << std::endl
+		<< "  --record-audio <file>  Record sound as WAV" << std::endl
+		<< "  --speed <x>            Speed multiplier, 1 is real time, 0 is unthrottled" << std::endl
+		<< "                         Default is real time with window and unthrottled headless" << std::endl
+		<< "  --trace <log|->        Write CPU state trace" << std::endl
+		<< "  --compare <log>        Compare CPU state with reference trace" << std::endl
+		<< "  --steps <n>            Trace only n instructions" << std::endl
+		<< "  --cdl <file>           Accumulate code/data coverage in file" << std::endl
+		<< "  --sym <file>           Load RGBDS symbols, default is <rom>.sym" << std::endl
+		<< "  --recompile <file>     Translate ROM code to C++ file, uses --cdl coverage if given" << std::endl
+		<< "  --interpret            Don't use recompiled code built in for ROM" << std::endl
+		<< "  --no-loop-hle          Run copy and fill loops instruction by instruction" << std::endl
+		<< "  --no-fusion            Run frequent instruction pairs one by one" << std::endl
+		<< "  --catalog <file>       ROM catalog to look rom up in" << std::endl
+		<< "  --scan <dir>           Update --catalog with ROMs under <dir>, only changed files are read" << std::endl;
+}
+
+// Writes screen as binary PPM
+static bool dump_frame(const GameBoy* gb, const std::string& dir, H_QWORD frame)
+{
+	char name[32];
+	snprintf(name, sizeof(name), "/frame_%06llu.ppm", (unsigned long long)frame);
+
+	FILE* pFile = fopen((dir + name).c_str(), "wb");
+	if (pFile == nullptr)
+	{
+		std::cerr << "Frame write failure: " << dir + name << std::endl;
+		return false;
+	}
+
+	H_BYTE rgb[_SCREEN_W * _SCREEN_H * 3];
+	H_BYTE* p = rgb;
+	for (int y = 0; y < _SCREEN_H; ++y)
+		for (int x = 0; x < _SCREEN_W; ++x)
+		{
+			const ScreenData& sd = gb->screen.pixel(x, y);
+			*p++ = sd.r;
+			*p++ = sd.g;
+			*p++ = sd.b;
+		}
+
+	fprintf(pFile, "P6\n%d %d\n255\n", _SCREEN_W, _SCREEN_H);
+	size_t result = fwrite(rgb, 1, sizeof(rgb), pFile);
+	fclose(pFile);
+	return result == sizeof(rgb);
+}
+
+// Time bench spends on work beside emulation, per instance
+struct BENCH_TIME
+{
+	double audio   = 0.0;
+	double observe = 0.0;
+};
+
+// Runs emulation in frame long slices. 0 cycles runs forever.
+// Every frame is pushed to observe and read back as floats if it is given.
+// Time spent producing sound and observations is added to time if given
+static void run(GameBoy* gb, H_QWORD cycles, double speed, const char* dump, Observation* observe, BENCH_TIME* time)
+{
+	gb->governor.set_speed(speed);
+	gb->audio.pause(false);
+
+	std::vector<float> observation(observe != nullptr ? observe->size() : 0);
+
+	H_QWORD done = 0;
+	for (H_QWORD frame = 0; cycles == 0 || done < cycles; frame++)
+	{
+		// Slices are frames of LCD time, CGB double speed fits twice as many CPU cycles in them
+		H_QWORD slice = (cycles == 0) ? FRAME_CYCLES : std::min<H_QWORD>(FRAME_CYCLES, cycles - done);
+		gb->cpu.run(gb->cpu.cpu_cycles(slice));
+		done += slice;
+
+		if (dump != nullptr && slice == FRAME_CYCLES)
+			dump_frame(gb, dump, frame);
+		if (slice == FRAME_CYCLES)
+			gb->recorder.frame();
+
+		if (observe != nullptr && slice == FRAME_CYCLES)
+		{
+			auto start = std::chrono::steady_clock::now();
+			observe->push(gb->screen);
+			observe->read(observation.data());
+			if (time != nullptr)
+				time->observe += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		// Without device samples are still taken, so all of the output path runs
+		if (gb->apu.sample_rate() != 0)
+		{
+			auto start = std::chrono::steady_clock::now();
+			if (gb->audio.opened())
+				gb->audio.update();
+			else
+			{
+				H_S_WORD samples[1024 * 2];
+				size_t count;
+				while ((count = gb->apu.read_samples(samples, 1024)) != 0)
+					gb->recorder.samples(samples, count);
+			}
+			if (time != nullptr)
+				time->audio += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		}
+
+		gb->governor.frame();
+	}
+}
+
+// Runs gb and second instance with rom connected by link cable, each on its own thread.
+// 0 cycles runs forever
+static void run_linked(GameBoy* gb, const char* rom, H_QWORD cycles)
+{
+	Cartridge* c = new Cartridge(rom);
+	GameBoy* other = new GameBoy();
+	other->cartrdige_loader.load_cartridge(*c);
+
+	Link link;
+	link.connect(*gb, *other);
+
+	auto start = std::chrono::steady_clock::now();
+	H_QWORD done = 0;
+	while (cycles == 0 || done < cycles)
+	{
+		H_QWORD slice = (cycles == 0) ? FRAME_CYCLES : std::min<H_QWORD>(FRAME_CYCLES, cycles - done);
+		link.run(slice);
+		done += slice;
+	}
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	double frames = (double)done / FRAME_CYCLES;
+	printf("Linked >> %.0f frames of both in %.3f s\n", frames, seconds);
+	printf("Speed >> %.2fx realtime\n", frames / seconds / (CLOCKSPEED / (double)FRAME_CYCLES));
+
+	link.disconnect();
+	delete other;
+}
+
+// Every instance runs on its own thread, result is their total throughput
+static void bench(Cartridge* c, H_QWORD cycles, int threads, int audio, bool observe, bool interpret, bool loop_hle, bool fusion)
+{
+	// Instances are created here, window system setup of debugger is not thread safe
+	std::vector<GameBoy*> instances;
+	for (int i = 0; i < threads; i++)
+	{
+		GameBoy* gb = new GameBoy();
+		if (c != nullptr)
+			gb->cartrdige_loader.load_cartridge(*c);
+		if (interpret)
+			gb->cpu.set_blocks({});
+		gb->cpu.set_loop_hle(loop_hle);
+		gb->cpu.set_fusion(fusion);
+		gb->apu.set_sample_rate(audio);
+		instances.push_back(gb);
+	}
+
+	std::vector<BENCH_TIME>  time(threads);
+	std::vector<Observation> observations(observe ? threads : 0);
+
+	auto start = std::chrono::steady_clock::now();
+	std::vector<std::thread> workers;
+	for (int i = 0; i < threads; i++)
+		workers.emplace_back(run, instances[i], cycles, 0.0, nullptr, observe ? &observations[i] : nullptr, &time[i]);
+	for (std::thread& t : workers)
+		t.join();
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+	double frames = (double)cycles * threads / FRAME_CYCLES;
+	double fps = frames / seconds;
+	printf("Frames >> %.0f in %.3f s\n", frames, seconds);
+	printf("FPS >> %.1f (%.1f per thread)\n", fps, fps / threads);
+	printf("Speed >> %.2fx realtime\n", fps / (CLOCKSPEED / (double)FRAME_CYCLES));
+	if (instances[0]->cpu.loop_bytes() != 0)
+		printf("Loops >> %llu bytes copied or filled at once per thread\n", (unsigned long long)instances[0]->cpu.loop_bytes());
+	if (instances[0]->cpu.fused_pairs() != 0)
+		printf("Pairs >> %llu instruction pairs fused per thread\n", (unsigned long long)instances[0]->cpu.fused_pairs());
+
+	// Channels catch up on register writes too, that part is counted as emulation
+	if (audio != 0)
+	{
+		double cost = 0.0;
+		for (const BENCH_TIME& t : time)
+			cost += t.audio;
+		cost = std::max(cost, 1e-9);
+
+		double emulated = (double)cycles * threads / CLOCKSPEED;
+		printf("Audio >> %.3f s of %d Hz output in %.3f s (%.1f%% of run)\n", emulated, audio, cost, 100.0 * cost / (seconds * threads));
+		printf("Audio speed >> %.0fx realtime\n", emulated / cost);
+	}
+
+	if (observe)
+	{
+		double cost = 0.0;
+		for (const BENCH_TIME& t : time)
+			cost += t.observe;
+
+		const Observation& o = observations[0];
+		printf("Observation >> %dx%dx%d floats every frame, %.1f us per frame (%.1f%% of run)\n", o.width(), o.height(), o.stack(),
+			1e6 * cost / std::max(frames, 1.0), 100.0 * cost / (seconds * threads));
+		if (Observation::check())
+			printf("Observation check >> SSE2 and plain C++ kernels agree\n");
+		else
+			std::cerr << "Observation check failure: SSE2 and plain C++ kernels differ" << std::endl;
+	}
+
+	for (GameBoy* gb : instances)
+		delete gb;
+}
 
 int main(int argc, char** argv)
 {
+	// hadron [rom] [--headless] [--frames <n>] [--cycles <n>] [--bench] [--threads <n>] [--audio <rate>] [--dump-frames <dir>] [--record <file>] [--record-audio <file>] [--speed <x>]
+	//              [--trace <log|->] [--compare <reference log>] [--steps <instructions>] [--cdl <coverage file>] [--sym <symbols>]
+	//              [--recompile <cpp file>] [--interpret] [--no-loop-hle] [--no-fusion] [--catalog <file>] [--scan <dir>] [--link <rom>] [--observe]
+	const char* rom       = nullptr;
+	const char* catalog   = nullptr;
+	const char* scan      = nullptr;
+	const char* trace     = nullptr;
+	const char* reference = nullptr;
+	const char* cdl       = nullptr;
+	const char* sym       = nullptr;
+	const char* recompile = nullptr;
+	const char* dump      = nullptr;
+	const char* record    = nullptr;
+	const char* record_audio = nullptr;
+	const char* link      = nullptr;
+	H_QWORD     steps     = 0;
+	H_QWORD     cycles    = 0;
+	double      speed     = -1.0; // Real time with window, unthrottled without
+	int         threads   = 1;
+	int         audio     = -1; // 48000 with window, off without
+	bool        headless  = false;
+	bool        benchmark = false;
+	bool        observe   = false;
+	bool        interpret = false;
+	bool        loop_hle  = true;
+	bool        fusion    = true;
+	for (int i = 1; i < argc; i++)
+	{
+		try
+		{
+			if (std::strcmp(argv[i], "--trace") == 0 && i + 1 < argc)
+				trace = argv[++i];
+			else if (std::strcmp(argv[i], "--compare") == 0 && i + 1 < argc)
+				reference = argv[++i];
+			else if (std::strcmp(argv[i], "--steps") == 0 && i + 1 < argc)
+				steps = std::stoull(argv[++i]);
+			else if (std::strcmp(argv[i], "--cdl") == 0 && i + 1 < argc)
+				cdl = argv[++i];
+			else if (std::strcmp(argv[i], "--sym") == 0 && i + 1 < argc)
+				sym = argv[++i];
+			else if (std::strcmp(argv[i], "--frames") == 0 && i + 1 < argc)
+				cycles = std::stoull(argv[++i]) * FRAME_CYCLES;
+			else if (std::strcmp(argv[i], "--cycles") == 0 && i + 1 < argc)
+				cycles = std::stoull(argv[++i]);
+			else if (std::strcmp(argv[i], "--dump-frames") == 0 && i + 1 < argc)
+				dump = argv[++i];
+			else if (std::strcmp(argv[i], "--record") == 0 && i + 1 < argc)
+				record = argv[++i];
+			else if (std::strcmp(argv[i], "--record-audio") == 0 && i + 1 < argc)
+				record_audio = argv[++i];
+			else if (std::strcmp(argv[i], "--speed") == 0 && i + 1 < argc)
+				speed = std::stod(argv[++i]);
+			else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+				threads = std::max(1, std::stoi(argv[++i]));
+			else if (std::strcmp(argv[i], "--audio") == 0 && i + 1 < argc)
+				audio = std::max(0, std::stoi(argv[++i]));
+			else if (std::strcmp(argv[i], "--recompile") == 0 && i + 1 < argc)
+				recompile = argv[++i];
+			else if (std::strcmp(argv[i], "--link") == 0 && i + 1 < argc)
+				link = argv[++i];
+			else if (std::strcmp(argv[i], "--catalog") == 0 && i + 1 < argc)
+				catalog = argv[++i];
+			else if (std::strcmp(argv[i], "--scan") == 0 && i + 1 < argc)
+				scan = argv[++i];
+			else if (std::strcmp(argv[i], "--interpret") == 0)
+				interpret = true;
+			else if (std::strcmp(argv[i], "--no-loop-hle") == 0)
+				loop_hle = false;
+			else if (std::strcmp(argv[i], "--no-fusion") == 0)
+				fusion = false;
+			else if (std::strcmp(argv[i], "--headless") == 0)
+				headless = true;
+			else if (std::strcmp(argv[i], "--bench") == 0)
+				benchmark = true;
+			else if (std::strcmp(argv[i], "--observe") == 0)
+				observe = true;
+			else if (std::strcmp(argv[i], "--help") == 0)
+			{
+				usage();
+				return 0;
+			}
+			else if (argv[i][0] == '-')
+			{
+				std::cerr << "Unknown option: " << argv[i] << std::endl;
+				usage();
+				return 1;
+			}
+			else
+				rom = argv[i];
+		}
+		catch (const std::exception&)
+		{
+			// Number options throw when value is not a number or doesn't fit
+			std::cerr << "Bad value for " << argv[i - 1] << ": " << argv[i] << std::endl;
+			usage();
+			return 1;
+		}
+	}
+
+	RomCatalog roms;
+	std::string rom_path;
+	if (scan != nullptr)
+	{
+		if (catalog == nullptr)
+		{
+			std::cerr << "--scan needs --catalog" << std::endl;
+			return 1;
+		}
+
+		auto start = std::chrono::steady_clock::now();
+		if (!roms.scan(catalog, scan))
+			return 1;
+		double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		printf("Catalog >> %zu ROMs, %zu read, %zu removed in %.3f s\n", roms.size(), roms.hashed(), roms.removed(), seconds);
+
+		if (rom == nullptr)
+			return 0;
+	}
+
+	// Name or hash from catalog when there is no such file
+	FILE* pRom = rom != nullptr ? fopen(rom, "rb") : nullptr;
+	if (pRom != nullptr)
+		fclose(pRom);
+	else if (rom != nullptr && catalog != nullptr)
+	{
+		if (roms.size() == 0 && !roms.open(catalog))
+		{
+			std::cerr << "Catalog failure: " << catalog << std::endl;
+			return 1;
+		}
+
+		char* end = nullptr;
+		H_QWORD hash = std::strtoull(rom, &end, 16);
+		const RomCatalog::ENTRY* e = (std::strlen(rom) == 16 && *end == '\0') ? roms.find(hash) : nullptr;
+		if (e == nullptr)
+			e = roms.find(rom);
+		if (e == nullptr)
+		{
+			std::cerr << "ROM is not in catalog: " << rom << std::endl;
+			return 1;
+		}
+		rom_path = roms.path(*e);
+		rom = rom_path.c_str();
+	}
+
+	// Trace on stdout is diffed against reference logs, nothing else may go there
+	bool trace_stdout = trace != nullptr && std::strcmp(trace, "-") == 0;
+	if (trace_stdout)
+		std::cout.rdbuf(std::cerr.rdbuf());
+
+	Cartridge* c = rom != nullptr ? new Cartridge(rom, trace_stdout ? stderr : stdout) : nullptr;
+
+	if (benchmark)
+	{
+		// One emulated minute unless told otherwise
+		bench(c, cycles != 0 ? cycles : 3600 * (H_QWORD)FRAME_CYCLES, threads, std::max(audio, 0), observe, interpret, loop_hle, fusion);
+		return 0;
+	}
+
 	GameBoy* gb = new GameBoy();
 
-	//Cartridge c("C:\\personal\\8bitgames\\GB\\Tetris.gb");
-	//gb->cartrdige_loader.load_cartridge(c);
+	if (c != nullptr)
+	{
+		gb->cartrdige_loader.load_cartridge(*c);
+
+		// RGBDS puts game.sym next to game.gb
+		if (sym != nullptr)
+			gb->symbols.load(sym);
+		else
+		{
+			std::string sym_path(rom);
+			size_t dot = sym_path.find_last_of('.');
+			if (dot != std::string::npos && sym_path.find_first_of("/\\", dot) == std::string::npos)
+				sym_path.resize(dot);
+			gb->symbols.load((sym_path + ".sym").c_str());
+		}
+
+		// Coverage accumulates across runs
+		if (cdl != nullptr)
+		{
+			gb->cdl.attach(c->m_size);
+			gb->cdl.load(cdl);
+		}
+
+		if (recompile != nullptr)
+		{
+			Recompiler recompiler;
+			const CodeDataLogger* coverage = gb->cdl.enabled() ? &gb->cdl : nullptr;
+			return recompiler.translate(gb->cpu, c->m_rom, c->m_size, coverage, recompile) ? 0 : 1;
+		}
+		if (interpret)
+			gb->cpu.set_blocks({});
+	}
+	gb->cpu.set_loop_hle(loop_hle);
+	gb->cpu.set_fusion(fusion);
+
+	if (trace != nullptr || reference != nullptr)
+	{
+		if (trace != nullptr && !gb->tracer.open_log(trace))
+			return 1;
+		if (reference != nullptr && !gb->tracer.open_reference(reference))
+			return 1;
+
+		while (!gb->tracer.stopped() && (steps == 0 || gb->tracer.lines() < steps))
+			gb->cpu.cpu_clock();
+
+		gb->tracer.close();
+
+		if (gb->cdl.enabled())
+		{
+			gb->cdl.save(cdl);
+			gb->cdl.log_summary();
+		}
+
+		return gb->tracer.failed() ? 1 : 0;
+	}
+
+	if (link != nullptr)
+	{
+		run_linked(gb, link, cycles);
+		return 0;
+	}
+
+	if (headless || cycles != 0 || dump != nullptr)
+	{
+		// Sound plays if asked for, without device it is made and thrown away
+		if (audio > 0 && !gb->audio.open(audio))
+			gb->apu.set_sample_rate(audio);
+		else if (audio < 0 && record_audio != nullptr)
+			gb->apu.set_sample_rate(48000);
+
+		if ((record != nullptr || record_audio != nullptr) && !gb->recorder.start(record, record_audio))
+			return 1;
+
+		run(gb, cycles, speed < 0.0 ? 0.0 : speed, dump, nullptr, nullptr);
+		gb->recorder.stop();
+
+		if (gb->cdl.enabled())
+		{
+			gb->cdl.save(cdl);
+			gb->cdl.log_summary();
+		}
+		return 0;
+	}
+
+	gb->governor.set_speed(speed < 0.0 ? 1.0 : speed);
+	gb->screen.open();
+	if (audio != 0)
+		gb->audio.open(audio < 0 ? 48000 : audio);
+	if ((record != nullptr || record_audio != nullptr) && !gb->recorder.start(record, record_audio))
+		return 1;
 
 	gb->debugger.Construct(680, 480, 2, 2);
 	gb->debugger.Start();
+	gb->recorder.stop();
 
-	std::cin.get();
 	return 0;
 }
\ No newline at end of file